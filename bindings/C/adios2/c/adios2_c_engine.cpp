@@ -288,6 +288,66 @@ adios2_error adios2_steps(size_t *steps, const adios2_engine *engine)
     }
 }
 
+adios2_metrics *adios2_engine_get_metrics(const adios2_engine *engine)
+{
+    adios2_metrics *metrics = NULL;
+    try
+    {
+        adios2::helper::CheckForNullptr(
+            engine, "for adios2_engine, in call to adios2_engine_get_metrics");
+
+        const adios2::core::Engine *engineCpp =
+            reinterpret_cast<const adios2::core::Engine *>(engine);
+
+        const adios2::Metrics metricsCpp = engineCpp->GetMetrics();
+
+        metrics = (adios2_metrics *)malloc(sizeof(adios2_metrics));
+        metrics->nmetrics = metricsCpp.size();
+        metrics->names = NULL;
+        metrics->values = NULL;
+        if (metrics->nmetrics > 0)
+        {
+            metrics->names =
+                (char **)malloc(metrics->nmetrics * sizeof(char *));
+            metrics->values =
+                (double *)malloc(metrics->nmetrics * sizeof(double));
+            size_t i = 0;
+            for (const auto &metric : metricsCpp)
+            {
+                metrics->names[i] =
+                    (char *)malloc((metric.first.size() + 1) * sizeof(char));
+                strcpy(metrics->names[i], metric.first.c_str());
+                metrics->values[i] = metric.second;
+                ++i;
+            }
+        }
+    }
+    catch (...)
+    {
+        adios2_free_metrics(metrics);
+        adios2::helper::ExceptionToError("adios2_engine_get_metrics");
+        return NULL;
+    }
+    return metrics;
+}
+
+void adios2_free_metrics(adios2_metrics *metrics)
+{
+    if (metrics != NULL)
+    {
+        if (metrics->names != NULL)
+        {
+            for (size_t i = 0; i < metrics->nmetrics; ++i)
+            {
+                free(metrics->names[i]);
+            }
+        }
+        free(metrics->names);
+        free(metrics->values);
+        free(metrics);
+    }
+}
+
 adios2_error adios2_put(adios2_engine *engine, adios2_variable *variable,
                         const void *data, const adios2_mode mode)
 {
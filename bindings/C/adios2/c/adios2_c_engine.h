@@ -98,6 +98,24 @@ adios2_error adios2_between_step_pairs(size_t *between_step_pairs,
  */
 adios2_error adios2_steps(size_t *steps, const adios2_engine *engine);
 
+/**
+ * Snapshot of the engine's performance counters for this process, e.g. bytes
+ * written, time spent in EndStep or steps queued for readers. Names and units
+ * are engine specific, the unit is part of the name (_bytes, _us, _seconds).
+ * @param engine input handler
+ * @return Newly allocated adios2_metrics structure (nmetrics is 0 if the
+ * engine has no metrics), NULL pointer on error. The memory must be freed by
+ * the adios2_free_metrics function
+ */
+adios2_metrics *adios2_engine_get_metrics(const adios2_engine *engine);
+
+/**
+ * free adios2_metrics structure
+ * @param metrics
+ * @return void
+ */
+void adios2_free_metrics(adios2_metrics *metrics);
+
 //***************** PUT *****************
 /**
  * Put data associated with a Variable in an engine, used for engines with
@@ -187,6 +187,14 @@ typedef struct
     adios2_blockinfo *BlocksInfo;
 } adios2_varinfo;
 
+/** engine performance counters, see adios2_engine_get_metrics */
+typedef struct
+{
+    size_t nmetrics;
+    char **names;
+    double *values;
+} adios2_metrics;
+
 #ifdef __cplusplus
 } // end extern C
 #endif
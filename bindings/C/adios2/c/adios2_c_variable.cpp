@@ -132,6 +132,43 @@ adios2_error adios2_set_selection(adios2_variable *variable, const size_t ndims,
     }
 }
 
+adios2_error adios2_set_strided_selection(adios2_variable *variable,
+                                          const size_t ndims,
+                                          const size_t *start,
+                                          const size_t *count,
+                                          const size_t *stride)
+{
+    try
+    {
+        adios2::helper::CheckForNullptr(variable,
+                                        "for adios2_variable, in call to "
+                                        "adios2_set_strided_selection");
+        adios2::helper::CheckForNullptr(start, "for start, in call to "
+                                               "adios2_set_strided_selection");
+        adios2::helper::CheckForNullptr(count, "for count, in call to "
+                                               "adios2_set_strided_selection");
+        adios2::helper::CheckForNullptr(stride,
+                                        "for stride, in call to "
+                                        "adios2_set_strided_selection");
+        adios2::core::VariableBase *variableBase =
+            reinterpret_cast<adios2::core::VariableBase *>(variable);
+
+        const adios2::Dims startV(start, start + ndims);
+        const adios2::Dims countV(count, count + ndims);
+        const adios2::Dims strideV(stride, stride + ndims);
+
+        variableBase->SetSelection({startV, countV}, strideV);
+        variableBase->CheckDimensions(
+            "in call to adios2_set_strided_selection");
+        return adios2_error_none;
+    }
+    catch (...)
+    {
+        return static_cast<adios2_error>(
+            adios2::helper::ExceptionToError("adios2_set_strided_selection"));
+    }
+}
+
 adios2_error adios2_set_memory_selection(adios2_variable *variable,
                                          const size_t ndims,
                                          const size_t *memory_start,
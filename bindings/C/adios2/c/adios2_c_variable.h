@@ -54,6 +54,22 @@ adios2_error adios2_set_block_selection(adios2_variable *variable,
 adios2_error adios2_set_selection(adios2_variable *variable, const size_t ndims,
                                   const size_t *start, const size_t *count);
 
+/**
+ * Set a strided (decimated) read selection, element i of dimension d is
+ * start[d] + i * stride[d] for i in [0, count[d])
+ * @param variable handler for which new selection will be applied to
+ * @param ndims number of dimensions for start, count and stride
+ * @param start new start dimensions array
+ * @param count number of selected elements per dimension
+ * @param stride distance between selected elements per dimension
+ * @return adios2_error 0: success, see enum adios2_error for errors
+ */
+adios2_error adios2_set_strided_selection(adios2_variable *variable,
+                                          const size_t ndims,
+                                          const size_t *start,
+                                          const size_t *count,
+                                          const size_t *stride);
+
 /**
  * Set the local start (offset) point to the memory pointer passed at Put
  * and the memory local dimensions (count). Used for non-contiguous memory
@@ -18,6 +18,31 @@
 namespace adios2
 {
 
+GetFuture::GetFuture(std::shared_future<void> future)
+: m_Future(std::move(future))
+{
+}
+
+void GetFuture::Wait() const
+{
+    if (!m_Future.valid())
+    {
+        helper::Throw<std::invalid_argument>("bindings::CXX11", "GetFuture",
+                                             "Wait",
+                                             "invalid (default) GetFuture");
+    }
+    m_Future.get();
+}
+
+bool GetFuture::Test() const
+{
+    return m_Future.valid() &&
+           m_Future.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+}
+
+GetFuture::operator bool() const noexcept { return m_Future.valid(); }
+
 Engine::operator bool() const noexcept
 {
     if (m_Engine == nullptr)
@@ -89,6 +114,12 @@ void Engine::PerformGets()
     m_Engine->PerformGets();
 }
 
+GetFuture Engine::PerformGetsAsync()
+{
+    helper::CheckForNullptr(m_Engine, "in call to Engine::PerformGetsAsync");
+    return GetFuture(m_Engine->PerformGetsAsync());
+}
+
 void Engine::LockWriterDefinitions()
 {
     helper::CheckForNullptr(m_Engine,
@@ -133,6 +164,12 @@ size_t Engine::Steps() const
     return m_Engine->Steps();
 }
 
+Metrics Engine::GetMetrics() const
+{
+    helper::CheckForNullptr(m_Engine, "in call to Engine::GetMetrics");
+    return m_Engine->GetMetrics();
+}
+
 Engine::Engine(core::Engine *engine) : m_Engine(engine) {}
 
 void Engine::Put(VariableNT &variable, const void *data, const Mode launch)
@@ -351,6 +388,7 @@ Engine::AllStepsBlocksInfo(const VariableNT &variable) const
     template void Engine::Put<T>(const std::string &, const T &, const Mode);  \
                                                                                \
     template void Engine::Get<T>(Variable<T>, T *, const Mode);                \
+    template GetFuture Engine::GetAsync<T>(Variable<T>, T *);                  \
     template void Engine::Get<T>(const std::string &, T *, const Mode);        \
     template void Engine::Get<T>(Variable<T>, T &, const Mode);                \
     template void Engine::Get<T>(const std::string &, T &, const Mode);        \
@@ -18,6 +18,8 @@
 #include "adios2/common/ADIOSMacros.h"
 #include "adios2/common/ADIOSTypes.h"
 
+#include <future>
+
 namespace adios2
 {
 
@@ -32,6 +34,35 @@ class Engine; // private implementation
 }
 /// \endcond
 
+/**
+ * Completion handle of asynchronous Gets, returned by Engine::GetAsync and
+ * Engine::PerformGetsAsync. Copies refer to the same Gets.
+ */
+class GetFuture
+{
+    friend class Engine;
+
+public:
+    GetFuture() = default;
+    ~GetFuture() = default;
+
+    /**
+     * Blocks until the data of the Gets is in place
+     * @exception rethrows any failure of the Gets
+     */
+    void Wait() const;
+
+    /** @return true if the Gets are complete (Wait will not block) */
+    bool Test() const;
+
+    /** true: valid handle, false: default constructed */
+    explicit operator bool() const noexcept;
+
+private:
+    GetFuture(std::shared_future<void> future);
+    std::shared_future<void> m_Future;
+};
+
 class Engine
 {
     friend class IO;
@@ -394,6 +425,26 @@ public:
     /** Perform all Get calls in Deferred mode up to this point */
     void PerformGets();
 
+    /**
+     * Get data associated with a Variable without waiting for it. Queues the
+     * Get in Deferred mode and starts all Gets queued so far in the
+     * background where the engine supports it (BP5), otherwise completes
+     * them before returning.
+     * @param variable contains variable metadata information
+     * @param data user data to be associated with a variable, it must be
+     * pre-allocated and must not be used before the returned handle completes
+     * @return handle that completes once data is populated
+     * @exception std::invalid_argument for invalid variable or nullptr data
+     */
+    template <class T>
+    GetFuture GetAsync(Variable<T> variable, T *data);
+
+    /** Start all Get calls in Deferred mode up to this point without waiting
+     * for them. EndStep, PerformGets and Close wait for pending Gets.
+     * @return handle that completes once the data of these Gets is in place
+     */
+    GetFuture PerformGetsAsync();
+
     /**
      * Ends current step, by default calls PerformsPut/Get internally
      * Check each engine documentation for MPI collective/non-collective
@@ -470,6 +521,15 @@ public:
      */
     size_t Steps() const;
 
+    /**
+     * Snapshot of the engine's performance counters for this process, e.g.
+     * bytes written, time spent in EndStep or steps queued for readers. Names
+     * and units are engine specific, the unit is part of the name (_bytes,
+     * _us, _seconds). Engines without metrics return an empty map.
+     * @return metric name -> value
+     */
+    Metrics GetMetrics() const;
+
     /**
      * @brief Promise that no more definitions or changes to defined variables
      * will occur. Useful information if called before the first EndStep() of an
@@ -148,6 +148,17 @@ void Engine::Get(Variable<T> variable, T *data, const Mode launch)
                   launch);
 }
 
+template <class T>
+GetFuture Engine::GetAsync(Variable<T> variable, T *data)
+{
+    using IOType = typename TypeInfo<T>::IOType;
+    adios2::helper::CheckForNullptr(m_Engine, "in call to Engine::GetAsync");
+    adios2::helper::CheckForNullptr(variable.m_Variable,
+                                    "for variable in call to Engine::GetAsync");
+    return GetFuture(m_Engine->GetAsync(*variable.m_Variable,
+                                        reinterpret_cast<IOType *>(data)));
+}
+
 template <class T>
 void Engine::Get(const std::string &variableName, T *data, const Mode launch)
 {
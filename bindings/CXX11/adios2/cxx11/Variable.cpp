@@ -62,6 +62,15 @@ namespace adios2
     }                                                                          \
                                                                                \
     template <>                                                                \
+    void Variable<T>::SetSelection(const Box<Dims> &selection,                 \
+                                   const Dims &stride)                         \
+    {                                                                          \
+        helper::CheckForNullptr(m_Variable,                                    \
+                                "in call to Variable<T>::SetSelection");       \
+        m_Variable->SetSelection(selection, stride);                           \
+    }                                                                          \
+                                                                               \
+    template <>                                                                \
     void Variable<T>::SetMemorySelection(const Box<Dims> &memorySelection)     \
     {                                                                          \
         helper::CheckForNullptr(m_Variable,                                    \
@@ -70,6 +79,22 @@ namespace adios2
     }                                                                          \
                                                                                \
     template <>                                                                \
+    void Variable<T>::SetValueFilter(const T min, const T max)                 \
+    {                                                                          \
+        helper::CheckForNullptr(m_Variable,                                    \
+                                "in call to Variable<T>::SetValueFilter");     \
+        m_Variable->SetValueFilter(min, max);                                  \
+    }                                                                          \
+                                                                               \
+    template <>                                                                \
+    void Variable<T>::RemoveValueFilter()                                      \
+    {                                                                          \
+        helper::CheckForNullptr(m_Variable,                                    \
+                                "in call to Variable<T>::RemoveValueFilter");  \
+        m_Variable->RemoveValueFilter();                                       \
+    }                                                                          \
+                                                                               \
+    template <>                                                                \
     void Variable<T>::SetStepSelection(const Box<size_t> &stepSelection)       \
     {                                                                          \
         helper::CheckForNullptr(m_Variable,                                    \
@@ -178,6 +178,16 @@ public:
      */
     void SetSelection(const adios2::Box<adios2::Dims> &selection);
 
+    /**
+     * Sets a strided (decimated) read selection: element i of dimension d is
+     * start[d] + i * stride[d], for i in [0, count[d]). The memory passed at
+     * Get holds the product of count elements.
+     * @param selection input {start, count}
+     * @param stride distance between selected elements in each dimension
+     */
+    void SetSelection(const adios2::Box<adios2::Dims> &selection,
+                      const adios2::Dims &stride);
+
     /**
      * Set the local start (offset) point to the memory pointer passed at Put
      * and the memory local dimensions (count). Used for non-contiguous memory
@@ -203,6 +213,22 @@ public:
      */
     void SetStepSelection(const adios2::Box<size_t> &stepSelection);
 
+    /**
+     * Read mode only. Hints that only values within [min, max] are of
+     * interest: engines that record sub-block min/max (BP5 with
+     * StatsBlockSize) skip reading sub-blocks that cannot contain such
+     * values. Elements of skipped sub-blocks are left untouched in the
+     * memory passed to Get. Other engines ignore the filter.
+     * @param min lower bound of the values of interest
+     * @param max upper bound of the values of interest
+     */
+    void SetValueFilter(const T min, const T max);
+
+    /**
+     * Removes a filter set with SetValueFilter, Get reads all data again
+     */
+    void RemoveValueFilter();
+
     /**
      * Returns the number of elements required for pre-allocation based on
      * current count and stepsCount
@@ -357,6 +383,12 @@ public:
         bool IsReverseDims = false;
         /** true: value, false: array */
         bool IsValue = false;
+        /** sub-block Min/Max pairs, empty unless the engine recorded
+         * sub-block statistics (BP5 StatsBlockSize) */
+        std::vector<IOType> MinMaxs;
+        /** sub-block {start, count} relative to the block Start, one per
+         * MinMaxs pair */
+        std::vector<adios2::Box<adios2::Dims>> SubBlocks;
 
         // allow Engine to set m_Info
         friend class Engine;
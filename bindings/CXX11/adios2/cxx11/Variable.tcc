@@ -210,6 +210,22 @@ Variable<T>::ToBlocksInfoMin(const MinVarInfo *coreVarInfo) const
         {
             blockInfo.Min = *(T *)&coreBlockInfo.MinMax.MinUnion;
             blockInfo.Max = *(T *)&coreBlockInfo.MinMax.MaxUnion;
+            if (coreBlockInfo.SubBlockCount > 0)
+            {
+                const IOType *MMs =
+                    static_cast<const IOType *>(coreBlockInfo.SubBlockMinMax);
+                blockInfo.MinMaxs.assign(MMs,
+                                         MMs + 2 * coreBlockInfo.SubBlockCount);
+                const helper::BlockDivisionInfo div = helper::DivideBlock(
+                    blockInfo.Count, coreBlockInfo.SubBlockSize,
+                    helper::BlockDivisionMethod::Contiguous);
+                blockInfo.SubBlocks.reserve(coreBlockInfo.SubBlockCount);
+                for (unsigned int b = 0; b < coreBlockInfo.SubBlockCount; b++)
+                {
+                    blockInfo.SubBlocks.push_back(
+                        helper::GetSubBlock(blockInfo.Count, div, b));
+                }
+            }
         }
         blockInfo.BlockID = coreBlockInfo.BlockID;
         blocksInfo.push_back(blockInfo);
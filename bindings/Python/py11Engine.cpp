@@ -14,6 +14,7 @@
 #include "adios2/core/Engine.h"
 #include "adios2/helper/adiosFunctions.h"
 
+#include <memory>
 #include <sstream>
 
 #include "py11types.h"
@@ -23,8 +24,81 @@ namespace adios2
 namespace py11
 {
 
+GetFuture::GetFuture(std::shared_future<void> future, pybind11::object array)
+: m_Future(std::move(future)), m_Array(std::move(array))
+{
+}
+
+GetFuture::operator bool() const noexcept { return m_Future.valid(); }
+
+void GetFuture::Wait()
+{
+    if (!m_Future.valid())
+    {
+        throw std::invalid_argument(
+            "ERROR: invalid GetFuture, in call to GetFuture::Wait\n");
+    }
+    {
+        pybind11::gil_scoped_release release;
+        m_Future.wait();
+    }
+    m_Array = pybind11::none();
+    m_Future.get();
+}
+
+bool GetFuture::Test() const
+{
+    return m_Future.valid() &&
+           m_Future.wait_for(std::chrono::seconds(0)) ==
+               std::future_status::ready;
+}
+
+void GetFuture::Next()
+{
+    if (!Test())
+    {
+        return;
+    }
+    Wait();
+    throw pybind11::stop_iteration();
+}
+
 Engine::Engine(core::Engine *engine) : m_Engine(engine) {}
 
+template <class T>
+pybind11::array Engine::DoGetArray(core::Variable<T> &variable,
+                                   const Mode launch)
+{
+    if (m_Engine->m_EngineType == "InlineReader")
+    {
+        // zero-copy view of the writer's block, valid until EndStep
+        typename core::Variable<T>::BPInfo *info =
+            m_Engine->Get(variable, launch);
+        const T *data = info->Data;
+        return pybind11::array_t<T>(info->Count, data,
+                                    pybind11::capsule(data, [](void *) {}));
+    }
+
+    Dims shape = variable.Count();
+    if (variable.m_StepsCount > 1)
+    {
+        shape.insert(shape.begin(), variable.m_StepsCount);
+    }
+
+    // the engine reads straight into a heap buffer whose lifetime is tied to
+    // the returned array through the capsule
+    std::unique_ptr<std::vector<T>> buffer(
+        new std::vector<T>(helper::GetTotalSize(shape)));
+    T *data = buffer->data();
+    pybind11::capsule owner(buffer.get(), [](void *p) {
+        delete reinterpret_cast<std::vector<T> *>(p);
+    });
+    buffer.release();
+
+    m_Engine->Get(variable, data, launch);
+    return pybind11::array_t<T>(shape, data, owner);
+}
+
 Engine::operator bool() const noexcept
 {
     if (m_Engine == nullptr)
@@ -146,37 +220,192 @@ void Engine::Get(Variable variable, pybind11::array &array, const Mode launch)
     }
 }
 
-std::string Engine::Get(Variable variable, const Mode launch)
+void Engine::Get(Variable variable, pybind11::buffer &buffer, const Mode launch)
 {
-    std::string string;
     helper::CheckForNullptr(m_Engine,
-                            "for engine, in call to Engine::Get a numpy array");
+                            "for engine, in call to Engine::Get a buffer");
+    helper::CheckForNullptr(variable.m_VariableBase,
+                            "for variable, in call to Engine::Get a buffer");
+
+    // request a writable, C-contiguous view, fails for read-only buffers
+    const pybind11::buffer_info info =
+        buffer.request(true);
+    ssize_t stride = info.itemsize;
+    for (ssize_t d = info.ndim - 1; d >= 0; --d)
+    {
+        if (info.strides[d] != stride)
+        {
+            throw std::invalid_argument(
+                "ERROR: buffer for variable " + variable.Name() +
+                " is not C-contiguous, in call to Get\n");
+        }
+        stride *= info.shape[d];
+    }
+
+    const adios2::DataType type =
+        helper::GetDataTypeFromString(variable.Type());
+
+    if (type == adios2::DataType::Struct)
+    {
+        // not supported
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        core::Variable<T> &coreVariable =                                      \
+            *dynamic_cast<core::Variable<T> *>(variable.m_VariableBase);       \
+        if (!pybind11::detail::compare_buffer_info<T>::compare(info))          \
+        {                                                                      \
+            throw std::invalid_argument(                                       \
+                "ERROR: buffer item format " + info.format +                   \
+                " does not match type " + variable.Type() + " of variable " +  \
+                variable.Name() + ", in call to Get\n");                       \
+        }                                                                      \
+        if (static_cast<size_t>(info.size) < coreVariable.SelectionSize())    \
+        {                                                                      \
+            throw std::invalid_argument(                                       \
+                "ERROR: buffer of " + std::to_string(info.size) +              \
+                " elements is too small for the selection of " +               \
+                std::to_string(coreVariable.SelectionSize()) +                 \
+                " elements of variable " + variable.Name() +                   \
+                ", in call to Get\n");                                         \
+        }                                                                      \
+        m_Engine->Get(coreVariable, reinterpret_cast<T *>(info.ptr), launch);  \
+    }
+    ADIOS2_FOREACH_NUMPY_TYPE_1ARG(declare_type)
+#undef declare_type
+    else
+    {
+        throw std::invalid_argument("ERROR: variable " + variable.Name() +
+                                    " of type " + variable.Type() +
+                                    " can't be read into a buffer, in call "
+                                    "to Get\n");
+    }
+}
+
+pybind11::object Engine::Get(Variable variable, const Mode launch)
+{
+    helper::CheckForNullptr(m_Engine, "for engine, in call to Engine::Get");
     helper::CheckForNullptr(variable.m_VariableBase,
-                            "for variable, in call to Engine::Get a string");
+                            "for variable, in call to Engine::Get");
 
     const adios2::DataType type =
         helper::GetDataTypeFromString(variable.Type());
 
     if (type == helper::GetDataType<std::string>())
     {
+        std::string string;
         m_Engine->Get(*dynamic_cast<core::Variable<std::string> *>(
                           variable.m_VariableBase),
-                      string, launch);
+                      string, Mode::Sync);
+        return pybind11::str(string);
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        return DoGetArray(                                                     \
+            *dynamic_cast<core::Variable<T> *>(variable.m_VariableBase),       \
+            launch);                                                           \
     }
+    ADIOS2_FOREACH_NUMPY_TYPE_1ARG(declare_type)
+#undef declare_type
     else
     {
         throw std::invalid_argument("ERROR: variable " + variable.Name() +
                                     " of type " + variable.Type() +
-                                    " is not string, in call to Engine::Get");
+                                    " is not supported, in call to "
+                                    "Engine::Get");
     }
-    return string;
 }
+
+std::vector<pybind11::object> Engine::Get(std::vector<Variable> variables)
+{
+    helper::CheckForNullptr(m_Engine,
+                            "for engine, in call to Engine::Get variables");
+
+    std::vector<pybind11::object> arrays;
+    arrays.reserve(variables.size());
+    // strings are read into stable storage and converted after PerformGets
+    std::vector<std::string> strings(variables.size());
+
+    for (size_t i = 0; i < variables.size(); ++i)
+    {
+        Variable &variable = variables[i];
+        helper::CheckForNullptr(variable.m_VariableBase,
+                                "for variable, in call to Engine::Get "
+                                "variables");
+        if (helper::GetDataTypeFromString(variable.Type()) ==
+            helper::GetDataType<std::string>())
+        {
+            m_Engine->Get(*dynamic_cast<core::Variable<std::string> *>(
+                              variable.m_VariableBase),
+                          strings[i], Mode::Deferred);
+            arrays.emplace_back(pybind11::none());
+        }
+        else
+        {
+            arrays.emplace_back(Get(variable, Mode::Deferred));
+        }
+    }
+
+    m_Engine->PerformGets();
+
+    for (size_t i = 0; i < variables.size(); ++i)
+    {
+        if (arrays[i].is_none())
+        {
+            arrays[i] = pybind11::str(strings[i]);
+        }
+    }
+    return arrays;
+}
+
 void Engine::PerformGets()
 {
     helper::CheckForNullptr(m_Engine, "in call to Engine::PerformGets");
     m_Engine->PerformGets();
 }
 
+GetFuture Engine::GetAsync(Variable variable, pybind11::array &array)
+{
+    helper::CheckForNullptr(m_Engine,
+                            "for engine, in call to Engine::GetAsync");
+    helper::CheckForNullptr(variable.m_VariableBase,
+                            "for variable, in call to Engine::GetAsync");
+
+    const adios2::DataType type =
+        helper::GetDataTypeFromString(variable.Type());
+
+    if (type == adios2::DataType::Struct)
+    {
+        // not supported
+    }
+#define declare_type(T)                                                        \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        return GetFuture(                                                      \
+            m_Engine->GetAsync(                                                \
+                *dynamic_cast<core::Variable<T> *>(variable.m_VariableBase),   \
+                reinterpret_cast<T *>(const_cast<void *>(array.data()))),      \
+            array);                                                            \
+    }
+    ADIOS2_FOREACH_NUMPY_TYPE_1ARG(declare_type)
+#undef declare_type
+
+    throw std::invalid_argument(
+        "ERROR: in variable " + variable.Name() + " of type " +
+        variable.Type() +
+        ", numpy array type is 1) not supported, 2) a type mismatch or"
+        "3) is not memory contiguous "
+        ", in call to GetAsync\n");
+}
+
+GetFuture Engine::PerformGetsAsync()
+{
+    helper::CheckForNullptr(m_Engine, "in call to Engine::PerformGetsAsync");
+    return GetFuture(m_Engine->PerformGetsAsync(), pybind11::none());
+}
+
 void Engine::EndStep()
 {
     helper::CheckForNullptr(m_Engine, "for engine, in call to Engine::EndStep");
@@ -226,6 +455,13 @@ size_t Engine::Steps() const
     return m_Engine->Steps();
 }
 
+Metrics Engine::GetMetrics() const
+{
+    helper::CheckForNullptr(m_Engine,
+                            "for engine, in call to Engine::GetMetrics");
+    return m_Engine->GetMetrics();
+}
+
 void Engine::LockWriterDefinitions() const
 {
     helper::CheckForNullptr(m_Engine,
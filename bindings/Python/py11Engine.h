@@ -27,6 +27,34 @@ namespace py11
 // forward declare
 class IO; // friend
 
+/**
+ * Completion handle of asynchronous Gets. Keeps the destination array alive
+ * until the Gets complete and can be awaited from asyncio coroutines.
+ */
+class GetFuture
+{
+public:
+    GetFuture() = default;
+    GetFuture(std::shared_future<void> future, pybind11::object array);
+    ~GetFuture() = default;
+
+    explicit operator bool() const noexcept;
+
+    /** Blocks (without holding the GIL) until the Gets complete, rethrows
+     * their failure */
+    void Wait();
+
+    /** true if the Gets are complete */
+    bool Test() const;
+
+    /** Awaitable protocol: yields until complete, then stops */
+    void Next();
+
+private:
+    std::shared_future<void> m_Future;
+    pybind11::object m_Array;
+};
+
 class Engine
 {
     friend class IO;
@@ -57,10 +85,38 @@ public:
 
     void Get(Variable variable, pybind11::array &array,
              const Mode launch = Mode::Deferred);
-    std::string Get(Variable variable, const Mode launch = Mode::Deferred);
+
+    /**
+     * Reads directly into any writable, C-contiguous object exposing the
+     * Python buffer protocol (e.g. memoryview, bytearray) without an
+     * intermediate NumPy copy
+     */
+    void Get(Variable variable, pybind11::buffer &buffer,
+             const Mode launch = Mode::Deferred);
+
+    /**
+     * Returns a str for string variables, otherwise a NumPy array backed by a
+     * buffer owned by a capsule. The engine reads directly into that buffer,
+     * so with Mode::Deferred the array is populated after PerformGets/EndStep.
+     * For the inline engine the array is a view of the writer's memory and is
+     * only valid until EndStep.
+     */
+    pybind11::object Get(Variable variable,
+                         const Mode launch = Mode::Deferred);
+
+    /**
+     * Issues deferred Gets for all variables and a single PerformGets,
+     * returning one NumPy array (or str) per variable in the same order
+     */
+    std::vector<pybind11::object> Get(std::vector<Variable> variables);
 
     void PerformGets();
 
+    /** Deferred Get of a pre-allocated array followed by PerformGetsAsync */
+    GetFuture GetAsync(Variable variable, pybind11::array &array);
+
+    GetFuture PerformGetsAsync();
+
     void EndStep();
 
     void Flush(const int transportIndex = -1);
@@ -72,6 +128,10 @@ public:
     std::string Name() const;
     std::string Type() const;
     size_t Steps() const;
+
+    /** Snapshot of the engine's performance counters, see
+     * core::Engine::GetMetrics */
+    Metrics GetMetrics() const;
     void LockWriterDefinitions() const;
     void LockReaderSelections() const;
 
@@ -81,6 +141,9 @@ public:
 private:
     Engine(core::Engine *engine);
     core::Engine *m_Engine = nullptr;
+
+    template <class T>
+    pybind11::array DoGetArray(core::Variable<T> &variable, const Mode launch);
 };
 
 } // end namespace py11
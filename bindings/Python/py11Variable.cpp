@@ -44,6 +44,13 @@ void Variable::SetSelection(const Box<Dims> &selection)
     m_VariableBase->SetSelection(selection);
 }
 
+void Variable::SetSelection(const Box<Dims> &selection, const Dims &stride)
+{
+    helper::CheckForNullptr(m_VariableBase,
+                            "in call to Variable::SetSelection");
+    m_VariableBase->SetSelection(selection, stride);
+}
+
 void Variable::SetStepSelection(const Box<size_t> &stepSelection)
 {
     helper::CheckForNullptr(m_VariableBase,
@@ -43,6 +43,8 @@ public:
 
     void SetSelection(const Box<Dims> &selection);
 
+    void SetSelection(const Box<Dims> &selection, const Dims &stride);
+
     void SetStepSelection(const Box<size_t> &stepSelection);
 
     size_t SelectionSize() const;
@@ -400,7 +400,14 @@ PYBIND11_MODULE(ADIOS2_PYTHON_MODULE_NAME, m)
              })
         .def("SetShape", &adios2::py11::Variable::SetShape)
         .def("SetBlockSelection", &adios2::py11::Variable::SetBlockSelection)
-        .def("SetSelection", &adios2::py11::Variable::SetSelection)
+        .def("SetSelection",
+             (void (adios2::py11::Variable::*)(
+                 const adios2::Box<adios2::Dims> &)) &
+                 adios2::py11::Variable::SetSelection)
+        .def("SetSelection",
+             (void (adios2::py11::Variable::*)(
+                 const adios2::Box<adios2::Dims> &, const adios2::Dims &)) &
+                 adios2::py11::Variable::SetSelection)
         .def("SetStepSelection", &adios2::py11::Variable::SetStepSelection)
         .def("SelectionSize", &adios2::py11::Variable::SelectionSize)
         .def("Name", &adios2::py11::Variable::Name)
@@ -435,6 +442,19 @@ PYBIND11_MODULE(ADIOS2_PYTHON_MODULE_NAME, m)
         .def("DataString", &adios2::py11::Attribute::DataString)
         .def("Data", &adios2::py11::Attribute::Data);
 
+    pybind11::class_<adios2::py11::GetFuture>(m, "GetFuture")
+        .def("__bool__",
+             [](const adios2::py11::GetFuture &future) {
+                 return future ? true : false;
+             })
+        .def("Wait", &adios2::py11::GetFuture::Wait)
+        .def("Test", &adios2::py11::GetFuture::Test)
+        .def("__await__",
+             [](pybind11::object self) { return self; })
+        .def("__iter__",
+             [](pybind11::object self) { return self; })
+        .def("__next__", &adios2::py11::GetFuture::Next);
+
     pybind11::class_<adios2::py11::Engine>(m, "Engine")
         // Python 2
         .def("__nonzero__",
@@ -485,14 +505,33 @@ PYBIND11_MODULE(ADIOS2_PYTHON_MODULE_NAME, m)
              pybind11::arg("launch") = adios2::Mode::Deferred)
 
         .def("Get",
-             (std::string(adios2::py11::Engine::*)(adios2::py11::Variable,
-                                                   const adios2::Mode launch)) &
+             (void (adios2::py11::Engine::*)(adios2::py11::Variable,
+                                             pybind11::buffer &,
+                                             const adios2::Mode launch)) &
+                 adios2::py11::Engine::Get,
+             pybind11::arg("variable"), pybind11::arg("buffer"),
+             pybind11::arg("launch") = adios2::Mode::Deferred)
+
+        .def("Get",
+             (pybind11::object(adios2::py11::Engine::*)(
+                 adios2::py11::Variable, const adios2::Mode launch)) &
                  adios2::py11::Engine::Get,
              pybind11::arg("variable"),
              pybind11::arg("launch") = adios2::Mode::Deferred)
 
+        .def("Get",
+             (std::vector<pybind11::object>(adios2::py11::Engine::*)(
+                 std::vector<adios2::py11::Variable>)) &
+                 adios2::py11::Engine::Get,
+             pybind11::arg("variables"))
+
         .def("PerformGets", &adios2::py11::Engine::PerformGets)
 
+        .def("GetAsync", &adios2::py11::Engine::GetAsync,
+             pybind11::arg("variable"), pybind11::arg("array"))
+
+        .def("PerformGetsAsync", &adios2::py11::Engine::PerformGetsAsync)
+
         .def("EndStep", &adios2::py11::Engine::EndStep)
 
         .def("Flush", &adios2::py11::Engine::Flush)
@@ -507,6 +546,7 @@ PYBIND11_MODULE(ADIOS2_PYTHON_MODULE_NAME, m)
         .def("Type", &adios2::py11::Engine::Type)
 
         .def("Steps", &adios2::py11::Engine::Steps)
+        .def("GetMetrics", &adios2::py11::Engine::GetMetrics)
 
         .def("LockWriterDefinitions",
              &adios2::py11::Engine::LockWriterDefinitions)
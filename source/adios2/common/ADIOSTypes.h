@@ -211,6 +211,11 @@ struct MinBlockInfo
     size_t *Count;
     MinMaxStruct MinMax;
     void *BufferP = NULL;
+    /* Sub-block statistics: SubBlockCount min/max pairs of the variable type
+     * for the sub-blocks given by helper::DivideBlock(Count, SubBlockSize) */
+    size_t SubBlockSize = 0;
+    size_t SubBlockCount = 0;
+    const void *SubBlockMinMax = NULL;
 };
 struct MinVarInfo
 {
@@ -282,6 +287,9 @@ constexpr bool GlobalValue = false;
 
 using Dims = std::vector<size_t>;
 using Params = std::map<std::string, std::string>;
+/** Engine performance snapshot: metric name -> value, see Engine::GetMetrics
+ */
+using Metrics = std::map<std::string, double>;
 using vParams = std::vector<std::pair<std::string, Params>>;
 using Steps = size_t;
 
@@ -470,6 +478,24 @@ constexpr char blockSize100k_9[] = "9";
 } // end namespace bzip2
 #endif
 
+// Temporal PARAMETERS, always available
+constexpr char LosslessTemporal[] = "temporal";
+namespace temporal
+{
+
+namespace key
+{
+constexpr char keyframeInterval[] = "keyframeInterval";
+constexpr char backend[] = "backend";
+}
+
+namespace value
+{
+constexpr char backend_zeroruns[] = "zeroruns";
+}
+
+} // end namespace temporal
+
 // BBlosc PARAMETERS
 #ifdef ADIOS2_HAVE_BLOSC
 
@@ -63,6 +63,21 @@ size_t Engine::CurrentStep() const
 void Engine::EndStep() { ThrowUp("EndStep"); }
 void Engine::PerformPuts() { ThrowUp("PerformPuts"); }
 void Engine::PerformGets() { ThrowUp("PerformGets"); }
+
+std::shared_future<void> Engine::PerformGetsAsync()
+{
+    std::promise<void> done;
+    try
+    {
+        PerformGets();
+        done.set_value();
+    }
+    catch (...)
+    {
+        done.set_exception(std::current_exception());
+    }
+    return done.get_future().share();
+}
 void Engine::PerformDataWrite() { return; }
 
 void Engine::Close(const int transportIndex)
@@ -80,6 +95,8 @@ void Engine::Flush(const int /*transportIndex*/) { ThrowUp("Flush"); }
 
 size_t Engine::Steps() const { return DoSteps(); }
 
+Metrics Engine::GetMetrics() const { return DoGetMetrics(); }
+
 void Engine::LockWriterDefinitions() noexcept
 {
     m_WriterDefinitionsLocked = true;
@@ -279,6 +296,8 @@ size_t Engine::DoSteps() const
     return MaxSizeT;
 }
 
+Metrics Engine::DoGetMetrics() const { return Metrics(); }
+
 // PRIVATE
 void Engine::ThrowUp(const std::string function) const
 {
@@ -305,6 +324,15 @@ void Engine::CommonChecks(VariableBase &variable, const void *data,
     variable.CheckDimensions(hint);
     CheckOpenModes(modes, " for variable " + variable.m_Name + ", " + hint);
 
+    if (!variable.m_Stride.empty() && !SupportsStridedSelections())
+    {
+        helper::Throw<std::invalid_argument>(
+            "Core", "Engine", "CommonChecks",
+            "engine " + m_EngineType +
+                " does not support strided selections, variable " +
+                variable.m_Name + ", " + hint);
+    }
+
     // If no dimension has a zero count then there must be data to write.
     if (std::find(variable.m_Count.begin(), variable.m_Count.end(), 0) ==
         variable.m_Count.end())
@@ -349,6 +377,7 @@ Engine::BlocksInfoStruct(const VariableStruct &variable,
     template void Engine::Get<T>(const std::string &, T &, const Mode);        \
                                                                                \
     template void Engine::Get<T>(Variable<T> &, std::vector<T> &, const Mode); \
+    template std::shared_future<void> Engine::GetAsync<T>(Variable<T> &, T *); \
     template void Engine::Get<T>(const std::string &, std::vector<T> &,        \
                                  const Mode);                                  \
                                                                                \
@@ -17,6 +17,7 @@
 /// \cond EXCLUDE_FROM_DOXYGEN
 #include <float.h>
 #include <functional> //std::function
+#include <future>     //std::shared_future
 #include <limits.h>
 #include <limits> //std::numeric_limits
 #include <memory> //std::shared_ptr
@@ -361,6 +362,17 @@ public:
     template <class T>
     void Get(core::Variable<T> &, T **) const;
 
+    /**
+     * Queues a deferred Get and starts all Gets queued so far, see
+     * PerformGetsAsync
+     * @param variable contains metadata and selections for getting the variable
+     * @param data user pre-allocated memory space, populated once the returned
+     * future is ready
+     * @return future that becomes ready once data is populated
+     */
+    template <class T>
+    std::shared_future<void> GetAsync(Variable<T> &variable, T *data);
+
     /**
      * Reader application indicates that no more data will be read from the
      * current stream before advancing.
@@ -376,6 +388,14 @@ public:
      * PerformGets, BeginStep or Open */
     virtual void PerformGets();
 
+    /** Starts all Get (in deferred launch mode) starting from a previous
+     * PerformGets, BeginStep or Open, without waiting for them. The returned
+     * future becomes ready (or holds the exception) once their data is in
+     * place. Data of asynchronous Gets must not be used before then, and
+     * EndStep, PerformGets and Close wait for them. Engines that cannot read
+     * in the background complete the Gets before returning. */
+    virtual std::shared_future<void> PerformGetsAsync();
+
     /** Write array data to disk.  This may relieve memory pressure by clearing
      * ADIOS buffers.  It is a collective call. */
     virtual void PerformDataWrite();
@@ -457,6 +477,14 @@ public:
 
     size_t Steps() const;
 
+    /**
+     * Snapshot of the engine's performance counters, e.g. bytes written,
+     * time spent in EndStep or queued steps. Names and units are engine
+     * specific and the unit is part of the name (_bytes, _us, _seconds).
+     * @return metrics of this process, empty if the engine has none
+     */
+    Metrics GetMetrics() const;
+
     /**
      * @brief Promise that no more definitions or changes to defined variables
      * will occur. Useful information if called before the first EndStep() of an
@@ -496,6 +524,9 @@ public:
         return false;
     }
 
+    /** true if Get honours VariableBase::m_Stride */
+    virtual bool SupportsStridedSelections() const noexcept { return false; }
+
     /** Notify the engine when a new attribute is defined. Called from IO.tcc
      */
     virtual void NotifyEngineAttribute(std::string name,
@@ -607,6 +638,8 @@ protected:
 
     virtual size_t DoSteps() const;
 
+    virtual Metrics DoGetMetrics() const;
+
     virtual void DoGetAbsoluteSteps(const VariableBase &variable,
                                     std::vector<size_t> &keys) const;
 
@@ -111,6 +111,13 @@ void Engine::Get(Variable<T> &variable, T *data, const Mode launch)
     }
 }
 
+template <class T>
+std::shared_future<void> Engine::GetAsync(Variable<T> &variable, T *data)
+{
+    Get(variable, data, Mode::Deferred);
+    return PerformGetsAsync();
+}
+
 template <class T>
 void Engine::Get(const std::string &variableName, T *data, const Mode launch)
 {
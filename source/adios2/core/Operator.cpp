@@ -51,6 +51,26 @@ void Operator::RunCallback2(void *arg0, const std::string &arg1,
     CheckCallbackType("Callback2");
 }
 
+Operator::ReferenceInfo
+Operator::GetReferenceInfo(const char * /*bufferIn*/,
+                           const size_t /*sizeIn*/) const
+{
+    return ReferenceInfo();
+}
+
+size_t Operator::InverseOperateFrom(const char *bufferIn, const size_t sizeIn,
+                                    const char *reference, char *dataOut)
+{
+    if (reference != nullptr)
+    {
+        helper::Throw<std::invalid_argument>(
+            "Core", "Operator", "InverseOperateFrom",
+            "operator " + m_TypeString +
+                " does not decode relative to a reference block");
+    }
+    return InverseOperate(bufferIn, sizeIn, dataOut);
+}
+
 // PROTECTED
 
 Dims Operator::ConvertDims(const Dims &dimensions, const DataType type,
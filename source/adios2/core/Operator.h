@@ -37,6 +37,7 @@ public:
         COMPRESS_SZ = 6,
         COMPRESS_ZFP = 7,
         COMPRESS_MGARDPLUS = 8,
+        COMPRESS_TEMPORAL = 9,
         CALLBACK_SIGNATURE1 = 51,
         CALLBACK_SIGNATURE2 = 52,
         PLUGIN_INTERFACE = 53,
@@ -92,6 +93,41 @@ public:
 
     virtual bool IsDataTypeValid(const DataType type) const = 0;
 
+    /**
+     * Position of an operated buffer in the sequence of versions of one
+     * block kept by a stateful operator (Versioned). Generation counts the
+     * versions of the block, Distance is how many versions back the nearest
+     * keyframe is, 0 if the buffer decodes on its own.
+     */
+    struct ReferenceInfo
+    {
+        bool Versioned = false;
+        size_t Generation = 0;
+        size_t Distance = 0;
+    };
+
+    /**
+     * Stateful operators encode a block relative to the previous version of
+     * the same block, default: every buffer decodes on its own
+     * @param bufferIn
+     * @param sizeIn
+     * @return generation and keyframe distance of bufferIn
+     */
+    virtual ReferenceInfo GetReferenceInfo(const char *bufferIn,
+                                           const size_t sizeIn) const;
+
+    /**
+     * Decodes a buffer with Distance > 0 given the decoded previous
+     * version of the block (Generation - 1)
+     * @param bufferIn
+     * @param sizeIn
+     * @param reference decoded previous version, nullptr for a keyframe
+     * @param dataOut
+     * @return size of decompressed buffer
+     */
+    virtual size_t InverseOperateFrom(const char *bufferIn, const size_t sizeIn,
+                                      const char *reference, char *dataOut);
+
 protected:
     /** Parameters associated with a particular Operator */
     Params m_Parameters;
@@ -97,6 +97,12 @@ namespace core
     }                                                                          \
                                                                                \
     template <>                                                                \
+    void Variable<T>::SetValueFilter(const T &min, const T &max)               \
+    {                                                                          \
+        DoSetValueFilter(min, max);                                            \
+    }                                                                          \
+                                                                               \
+    template <>                                                                \
     std::vector<std::vector<typename Variable<T>::BPInfo>>                     \
     Variable<T>::AllStepsBlocksInfo() const                                    \
     {                                                                          \
@@ -115,6 +115,14 @@ public:
 
     T Max(const size_t step = adios2::DefaultSizeT) const;
 
+    /**
+     * Reader-side predicate pushdown: Get may skip sub-blocks whose recorded
+     * min/max cannot overlap [min, max]. Elements of skipped sub-blocks are
+     * left untouched in the destination. Ignored by engines without
+     * sub-block statistics.
+     */
+    void SetValueFilter(const T &min, const T &max);
+
     std::vector<std::vector<typename Variable<T>::BPInfo>>
     AllStepsBlocksInfo() const;
 
@@ -125,6 +133,8 @@ private:
 
     std::pair<T, T> DoMinMax(const size_t step) const;
 
+    void DoSetValueFilter(const T &min, const T &max);
+
     std::vector<std::vector<typename Variable<T>::BPInfo>>
     DoAllStepsBlocksInfo() const;
 
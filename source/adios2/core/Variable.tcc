@@ -182,6 +182,29 @@ std::pair<T, T> Variable<T>::DoMinMax(const size_t step) const
     return minMax;
 }
 
+template <class T>
+void Variable<T>::DoSetValueFilter(const T &min, const T &max)
+{
+    if (!std::is_arithmetic<T>::value)
+    {
+        helper::Throw<std::invalid_argument>(
+            "Core", "Variable", "DoSetValueFilter",
+            "value filters are only supported for integer and floating point "
+            "variables, variable " +
+                m_Name + " is of type " + ToString(m_Type));
+    }
+    if (helper::GreaterThan<T>(min, max))
+    {
+        helper::Throw<std::invalid_argument>(
+            "Core", "Variable", "DoSetValueFilter",
+            "min is greater than max for variable " + m_Name);
+    }
+    m_ValueFilter.Init(m_Type);
+    *(T *)&m_ValueFilter.MinUnion = min;
+    *(T *)&m_ValueFilter.MaxUnion = max;
+    m_HasValueFilter = true;
+}
+
 template <class T>
 std::vector<std::vector<typename Variable<T>::BPInfo>>
 Variable<T>::DoAllStepsBlocksInfo() const
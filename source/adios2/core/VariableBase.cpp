@@ -112,6 +112,7 @@ void VariableBase::SetBlockSelection(const size_t blockID)
 {
     m_BlockID = blockID;
     m_SelectionType = SelectionType::WriteBlock;
+    m_Stride.clear();
 }
 
 void VariableBase::SetSelection(const Box<Dims> &boxDims)
@@ -167,8 +168,60 @@ void VariableBase::SetSelection(const Box<Dims> &boxDims)
     m_Start = start;
     m_Count = count;
     m_SelectionType = SelectionType::BoundingBox;
+    m_Stride.clear();
 }
 
+void VariableBase::SetSelection(const Box<Dims> &boxDims, const Dims &stride)
+{
+    const Dims &start = boxDims.first;
+    const Dims &count = boxDims.second;
+
+    if (m_ShapeID != ShapeID::GlobalArray || m_SingleValue)
+    {
+        helper::Throw<std::invalid_argument>(
+            "Core", "VariableBase", "SetSelection",
+            "strided selection is only valid for global array variables, "
+            "variable " +
+                m_Name + ", in call to SetSelection");
+    }
+    if (stride.size() != count.size())
+    {
+        helper::Throw<std::invalid_argument>(
+            "Core", "VariableBase", "SetSelection",
+            "stride must be the same size as count for variable " + m_Name +
+                ", in call to SetSelection");
+    }
+    for (size_t d = 0; d < stride.size(); ++d)
+    {
+        if (stride[d] == 0)
+        {
+            helper::Throw<std::invalid_argument>(
+                "Core", "VariableBase", "SetSelection",
+                "stride must be positive in every dimension for variable " +
+                    m_Name + ", in call to SetSelection");
+        }
+        if (count[d] > 0 && start.size() == stride.size() &&
+            m_Shape.size() == stride.size() &&
+            start[d] + (count[d] - 1) * stride[d] >= m_Shape[d])
+        {
+            helper::Throw<std::invalid_argument>(
+                "Core", "VariableBase", "SetSelection",
+                "strided selection extends beyond shape in dimension " +
+                    std::to_string(d) + " for variable " + m_Name +
+                    ", in call to SetSelection");
+        }
+    }
+
+    SetSelection(boxDims);
+    if (std::any_of(stride.begin(), stride.end(),
+                    [](const size_t s) { return s > 1; }))
+    {
+        m_Stride = stride;
+    }
+}
+
+void VariableBase::RemoveValueFilter() noexcept { m_HasValueFilter = false; }
+
 void VariableBase::SetMemorySelection(const Box<Dims> &memorySelection)
 {
     const Dims &memoryStart = memorySelection.first;
@@ -68,6 +68,15 @@ public:
     Dims m_MemoryStart; ///< start offset
     Dims m_MemoryCount; ///< local dimensions
 
+    /** Reader-side stride per dimension, empty for a contiguous selection.
+     * m_Count is then the number of selected elements per dimension. */
+    Dims m_Stride;
+
+    /** Reader-side predicate: engines with sub-block statistics may skip
+     * sub-blocks whose min/max cannot overlap the filter's [min, max] */
+    bool m_HasValueFilter = false;
+    MinMaxStruct m_ValueFilter;
+
     /** Global array was written as Joined array, so read accordingly */
     bool m_ReadAsJoined = false;
 
@@ -150,6 +159,14 @@ public:
      */
     void SetSelection(const Box<Dims> &boxDims);
 
+    /**
+     * Set a strided (decimated) selection, reading at read only
+     * @param boxDims = {start, count}, count is the number of selected
+     * elements in each dimension
+     * @param stride distance between selected elements in each dimension
+     */
+    void SetSelection(const Box<Dims> &boxDims, const Dims &stride);
+
     /**
      * Set the steps for the variable. The pointer passed at
      * reading must be able to hold enough memory to store multiple steps in a
@@ -163,6 +180,11 @@ public:
      */
     void SetMemorySelection(const Box<Dims> &memorySelection);
 
+    /**
+     * Removes a value filter set with Variable<T>::SetValueFilter
+     */
+    void RemoveValueFilter() noexcept;
+
     size_t GetAvailableStepsStart() const;
 
     size_t GetAvailableStepsCount() const;
@@ -30,6 +30,9 @@ namespace engine
  */
 constexpr size_t DefaultStatsBlockSize = 1125899906842624ULL;
 
+/** largest bounce buffer of a DirectIO read, larger reads go in pieces */
+constexpr size_t DefaultDirectIOBounceSize = 16 * 1024 * 1024;
+
 class BP5Engine
 {
 public:
@@ -40,6 +43,7 @@ public:
             2: flush count
             3: pos in index where data offsets are enumerated
             4: abs. pos in metadata File for step
+            5: uncompressed size of metadata, 0 if not compressed
     */
     std::unordered_map<uint64_t, std::vector<uint64_t>> m_MetadataIndexTable;
 
@@ -73,6 +77,9 @@ public:
     {
         StepRecord = 's',
         WriterMapRecord = 'w',
+        /** StepRecord of a step whose metadata is compressed, with the
+         * uncompressed metadata size after MetadataSize */
+        CompressedStepRecord = 'c',
     };
 
     std::vector<std::string>
@@ -153,12 +160,21 @@ public:
     MACRO(MinDeferredSize, SizeBytes, size_t, DefaultMinDeferredSize)          \
     MACRO(BufferChunkSize, SizeBytes, size_t, DefaultBufferChunkSize)          \
     MACRO(MaxShmSize, SizeBytes, size_t, DefaultMaxShmSize)                    \
+    MACRO(ShmSlots, UInt, unsigned int, 4)                                     \
+    MACRO(ShmSlotSize, SizeBytes, size_t, 0)                                   \
     MACRO(BufferVType, BufferVType, int, (int)BufferVType::ChunkVType)         \
     MACRO(AppendAfterSteps, Int, int, INT_MAX)                                 \
     MACRO(SelectSteps, String, std::string, "")                                \
     MACRO(ReaderShortCircuitReads, Bool, bool, false)                          \
     MACRO(StatsLevel, UInt, unsigned int, 1)                                   \
-    MACRO(StatsBlockSize, SizeBytes, size_t, DefaultStatsBlockSize)
+    MACRO(StatsBlockSize, SizeBytes, size_t, DefaultStatsBlockSize)            \
+    MACRO(SieveThreshold, SizeBytes, size_t, 4096)                             \
+    MACRO(ReadCacheSize, SizeBytes, size_t, 0)                                 \
+    MACRO(PrefetchSize, SizeBytes, size_t, 0)                                  \
+    MACRO(DeduplicateBlocks, Bool, bool, false)                                \
+    MACRO(MetadataCompression, String, std::string, "none")                    \
+    MACRO(ProfileTrace, Bool, bool, false)                                     \
+    MACRO(ProfileTraceEvents, UInt, unsigned int, 65536)
 
     struct BP5Params
     {
@@ -9,9 +9,14 @@
 #include "BP5Reader.h"
 #include "BP5Reader.tcc"
 
+#include "adios2/operator/OperatorFactory.h"
+
 #include <adios2-perfstubs-interface.h>
 
+#include <algorithm>
+#include <cstring>
 #include <errno.h>
+#include <iostream>
 
 namespace adios2
 {
@@ -32,6 +37,7 @@ BP5Reader::BP5Reader(IO &io, const std::string &name, const Mode mode,
 
 BP5Reader::~BP5Reader()
 {
+    StopAsyncGetThread();
     if (m_BP5Deserializer)
         delete m_BP5Deserializer;
 }
@@ -39,6 +45,27 @@ BP5Reader::~BP5Reader()
 void BP5Reader::InstallMetadataForTimestep(size_t Step)
 {
     size_t pgstart = m_MetadataIndexTable[Step][0];
+    std::vector<char> *MDBuffer = &m_Metadata.m_Buffer;
+    const uint64_t RawSize = m_MetadataIndexTable[Step][5];
+    if (RawSize)
+    {
+        // compressed metadata chunk, decompress on first use
+        if (m_OpenMode != Mode::ReadRandomAccess)
+        {
+            // only the current step is needed when streaming
+            m_DecompressedMetadata.clear();
+        }
+        std::vector<char> &Raw = m_DecompressedMetadata[Step];
+        if (Raw.size() != RawSize)
+        {
+            Raw.resize(RawSize);
+            core::Decompress(m_Metadata.m_Buffer.data() + pgstart,
+                             m_MetadataIndexTable[Step][1], Raw.data());
+        }
+        MDBuffer = &Raw;
+        pgstart = 0;
+    }
+    std::vector<char> &Metadata = *MDBuffer;
     size_t Position = pgstart + sizeof(uint64_t); // skip total data size
     const uint64_t WriterCount =
         m_WriterMap[m_WriterMapIndex[Step]].WriterCount;
@@ -47,8 +74,8 @@ void BP5Reader::InstallMetadataForTimestep(size_t Step)
     {
         // variable metadata for timestep
         size_t ThisMDSize = helper::ReadValue<uint64_t>(
-            m_Metadata.m_Buffer, Position, m_Minifooter.IsLittleEndian);
-        char *ThisMD = m_Metadata.m_Buffer.data() + MDPosition;
+            Metadata, Position, m_Minifooter.IsLittleEndian);
+        char *ThisMD = Metadata.data() + MDPosition;
         if (m_OpenMode == Mode::ReadRandomAccess)
         {
             m_BP5Deserializer->InstallMetaData(ThisMD, ThisMDSize, WriterRank,
@@ -64,8 +91,8 @@ void BP5Reader::InstallMetadataForTimestep(size_t Step)
     {
         // attribute metadata for timestep
         size_t ThisADSize = helper::ReadValue<uint64_t>(
-            m_Metadata.m_Buffer, Position, m_Minifooter.IsLittleEndian);
-        char *ThisAD = m_Metadata.m_Buffer.data() + MDPosition;
+            Metadata, Position, m_Minifooter.IsLittleEndian);
+        char *ThisAD = Metadata.data() + MDPosition;
         if (ThisADSize > 0)
             m_BP5Deserializer->InstallAttributeData(ThisAD, ThisADSize);
         MDPosition += ThisADSize;
@@ -97,6 +124,9 @@ StepStatus BP5Reader::BeginStep(StepMode mode, const float timeoutSeconds)
             "BP5Reader, in call to BeginStep");
     }
 
+    WaitForAsyncGets();
+    WaitForPrefetch();
+
     StepStatus status = StepStatus::OK;
     if (m_FirstStep)
     {
@@ -149,6 +179,11 @@ StepStatus BP5Reader::BeginStep(StepMode mode, const float timeoutSeconds)
         // m_IO.RemoveAllVariables();
 
         InstallMetadataForTimestep(m_CurrentStep);
+        if (m_Parameters.PrefetchSize > 0 && m_PrefetchStep != m_CurrentStep)
+        {
+            // nothing staged for this step, overlap with the Get calls
+            StartPrefetch(m_CurrentStep);
+        }
         m_IO.ResetVariablesStepSelection(false,
                                          "in call to BP5 Reader BeginStep");
 
@@ -179,14 +214,107 @@ void BP5Reader::EndStep()
     m_BetweenStepPairs = false;
     PERFSTUBS_SCOPED_TIMER("BP5Reader::EndStep");
     PerformGets();
+
+    if (m_Parameters.PrefetchSize > 0)
+    {
+        m_PrefetchPattern = std::move(m_StepReads);
+        m_StepReads.clear();
+        if (m_CurrentStep + 1 < m_StepsCount)
+        {
+            // the next step's index is in memory, read ahead until BeginStep
+            StartPrefetch(m_CurrentStep + 1);
+        }
+    }
 }
 
-void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
-                         const size_t StartOffset, const size_t Length,
-                         char *Destination)
+void BP5Reader::StartPrefetch(const size_t Step)
+{
+    m_PrefetchIndex.clear();
+    m_PrefetchBuffer.clear();
+    m_PrefetchStep = SIZE_MAX;
+    if (m_PrefetchPattern.empty())
+    {
+        return;
+    }
+    m_PrefetchStep = Step;
+    m_PrefetchFuture = std::async(std::launch::async,
+                                  &BP5Reader::PrefetchThread, this, Step);
+}
+
+void BP5Reader::PrefetchThread(const size_t Step)
+{
+    const uint64_t WriterCount =
+        m_WriterMap[m_WriterMapIndex[Step]].WriterCount;
+    std::vector<PrefetchRange> Ranges;
+    size_t Total = 0;
+    for (const auto &R : m_PrefetchPattern)
+    {
+        if (R.WriterRank >= WriterCount ||
+            Total + R.Length > m_Parameters.PrefetchSize)
+        {
+            continue;
+        }
+        Ranges.push_back(R);
+        Total += R.Length;
+    }
+    m_PrefetchBuffer.resize(Total);
+
+    size_t Pos = 0;
+    for (const auto &R : Ranges)
+    {
+        try
+        {
+            ReadData(R.WriterRank, Step, R.StartOffset, R.Length,
+                     m_PrefetchBuffer.data() + Pos);
+            m_PrefetchIndex[{R.WriterRank, R.StartOffset}] = {R.Length, Pos};
+            m_PrefetchReadBytes += R.Length;
+        }
+        catch (std::exception &)
+        {
+            // the guess may lie past this step's data, leave it unstaged
+        }
+        Pos += R.Length;
+    }
+}
+
+void BP5Reader::WaitForPrefetch()
+{
+    if (m_PrefetchFuture.valid())
+    {
+        m_PrefetchFuture.get();
+    }
+}
+
+bool BP5Reader::ReadPrefetched(const format::BP5Deserializer::ReadRequest &Req)
+{
+    if (Req.Timestep != m_PrefetchStep || m_PrefetchIndex.empty())
+    {
+        return false;
+    }
+    auto it = m_PrefetchIndex.upper_bound({Req.WriterRank, Req.StartOffset});
+    if (it == m_PrefetchIndex.begin())
+    {
+        return false;
+    }
+    --it;
+    const size_t RangeStart = it->first.second;
+    const size_t RangeLength = it->second.first;
+    if (it->first.first != Req.WriterRank ||
+        Req.StartOffset + Req.ReadLength > RangeStart + RangeLength)
+    {
+        return false;
+    }
+    std::memcpy(Req.DestinationAddr,
+                m_PrefetchBuffer.data() + it->second.second +
+                    (Req.StartOffset - RangeStart),
+                Req.ReadLength);
+    m_PrefetchUsedBytes += Req.ReadLength;
+    return true;
+}
+
+size_t BP5Reader::OpenDataSubfile(const size_t WriterRank,
+                                  const size_t Timestep)
 {
-    size_t FlushCount = m_MetadataIndexTable[Timestep][2];
-    size_t DataPosPos = m_MetadataIndexTable[Timestep][3];
     size_t SubfileNum = static_cast<size_t>(
         m_WriterMap[m_WriterMapIndex[Timestep]].RankToSubfile[WriterRank]);
 
@@ -196,9 +324,63 @@ void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
         const std::string subFileName = GetBPSubStreamName(
             m_Name, SubfileNum, m_Minifooter.HasSubFiles, true);
 
+        // the first file transport the user added also applies to data
+        Params transportParams = {{"transport", "File"}};
+        if (!m_IO.m_TransportsParameters.empty())
+        {
+            transportParams = m_IO.m_TransportsParameters[0];
+        }
+        if (m_Parameters.DirectIO)
+        {
+            transportParams["DirectIO"] = "true";
+        }
         m_DataFileManager.OpenFileID(subFileName, SubfileNum, Mode::Read,
-                                     {{"transport", "File"}}, false);
+                                     transportParams, false);
+    }
+    return SubfileNum;
+}
+
+bool BP5Reader::DataFileRange(const size_t WriterRank, const size_t Timestep,
+                              const size_t StartOffset, size_t &SubfileNum,
+                              size_t &FilePos)
+{
+    if (StartOffset & format::BP5Base::DataLocationInFile)
+    {
+        FilePos = StartOffset & ~format::BP5Base::DataLocationInFile;
+        SubfileNum = OpenDataSubfile(WriterRank, Timestep);
+        return true;
     }
+    const size_t FlushCount = m_MetadataIndexTable[Timestep][2];
+    if (FlushCount > 0)
+    {
+        // data written in several flushes is not one contiguous range
+        return false;
+    }
+    size_t DataPosPos = m_MetadataIndexTable[Timestep][3] +
+                        WriterRank * sizeof(uint64_t);
+    FilePos = helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer,
+                                          DataPosPos,
+                                          m_Minifooter.IsLittleEndian) +
+              StartOffset;
+    SubfileNum = OpenDataSubfile(WriterRank, Timestep);
+    return true;
+}
+
+void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
+                         const size_t StartOffset, const size_t Length,
+                         char *Destination)
+{
+    size_t SubfileNum = OpenDataSubfile(WriterRank, Timestep);
+    if (StartOffset & format::BP5Base::DataLocationInFile)
+    {
+        // deduplicated block, stored by an earlier step of the same writer
+        ReadDataFile(Destination, Length,
+                     StartOffset & ~format::BP5Base::DataLocationInFile,
+                     SubfileNum);
+        return;
+    }
+    size_t FlushCount = m_MetadataIndexTable[Timestep][2];
+    size_t DataPosPos = m_MetadataIndexTable[Timestep][3];
 
     size_t InfoStartPos =
         DataPosPos + (WriterRank * (2 * FlushCount + 1) * sizeof(uint64_t));
@@ -215,10 +397,17 @@ void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
         size_t ThisDataSize =
             helper::ReadValue<uint64_t>(m_MetadataIndex.m_Buffer, ThisFlushInfo,
                                         m_Minifooter.IsLittleEndian);
+        if (Offset >= ThisDataSize)
+        {
+            // starts in a later flush
+            Offset -= ThisDataSize;
+            continue;
+        }
+        ThisDataSize -= Offset;
         if (ThisDataSize > RemainingLength)
             ThisDataSize = RemainingLength;
-        m_DataFileManager.ReadFile(Destination, ThisDataSize,
-                                   ThisDataPos + Offset, SubfileNum);
+        ReadDataFile(Destination, ThisDataSize, ThisDataPos + Offset,
+                     SubfileNum);
         Destination += ThisDataSize;
         RemainingLength -= ThisDataSize;
         Offset = 0;
@@ -227,22 +416,241 @@ void BP5Reader::ReadData(const size_t WriterRank, const size_t Timestep,
     }
     ThisDataPos = helper::ReadValue<uint64_t>(
         m_MetadataIndex.m_Buffer, ThisFlushInfo, m_Minifooter.IsLittleEndian);
-    m_DataFileManager.ReadFile(Destination, RemainingLength,
-                               ThisDataPos + Offset, SubfileNum);
+    ReadDataFile(Destination, RemainingLength, ThisDataPos + Offset,
+                 SubfileNum);
+}
+
+void BP5Reader::ReadDataFile(char *Destination, const size_t Length,
+                             const size_t FilePos, const size_t SubfileNum)
+{
+    if (!m_Parameters.DirectIO || !Length)
+    {
+        m_DataFileManager.ReadFile(Destination, Length, FilePos, SubfileNum);
+        return;
+    }
+    const size_t Align = m_Parameters.DirectIOAlignOffset;
+    const size_t MemAlign = m_Parameters.DirectIOAlignBuffer;
+    auto lf_IsMemAligned = [&](const char *p) -> bool {
+        return reinterpret_cast<uintptr_t>(p) % MemAlign == 0;
+    };
+
+    // [Begin, End) is the aligned part of the read in the file
+    const size_t Begin =
+        FilePos + helper::PaddingToAlignOffset(FilePos, Align);
+    const size_t End = (FilePos + Length) / Align * Align;
+    size_t HeadLength = Length;
+    if (Begin < End && lf_IsMemAligned(Destination + (Begin - FilePos)))
+    {
+        // whole aligned blocks go straight into the destination
+        HeadLength = Begin - FilePos;
+        m_DataFileManager.ReadFile(Destination + HeadLength, End - Begin,
+                                   Begin, SubfileNum);
+        const size_t TailLength = FilePos + Length - End;
+        if (TailLength)
+        {
+            ReadDataFile(Destination + (End - FilePos), TailLength, End,
+                         SubfileNum);
+        }
+        if (!HeadLength)
+        {
+            return;
+        }
+    }
+
+    // the rest goes through an aligned bounce buffer, in pieces
+    const size_t MaxPiece =
+        std::max(DefaultDirectIOBounceSize / Align, size_t(1)) * Align;
+    std::vector<char> Bounce = AcquireDirectIOBuffer(
+        std::min(HeadLength + 2 * Align, MaxPiece) + MemAlign);
+    char *Aligned = Bounce.data() +
+                    helper::PaddingToAlignOffset(
+                        reinterpret_cast<uintptr_t>(Bounce.data()), MemAlign);
+    size_t Done = 0;
+    while (Done < HeadLength)
+    {
+        const size_t Pos = FilePos + Done;
+        const size_t PieceStart = Pos / Align * Align;
+        size_t PieceEnd = Pos + (HeadLength - Done);
+        PieceEnd += helper::PaddingToAlignOffset(PieceEnd, Align);
+        if (PieceEnd - PieceStart > MaxPiece)
+        {
+            PieceEnd = PieceStart + MaxPiece;
+        }
+        // the last block may reach beyond the end of file, the transport
+        // stops there and only bytes inside the file are copied out
+        m_DataFileManager.ReadFile(Aligned, PieceEnd - PieceStart,
+                                   PieceStart, SubfileNum);
+        size_t n = PieceEnd - Pos;
+        if (n > HeadLength - Done)
+        {
+            n = HeadLength - Done;
+        }
+        std::memcpy(Destination + Done, Aligned + (Pos - PieceStart), n);
+        Done += n;
+    }
+    ReleaseDirectIOBuffer(std::move(Bounce));
+}
+
+std::vector<char> BP5Reader::AcquireDirectIOBuffer(const size_t Size)
+{
+    std::vector<char> Buffer;
+    {
+        std::lock_guard<std::mutex> lock(m_DirectIOPoolMutex);
+        if (!m_DirectIOPool.empty())
+        {
+            Buffer = std::move(m_DirectIOPool.back());
+            m_DirectIOPool.pop_back();
+        }
+    }
+    if (Buffer.size() < Size)
+    {
+        Buffer.resize(Size);
+    }
+    return Buffer;
+}
+
+void BP5Reader::ReleaseDirectIOBuffer(std::vector<char> &&Buffer)
+{
+    std::lock_guard<std::mutex> lock(m_DirectIOPoolMutex);
+    // one buffer per thread that reads at the same time is plenty
+    if (m_DirectIOPool.size() < 4)
+    {
+        m_DirectIOPool.push_back(std::move(Buffer));
+    }
 }
 
 void BP5Reader::PerformGets()
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformGets");
+    WaitForAsyncGets();
+    WaitForPrefetch();
     auto ReadRequests = m_BP5Deserializer->GenerateReadRequests();
+    ReadRequestedData(ReadRequests);
+    m_BP5Deserializer->FinalizeGets(ReadRequests);
+}
+
+std::shared_future<void> BP5Reader::PerformGetsAsync()
+{
+    PERFSTUBS_SCOPED_TIMER("BP5Reader::PerformGetsAsync");
+    WaitForPrefetch();
+    AsyncGetBatch Batch;
+    Batch.Reads = m_BP5Deserializer->GenerateReadRequests();
+    Batch.Requests = m_BP5Deserializer->DetachPendingRequests();
+    std::shared_future<void> Done = Batch.Done.get_future().share();
+
+    std::lock_guard<std::mutex> lock(m_AsyncGetMutex);
+    if (!m_AsyncGetThread.joinable())
+    {
+        m_AsyncGetStop = false;
+        m_AsyncGetThread = std::thread(&BP5Reader::AsyncGetThread, this);
+    }
+    m_AsyncGetQueue.push_back(std::move(Batch));
+    ++m_AsyncGetsPending;
+    m_AsyncGetCV.notify_all();
+    return Done;
+}
+
+void BP5Reader::AsyncGetThread()
+{
+    std::unique_lock<std::mutex> lock(m_AsyncGetMutex);
+    while (true)
+    {
+        m_AsyncGetCV.wait(lock, [this] {
+            return m_AsyncGetStop || !m_AsyncGetQueue.empty();
+        });
+        if (m_AsyncGetQueue.empty())
+        {
+            return;
+        }
+        AsyncGetBatch Batch = std::move(m_AsyncGetQueue.front());
+        m_AsyncGetQueue.pop_front();
+        lock.unlock();
+        try
+        {
+            ReadRequestedData(Batch.Reads);
+            m_BP5Deserializer->FinalizeGets(Batch.Reads, Batch.Requests);
+            Batch.Done.set_value();
+        }
+        catch (...)
+        {
+            Batch.Done.set_exception(std::current_exception());
+        }
+        lock.lock();
+        --m_AsyncGetsPending;
+        m_AsyncGetCV.notify_all();
+    }
+}
+
+void BP5Reader::WaitForAsyncGets()
+{
+    std::unique_lock<std::mutex> lock(m_AsyncGetMutex);
+    m_AsyncGetCV.wait(lock, [this] { return m_AsyncGetsPending == 0; });
+}
+
+void BP5Reader::StopAsyncGetThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_AsyncGetMutex);
+        m_AsyncGetStop = true;
+        m_AsyncGetCV.notify_all();
+    }
+    if (m_AsyncGetThread.joinable())
+    {
+        m_AsyncGetThread.join();
+    }
+}
+
+void BP5Reader::ReadRequestedData(
+    std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests)
+{
+    // with a mapping file transport, hint the whole read plan first and
+    // then let the deserializer copy straight out of the mapped file
+    std::vector<std::pair<size_t, size_t>> FileRanges(ReadRequests.size(),
+                                                      {SIZE_MAX, 0});
+    for (size_t i = 0; i < ReadRequests.size(); ++i)
+    {
+        const auto &Req = ReadRequests[i];
+        if (!Req.Cached &&
+            DataFileRange(Req.WriterRank, Req.Timestep, Req.StartOffset,
+                          FileRanges[i].first, FileRanges[i].second))
+        {
+            m_DataFileManager.AdviseFile(FileRanges[i].second, Req.ReadLength,
+                                         FileRanges[i].first);
+        }
+    }
+
     // Potentially optimize read requests, make contiguous, etc.
-    for (const auto &Req : ReadRequests)
+    for (size_t i = 0; i < ReadRequests.size(); ++i)
     {
+        auto &Req = ReadRequests[i];
+        if (Req.Cached)
+        {
+            continue;
+        }
+        if (m_Parameters.PrefetchSize > 0 && m_OpenMode == Mode::Read)
+        {
+            m_StepReads.push_back(
+                {Req.WriterRank, Req.StartOffset, Req.ReadLength});
+            if (ReadPrefetched(Req))
+            {
+                continue;
+            }
+        }
+        if (FileRanges[i].first != SIZE_MAX)
+        {
+            const char *Mapped = m_DataFileManager.MapFile(
+                FileRanges[i].second, Req.ReadLength, FileRanges[i].first);
+            if (Mapped)
+            {
+                free(Req.DestinationAddr);
+                Req.DestinationAddr = const_cast<char *>(Mapped);
+                Req.MappedData = true;
+                continue;
+            }
+        }
         ReadData(Req.WriterRank, Req.Timestep, Req.StartOffset, Req.ReadLength,
                  Req.DestinationAddr);
     }
-
-    m_BP5Deserializer->FinalizeGets(ReadRequests);
 }
 
 // PRIVATE
@@ -285,6 +693,17 @@ void BP5Reader::Init()
 void BP5Reader::InitParameters()
 {
     ParseParams(m_IO, m_Parameters);
+    if (m_Parameters.DirectIO)
+    {
+        if (m_Parameters.DirectIOAlignOffset == 0)
+        {
+            m_Parameters.DirectIOAlignOffset = 1;
+        }
+        if (m_Parameters.DirectIOAlignBuffer == 0)
+        {
+            m_Parameters.DirectIOAlignBuffer = m_Parameters.DirectIOAlignOffset;
+        }
+    }
     if (m_Parameters.OpenTimeoutSecs < 0.0f)
     {
         if (m_OpenMode == Mode::ReadRandomAccess)
@@ -557,12 +976,21 @@ void BP5Reader::UpdateBuffer(const TimePoint &timeoutInstant,
                 m_WriterIsRowMajor, m_ReaderIsRowMajor,
                 (m_OpenMode == Mode::ReadRandomAccess));
             m_BP5Deserializer->m_Engine = this;
+            m_BP5Deserializer->m_SieveThreshold = m_Parameters.SieveThreshold;
+            m_BP5Deserializer->SetBlockCacheSize(m_Parameters.ReadCacheSize);
+            m_BP5Deserializer->m_ReadDataCallback =
+                [this](size_t WriterRank, size_t Timestep, size_t StartOffset,
+                       size_t Length, char *Destination) {
+                    ReadData(WriterRank, Timestep, StartOffset, Length,
+                             Destination);
+                };
         }
     }
 
     if (m_StepsCount > stepsBefore)
     {
         m_Metadata.Reset(true, false);
+        m_DecompressedMetadata.clear();
         m_MetaMetadata.Reset(true, false);
         if (m_Comm.Rank() == 0)
         {
@@ -783,12 +1211,19 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL,
             break;
         }
         case IndexRecord::StepRecord:
+        case IndexRecord::CompressedStepRecord:
         {
             std::vector<uint64_t> ptrs;
             const uint64_t MetadataPos = helper::ReadValue<uint64_t>(
                 buffer, position, m_Minifooter.IsLittleEndian);
             const uint64_t MetadataSize = helper::ReadValue<uint64_t>(
                 buffer, position, m_Minifooter.IsLittleEndian);
+            uint64_t MetadataRawSize = 0;
+            if (recordID == IndexRecord::CompressedStepRecord)
+            {
+                MetadataRawSize = helper::ReadValue<uint64_t>(
+                    buffer, position, m_Minifooter.IsLittleEndian);
+            }
             const uint64_t FlushCount = helper::ReadValue<uint64_t>(
                 buffer, position, m_Minifooter.IsLittleEndian);
 
@@ -809,6 +1244,7 @@ size_t BP5Reader::ParseMetadataIndex(format::BufferSTL &bufferSTL,
                 ptrs.push_back(position);
                 // absolute pos in file before read
                 ptrs.push_back(MetadataPos);
+                ptrs.push_back(MetadataRawSize);
                 m_MetadataIndexTable[m_StepsCount] = ptrs;
 #ifdef DUMPDATALOCINFO
                 for (uint64_t i = 0; i < m_WriterCount; i++)
@@ -993,6 +1429,7 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 void BP5Reader::DoClose(const int transportIndex)
 {
     PERFSTUBS_SCOPED_TIMER("BP5Reader::Close");
+    WaitForPrefetch();
     if (m_OpenMode == Mode::ReadRandomAccess)
     {
         PerformGets();
@@ -1001,6 +1438,7 @@ void BP5Reader::DoClose(const int transportIndex)
     {
         EndStep();
     }
+    StopAsyncGetThread();
     m_DataFileManager.CloseFiles();
     m_MDFileManager.CloseFiles();
 }
@@ -1018,6 +1456,32 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 
 size_t BP5Reader::DoSteps() const { return m_StepsCount; }
 
+Metrics BP5Reader::DoGetMetrics() const
+{
+    Metrics metrics;
+    metrics["steps"] = static_cast<double>(m_StepsCount);
+
+    format::BP5BlockCache::Stats CacheStats;
+    if (m_BP5Deserializer && m_BP5Deserializer->GetBlockCacheStats(CacheStats))
+    {
+        metrics["read_cache_hits"] = static_cast<double>(CacheStats.Hits);
+        metrics["read_cache_hit_bytes"] =
+            static_cast<double>(CacheStats.HitBytes);
+        metrics["read_cache_misses"] = static_cast<double>(CacheStats.Misses);
+        metrics["read_cache_evictions"] =
+            static_cast<double>(CacheStats.Evictions);
+        metrics["read_cache_bytes"] = static_cast<double>(CacheStats.Bytes);
+    }
+    if (m_Parameters.PrefetchSize > 0)
+    {
+        metrics["prefetch_read_bytes"] =
+            static_cast<double>(m_PrefetchReadBytes.load());
+        metrics["prefetch_used_bytes"] =
+            static_cast<double>(m_PrefetchUsedBytes.load());
+    }
+    return metrics;
+}
+
 void BP5Reader::NotifyEngineNoVarsQuery()
 {
     if (!m_BetweenStepPairs)
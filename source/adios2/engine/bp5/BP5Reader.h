@@ -20,8 +20,14 @@
 #include "adios2/toolkit/format/bp5/BP5Deserializer.h"
 #include "adios2/toolkit/transportman/TransportMan.h"
 
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
 #include <map>
+#include <mutex>
+#include <thread>
 #include <vector>
 
 namespace adios2
@@ -56,10 +62,13 @@ public:
 
     void PerformGets() final;
 
+    std::shared_future<void> PerformGetsAsync() final;
+
     MinVarInfo *MinBlocksInfo(const VariableBase &, const size_t Step) const;
     Dims *VarShape(const VariableBase &, const size_t Step) const;
     bool VariableMinMax(const VariableBase &, const size_t Step,
                         MinMaxStruct &MinMax);
+    bool SupportsStridedSelections() const noexcept final { return true; }
 
 private:
     format::BP5Deserializer *m_BP5Deserializer = nullptr;
@@ -223,6 +232,8 @@ private:
 
     size_t DoSteps() const final;
 
+    Metrics DoGetMetrics() const final;
+
     void DoGetAbsoluteSteps(const VariableBase &variable,
                             std::vector<size_t> &keys) const final;
 
@@ -233,12 +244,94 @@ private:
     format::BufferSTL m_MetadataIndex;
     format::BufferSTL m_MetaMetadata;
     format::BufferSTL m_Metadata;
+    /** decompressed metadata of steps with compressed metadata, the
+     * deserializer points into these as it does into m_Metadata */
+    std::map<size_t, std::vector<char>> m_DecompressedMetadata;
+
+    /* Streaming read-ahead (PrefetchSize > 0): the data ranges read in one
+     * step are read for the next step on a background thread, into a
+     * staging buffer that PerformGets serves matching reads from. The
+     * thread only touches the data files and the metadata index of steps
+     * already in memory, and is waited for before either is used again.
+     */
+    struct PrefetchRange
+    {
+        size_t WriterRank;
+        size_t StartOffset;
+        size_t Length;
+    };
+    /** ranges read so far in the current step */
+    std::vector<PrefetchRange> m_StepReads;
+    /** ranges read in the last completed step, the guess for the next */
+    std::vector<PrefetchRange> m_PrefetchPattern;
+    /** step whose data is staged, SIZE_MAX if none */
+    size_t m_PrefetchStep = SIZE_MAX;
+    std::vector<char> m_PrefetchBuffer;
+    /** (WriterRank, StartOffset) -> (Length, position in m_PrefetchBuffer) */
+    std::map<std::pair<size_t, size_t>, std::pair<size_t, size_t>>
+        m_PrefetchIndex;
+    std::future<void> m_PrefetchFuture;
+    std::atomic<size_t> m_PrefetchReadBytes{0}; // total staged
+    std::atomic<size_t> m_PrefetchUsedBytes{0}; // total served to PerformGets
+
+    /* Direct I/O (DirectIO=true): the data subfiles are opened with
+     * O_DIRECT. A read is expanded to DirectIOAlignOffset boundaries in the
+     * file and goes into an aligned bounce buffer, only the requested bytes
+     * are copied out. The aligned middle of a read goes straight into the
+     * destination when it is DirectIOAlignBuffer aligned there too.
+     */
+    std::mutex m_DirectIOPoolMutex;
+    std::vector<std::vector<char>> m_DirectIOPool;
+    std::vector<char> AcquireDirectIOBuffer(const size_t Size);
+    void ReleaseDirectIOBuffer(std::vector<char> &&Buffer);
+
+    /* Asynchronous Gets: PerformGetsAsync generates the reads and hands them
+     * with the detached Get requests to one background thread, which reads
+     * and finalizes the batches in order. PerformGets, BeginStep and EndStep
+     * wait for the queue to drain, so metadata and data files are never
+     * used by both threads at once.
+     */
+    struct AsyncGetBatch
+    {
+        std::vector<format::BP5Deserializer::ReadRequest> Reads;
+        format::BP5Deserializer::GetRequests Requests;
+        std::promise<void> Done;
+    };
+    std::thread m_AsyncGetThread;
+    std::mutex m_AsyncGetMutex;
+    std::condition_variable m_AsyncGetCV;
+    std::deque<AsyncGetBatch> m_AsyncGetQueue;
+    size_t m_AsyncGetsPending = 0; // queued or being processed
+    bool m_AsyncGetStop = false;
+
+    void AsyncGetThread();
+    void WaitForAsyncGets();
+    void StopAsyncGetThread();
+    /** reads (or maps, or copies from staged data) all non-cached reads */
+    void ReadRequestedData(
+        std::vector<format::BP5Deserializer::ReadRequest> &ReadRequests);
+
+    void StartPrefetch(const size_t Step);
+    void PrefetchThread(const size_t Step);
+    void WaitForPrefetch();
+    /** copies a read from the staging buffer, false if it is not staged */
+    bool ReadPrefetched(const format::BP5Deserializer::ReadRequest &Req);
 
     void InstallMetaMetaData(format::BufferSTL MetaMetadata);
     void InstallMetadataForTimestep(size_t Step);
     void ReadData(const size_t WriterRank, const size_t Timestep,
                   const size_t StartOffset, const size_t Length,
                   char *Destination);
+    /** reads a range of a data subfile, through DirectIO if enabled */
+    void ReadDataFile(char *Destination, const size_t Length,
+                      const size_t FilePos, const size_t SubfileNum);
+    /** opens the writer's subfile on first use, returns its transport ID */
+    size_t OpenDataSubfile(const size_t WriterRank, const size_t Timestep);
+    /** finds where a read lies in the subfile, false if the step's data was
+     * written in several flushes and the read may not be contiguous */
+    bool DataFileRange(const size_t WriterRank, const size_t Timestep,
+                       const size_t StartOffset, size_t &SubfileNum,
+                       size_t &FilePos);
 
     struct WriterMapStruct
     {
@@ -13,6 +13,7 @@
 #include "adios2/core/IO.h"
 #include "adios2/helper/adiosFunctions.h" //CheckIndexRange
 #include "adios2/helper/adiosMath.h"      // SetWithinLimit
+#include "adios2/operator/OperatorFactory.h"
 #include "adios2/toolkit/format/buffer/chunk/ChunkV.h"
 #include "adios2/toolkit/format/buffer/malloc/MallocV.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
@@ -85,7 +86,8 @@ StepStatus BP5Writer::BeginStep(StepMode mode, const float timeoutSeconds)
             if (m_Comm.Rank() == 0)
             {
                 WriteMetadataFileIndex(m_LatestMetaDataPos,
-                                       m_LatestMetaDataSize);
+                                       m_LatestMetaDataSize,
+                                       m_LatestMetaDataRawSize);
                 if (m_Parameters.verbose > 0)
                 {
                     std::cout << "BeginStep, wait on async write was = "
@@ -167,6 +169,13 @@ BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks,
         MDataTotalSize += sizeof(uint64_t) + b.iov_len;
         AttrSizeVector.push_back(b.iov_len);
     }
+    if (m_MetadataCompressor)
+    {
+        return WriteCompressedMetadata(MDataTotalSize, SizeVector,
+                                       AttrSizeVector, MetaDataBlocks,
+                                       AttributeBlocks);
+    }
+    m_LatestMetaDataRawSize = 0;
     MetaDataSize = 0;
     m_FileMetadataManager.WriteFiles((char *)&MDataTotalSize, sizeof(uint64_t));
     MetaDataSize += sizeof(uint64_t);
@@ -196,6 +205,58 @@ BP5Writer::WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks,
     return MetaDataSize;
 }
 
+uint64_t BP5Writer::WriteCompressedMetadata(
+    const uint64_t MDataTotalSize, const std::vector<uint64_t> &SizeVector,
+    const std::vector<uint64_t> &AttrSizeVector,
+    const std::vector<core::iovec> &MetaDataBlocks,
+    const std::vector<core::iovec> &AttributeBlocks)
+{
+    // the same layout as the uncompressed chunk, in one buffer
+    std::vector<char> &raw = m_MetadataRawBuffer;
+    raw.clear();
+    size_t pos = 0;
+    raw.resize(sizeof(uint64_t) * (1 + SizeVector.size() +
+                                   AttrSizeVector.size()));
+    helper::CopyToBuffer(raw, pos, &MDataTotalSize);
+    helper::CopyToBuffer(raw, pos, SizeVector.data(), SizeVector.size());
+    helper::CopyToBuffer(raw, pos, AttrSizeVector.data(),
+                         AttrSizeVector.size());
+    for (const auto *blocks : {&MetaDataBlocks, &AttributeBlocks})
+    {
+        for (auto &b : *blocks)
+        {
+            if (!b.iov_base)
+                continue;
+            raw.insert(raw.end(), (const char *)b.iov_base,
+                       (const char *)b.iov_base + b.iov_len);
+        }
+    }
+
+    const size_t rawSize = raw.size();
+    m_MetadataCompressedBuffer.resize(rawSize + rawSize / 100 + 1024);
+    const size_t compressedSize = m_MetadataCompressor->Operate(
+        raw.data(), {0}, {rawSize}, DataType::UInt8,
+        m_MetadataCompressedBuffer.data());
+
+    uint64_t MetaDataSize;
+    if (compressedSize > 0 && compressedSize < rawSize)
+    {
+        m_FileMetadataManager.WriteFiles(m_MetadataCompressedBuffer.data(),
+                                         compressedSize);
+        MetaDataSize = compressedSize;
+        m_LatestMetaDataRawSize = rawSize;
+    }
+    else
+    {
+        // did not pay off, the step is recorded as uncompressed
+        m_FileMetadataManager.WriteFiles(raw.data(), rawSize);
+        MetaDataSize = rawSize;
+        m_LatestMetaDataRawSize = 0;
+    }
+    m_MetaDataPos += MetaDataSize;
+    return MetaDataSize;
+}
+
 void BP5Writer::AsyncWriteDataCleanup()
 {
     if (m_Parameters.AsyncWrite)
@@ -321,7 +382,8 @@ void BP5Writer::WriteData_EveryoneWrites(format::BufferV *Data,
 }
 
 void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos,
-                                       uint64_t MetaDataSize)
+                                       uint64_t MetaDataSize,
+                                       uint64_t MetaDataRawSize)
 {
     m_FileMetadataManager.FlushFiles();
 
@@ -329,6 +391,10 @@ void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos,
     size_t bufsize =
         1 + (4 + ((FlushPosSizeInfo.size() * 2) + 1) * m_Comm.Size()) *
                 sizeof(uint64_t);
+    if (MetaDataRawSize)
+    {
+        bufsize += sizeof(uint64_t);
+    }
     if (MetaDataPos == 0)
     {
         //  First time, write the headers
@@ -370,13 +436,21 @@ void BP5Writer::WriteMetadataFileIndex(uint64_t MetaDataPos,
     }
 
     // Step record
-    record = StepRecord;
+    record = (MetaDataRawSize ? CompressedStepRecord : StepRecord);
     helper::CopyToBuffer(buf, pos, &record, 1); // record type
     d = (3 + ((FlushPosSizeInfo.size() * 2) + 1) * m_Comm.Size()) *
         sizeof(uint64_t);
+    if (MetaDataRawSize)
+    {
+        d += sizeof(uint64_t);
+    }
     helper::CopyToBuffer(buf, pos, &d, 1); // record length
     helper::CopyToBuffer(buf, pos, &MetaDataPos, 1);
     helper::CopyToBuffer(buf, pos, &MetaDataSize, 1);
+    if (MetaDataRawSize)
+    {
+        helper::CopyToBuffer(buf, pos, &MetaDataRawSize, 1);
+    }
     d = static_cast<uint64_t>(FlushPosSizeInfo.size());
     helper::CopyToBuffer(buf, pos, &d, 1);
 
@@ -518,11 +592,17 @@ void BP5Writer::EndStep()
     // for async IO and let the writer free it up when not needed anymore
     adios2::format::BufferV *databuf = TSInfo.DataBuffer;
     TSInfo.DataBuffer = NULL;
+    const size_t databufsize = databuf->Size();
     m_AsyncWriteLock.lock();
     m_flagRush = false;
     m_AsyncWriteLock.unlock();
     WriteData(databuf);
     m_Profiler.Stop("AWD");
+    if (m_Parameters.DeduplicateBlocks)
+    {
+        m_BP5Serializer.DataPlaced(m_ThisTimestepDataSize - databufsize,
+                                   databufsize, m_StartDataPos);
+    }
 
     std::vector<char> MetaBuffer = m_BP5Serializer.CopyMetadataToContiguous(
         TSInfo.NewMetaMetaBlocks, TSInfo.MetaEncodeBuffer,
@@ -556,9 +636,11 @@ void BP5Writer::EndStep()
         WriteMetaMetadata(UniqueMetaMetaBlocks);
         m_LatestMetaDataPos = m_MetaDataPos;
         m_LatestMetaDataSize = WriteMetadata(Metadata, AttributeBlocks);
+        m_TotalMetaDataSize += m_LatestMetaDataSize;
         if (!m_Parameters.AsyncWrite)
         {
-            WriteMetadataFileIndex(m_LatestMetaDataPos, m_LatestMetaDataSize);
+            WriteMetadataFileIndex(m_LatestMetaDataPos, m_LatestMetaDataSize,
+                                   m_LatestMetaDataRawSize);
         }
     }
     delete RecvBuffer;
@@ -577,6 +659,8 @@ void BP5Writer::EndStep()
     }
 
     m_Profiler.Stop("endstep");
+    m_LastTimestepDataSize = m_ThisTimestepDataSize;
+    m_TotalDataSize += m_ThisTimestepDataSize;
     m_WriterStep++;
     m_EndStepEnd = Now();
     /* Seconds ts2 = Now() - m_EngineStart;
@@ -631,6 +715,11 @@ void BP5Writer::InitParameters()
         m_Parameters.StripeSize = 4096;
     }
 
+    if (m_Parameters.ProfileTrace)
+    {
+        m_Profiler.EnableTrace(m_Parameters.ProfileTraceEvents);
+    }
+
     if (m_Parameters.DirectIO)
     {
         if (m_Parameters.DirectIOAlignBuffer == 0)
@@ -654,7 +743,30 @@ void BP5Writer::InitParameters()
         }
     }
 
+    const std::string mdCompression =
+        helper::LowerCase(m_Parameters.MetadataCompression);
+    if (mdCompression == "bzip2" || mdCompression == "blosc")
+    {
+        // throws if ADIOS2 was built without the library
+        m_MetadataCompressor = core::MakeOperator(mdCompression, {});
+    }
+    else if (!mdCompression.empty() && mdCompression != "none")
+    {
+        helper::Throw<std::invalid_argument>(
+            "Engine", "BP5Writer", "InitParameters",
+            "MetadataCompression must be none, bzip2 or blosc, found " +
+                m_Parameters.MetadataCompression);
+    }
+
     m_BP5Serializer.m_StatsLevel = m_Parameters.StatsLevel;
+    m_BP5Serializer.m_DeduplicateBlocks = m_Parameters.DeduplicateBlocks;
+    // sub-block division assumes row-major data, as in BP4
+    if ((m_Parameters.StatsBlockSize > 0) &&
+        (m_Parameters.StatsBlockSize < DefaultStatsBlockSize) &&
+        (m_IO.m_ArrayOrder == ArrayOrdering::RowMajor))
+    {
+        m_BP5Serializer.m_StatsBlockSize = m_Parameters.StatsBlockSize;
+    }
 }
 
 uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
@@ -758,8 +870,13 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
             break;
         }
         case IndexRecord::StepRecord:
+        case IndexRecord::CompressedStepRecord:
         {
             position += 2 * sizeof(uint64_t); // MetadataPos, MetadataSize
+            if (recordID == IndexRecord::CompressedStepRecord)
+            {
+                position += sizeof(uint64_t); // uncompressed size
+            }
             const uint64_t FlushCount =
                 helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
             // jump over the metadata positions
@@ -848,11 +965,16 @@ uint64_t BP5Writer::CountStepsInMetadataIndex(format::BufferSTL &bufferSTL)
             break;
         }
         case IndexRecord::StepRecord:
+        case IndexRecord::CompressedStepRecord:
         {
             m_AppendMetadataIndexPos = position;
             const uint64_t MetadataPos =
                 helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
             position += sizeof(uint64_t); // MetadataSize
+            if (recordID == IndexRecord::CompressedStepRecord)
+            {
+                position += sizeof(uint64_t); // uncompressed size
+            }
             const uint64_t FlushCount =
                 helper::ReadValue<uint64_t>(buffer, position, IsLittleEndian);
 
@@ -1414,6 +1536,11 @@ void BP5Writer::FlushData(const bool isFinal)
     /* DataBuf is deleted in WriteData() */
     DataBuf = nullptr;
 
+    if (m_Parameters.DeduplicateBlocks)
+    {
+        m_BP5Serializer.DataPlaced(m_ThisTimestepDataSize, databufsize,
+                                   m_StartDataPos);
+    }
     m_ThisTimestepDataSize += databufsize;
 
     if (!isFinal)
@@ -1499,7 +1626,8 @@ void BP5Writer::DoClose(const int transportIndex)
     {
         if (m_Parameters.AsyncWrite)
         {
-            WriteMetadataFileIndex(m_LatestMetaDataPos, m_LatestMetaDataSize);
+            WriteMetadataFileIndex(m_LatestMetaDataPos, m_LatestMetaDataSize,
+                                   m_LatestMetaDataRawSize);
         }
         // close metadata index file
         UpdateActiveFlag(false);
@@ -1509,6 +1637,16 @@ void BP5Writer::DoClose(const int transportIndex)
     FlushProfiler();
 }
 
+namespace
+{
+/** profiling.json -> profiling_trace.json */
+std::string TraceFileName(const std::string &profileFileName)
+{
+    return profileFileName.substr(0, profileFileName.size() - 5) +
+           "_trace.json";
+}
+}
+
 void BP5Writer::FlushProfiler()
 {
     auto transportTypes = m_FileDataManager.GetTransportsTypes();
@@ -1544,6 +1682,12 @@ void BP5Writer::FlushProfiler()
     const std::vector<char> profilingJSON(
         m_Profiler.AggregateProfilingJSON(lineJSON));
 
+    std::vector<char> traceJSON;
+    if (m_Profiler.IsTraceEnabled())
+    {
+        traceJSON = m_Profiler.AggregateTraceJSON();
+    }
+
     if (m_RankMPI == 0)
     {
         // std::cout << "write profiling file!" << std::endl;
@@ -1564,6 +1708,12 @@ void BP5Writer::FlushProfiler()
             }
             m_FileDrainer.AddOperationWrite(
                 profileFileName, profilingJSON.size(), profilingJSON.data());
+            if (!traceJSON.empty())
+            {
+                m_FileDrainer.AddOperationWrite(
+                    TraceFileName(profileFileName), traceJSON.size(),
+                    traceJSON.data());
+            }
         }
         else
         {
@@ -1584,6 +1734,14 @@ void BP5Writer::FlushProfiler()
             profilingJSONStream.Write(profilingJSON.data(),
                                       profilingJSON.size());
             profilingJSONStream.Close();
+            if (!traceJSON.empty())
+            {
+                transport::FileFStream traceJSONStream(m_Comm);
+                traceJSONStream.Open(TraceFileName(profileFileName),
+                                     Mode::Write);
+                traceJSONStream.Write(traceJSON.data(), traceJSON.size());
+                traceJSONStream.Close();
+            }
         }
     }
 }
@@ -1593,6 +1751,38 @@ size_t BP5Writer::DebugGetDataBufferSize() const
     return m_BP5Serializer.DebugGetDataBufferSize();
 }
 
+Metrics BP5Writer::DoGetMetrics() const
+{
+    Metrics metrics;
+    metrics["steps"] = static_cast<double>(m_WriterStep);
+    metrics["step_data_bytes"] = static_cast<double>(m_LastTimestepDataSize);
+    metrics["data_bytes"] = static_cast<double>(m_TotalDataSize);
+    if (m_Comm.Rank() == 0)
+    {
+        metrics["metadata_bytes"] = static_cast<double>(m_TotalMetaDataSize);
+    }
+    m_Profiler.AddToMetrics(metrics);
+
+    // time the application spent writing data or waiting on async writes
+    const double writeUs = metrics["AWD_us"] + metrics["WaitOnAsync_us"];
+    if (writeUs > 0.0)
+    {
+        // bytes per microsecond is MB/s
+        metrics["data_write_bandwidth_MBps"] =
+            static_cast<double>(m_TotalDataSize) / writeUs;
+    }
+    if (m_Parameters.AsyncWrite)
+    {
+        metrics["async_write_pending"] =
+            m_WriteFuture.valid() &&
+                    m_WriteFuture.wait_for(std::chrono::seconds(0)) !=
+                        std::future_status::ready
+                ? 1.0
+                : 0.0;
+    }
+    return metrics;
+}
+
 #define declare_type(T)                                                        \
     void BP5Writer::DoPut(Variable<T> &variable,                               \
                           typename Variable<T>::Span &span,                    \
@@ -159,11 +159,28 @@ private:
     void WriteMetaMetadata(
         const std::vector<format::BP5Base::MetaMetaInfoBlock> MetaMetaBlocks);
 
-    void WriteMetadataFileIndex(uint64_t MetaDataPos, uint64_t MetaDataSize);
+    /** MetaDataRawSize: uncompressed size, 0 if the metadata of the step is
+     * not compressed */
+    void WriteMetadataFileIndex(uint64_t MetaDataPos, uint64_t MetaDataSize,
+                                uint64_t MetaDataRawSize);
 
+    /** returns the size written to md.0, sets m_LatestMetaDataRawSize */
     uint64_t WriteMetadata(const std::vector<core::iovec> &MetaDataBlocks,
                            const std::vector<core::iovec> &AttributeBlocks);
 
+    uint64_t
+    WriteCompressedMetadata(const uint64_t MDataTotalSize,
+                            const std::vector<uint64_t> &SizeVector,
+                            const std::vector<uint64_t> &AttrSizeVector,
+                            const std::vector<core::iovec> &MetaDataBlocks,
+                            const std::vector<core::iovec> &AttributeBlocks);
+
+    /** lossless operator compressing each step's metadata (rank 0 only),
+     * nullptr if MetadataCompression=none */
+    std::shared_ptr<core::Operator> m_MetadataCompressor;
+    std::vector<char> m_MetadataRawBuffer;
+    std::vector<char> m_MetadataCompressedBuffer;
+
     /** Write Data to disk, in an aggregator chain */
     void WriteData(format::BufferV *Data);
     void WriteData_EveryoneWrites(format::BufferV *Data,
@@ -181,7 +198,9 @@ private:
 
     /* Two-level-shm aggregator functions */
     void WriteMyOwnData(format::BufferV *Data);
-    void SendDataToAggregator(format::BufferV *Data);
+    /* StreamOffset: where Data starts in the shm ring stream */
+    void SendDataToAggregator(format::BufferV *Data,
+                              const uint64_t StreamOffset);
     void WriteOthersData(const size_t TotalSize);
 
     template <class T>
@@ -189,6 +208,8 @@ private:
 
     void FlushProfiler();
 
+    Metrics DoGetMetrics() const final;
+
     /** manages all communication tasks in aggregation */
     aggregator::MPIAggregator *m_Aggregator; // points to one of these below
     aggregator::MPIShmChain m_AggregatorTwoLevelShm;
@@ -217,6 +238,11 @@ private:
      *  Total data written this timestep
      */
     uint64_t m_ThisTimestepDataSize = 0;
+    /** data size of the last completed step and of all steps */
+    uint64_t m_LastTimestepDataSize = 0;
+    uint64_t m_TotalDataSize = 0;
+    /** metadata written by rank 0 */
+    uint64_t m_TotalMetaDataSize = 0;
 
     /** rank 0 collects m_StartDataPos in this vector for writing it
      *  to the index file
@@ -252,6 +278,7 @@ private:
     // variables to delay writing to index file
     uint64_t m_LatestMetaDataPos;
     uint64_t m_LatestMetaDataSize;
+    uint64_t m_LatestMetaDataRawSize = 0;
     Seconds m_LastTimeBetweenSteps = Seconds(0.0);
     Seconds m_TotalTimeBetweenSteps = Seconds(0.0);
     Seconds m_AvgTimeBetweenSteps = Seconds(0.0);
@@ -301,6 +328,7 @@ private:
             *currentComputationBlocks;     // extended by main thread
         size_t *currentComputationBlockID; // increased by main thread
         shm::Spinlock *lock; // race condition over currentComp* variables
+        profiling::JSONProfiler *profiler;
     };
 
     AsyncWriteInfo *m_AsyncWriteInfo;
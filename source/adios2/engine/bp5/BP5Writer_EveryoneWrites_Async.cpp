@@ -199,6 +199,7 @@ void BP5Writer::AsyncWriteOwnData(AsyncWriteInfo *info,
 
 int BP5Writer::AsyncWriteThread_EveryoneWrites(AsyncWriteInfo *info)
 {
+    info->profiler->Start("async_write");
     if (info->tokenChain)
     {
         if (info->rank_chain > 0)
@@ -221,6 +222,7 @@ int BP5Writer::AsyncWriteThread_EveryoneWrites(AsyncWriteInfo *info)
         }
     }
     delete info->Data;
+    info->profiler->Stop("async_write");
     return 1;
 };
 
@@ -278,6 +280,7 @@ void BP5Writer::WriteData_EveryoneWrites_Async(format::BufferV *Data,
     }
     m_AsyncWriteInfo->tstart = m_EngineStart;
     m_AsyncWriteInfo->tm = &m_FileDataManager;
+    m_AsyncWriteInfo->profiler = &m_Profiler;
     m_AsyncWriteInfo->Data = Data;
     m_AsyncWriteInfo->startPos = m_StartDataPos;
     m_AsyncWriteInfo->totalSize = Data->Size();
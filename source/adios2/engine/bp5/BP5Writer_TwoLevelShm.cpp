@@ -13,7 +13,6 @@
 #include "adios2/helper/adiosFunctions.h" //CheckIndexRange, PaddingToAlignOffset
 #include "adios2/toolkit/format/buffer/chunk/ChunkV.h"
 #include "adios2/toolkit/format/buffer/malloc/MallocV.h"
-#include "adios2/toolkit/shm/TokenChain.h"
 #include "adios2/toolkit/transport/file/FileFStream.h"
 #include <adios2-perfstubs-interface.h>
 
@@ -43,17 +42,23 @@ void BP5Writer::WriteData_TwoLevelShm(format::BufferV *Data)
     m_DataPos +=
         helper::PaddingToAlignOffset(m_DataPos, m_Parameters.StripeSize);
 
-    // Each aggregator needs to know the total size they write
-    // This calculation is valid on aggregators only
-    std::vector<uint64_t> mySizes = a->m_Comm.GatherValues(Data->Size());
+    // Every process needs to know the sizes in its chain to find where its
+    // data goes in the shm ring (and in the file)
+    std::vector<uint64_t> mySizes = a->m_Comm.AllGatherValues(Data->Size());
     uint64_t myTotalSize = 0;
     uint64_t maxSize = 0;
-    for (auto s : mySizes)
+    // offset of this process' data in the stream of non-aggregator data
+    uint64_t myStreamOffset = 0;
+    for (size_t r = 0; r < mySizes.size(); ++r)
     {
-        myTotalSize += s;
-        if (s > maxSize)
+        myTotalSize += mySizes[r];
+        if (r > 0 && mySizes[r] > maxSize)
         {
-            maxSize = s;
+            maxSize = mySizes[r];
+        }
+        if (r > 0 && static_cast<int>(r) < a->m_Comm.Rank())
+        {
+            myStreamOffset += mySizes[r];
         }
     }
 
@@ -64,12 +69,16 @@ void BP5Writer::WriteData_TwoLevelShm(format::BufferV *Data)
         {
             alignment_size = m_Parameters.DirectIOAlignOffset;
         }
-        a->CreateShm(static_cast<size_t>(maxSize), m_Parameters.MaxShmSize,
-                     alignment_size);
+        // by default a slot holds the largest contribution
+        size_t slotSize = m_Parameters.ShmSlotSize;
+        if (!slotSize)
+        {
+            slotSize = static_cast<size_t>(maxSize);
+        }
+        a->CreateShmRing(m_Parameters.ShmSlots, slotSize,
+                         m_Parameters.MaxShmSize, alignment_size);
     }
 
-    shm::TokenChain<uint64_t> tokenChain(&a->m_Comm);
-
     if (a->m_IsAggregator)
     {
         // In each aggregator chain, send from master down the line
@@ -106,11 +115,6 @@ void BP5Writer::WriteData_TwoLevelShm(format::BufferV *Data)
                   << " to subfile " << a->m_SubStreamIndex << " at pos "
                   << m_DataPos << " totalsize " << myTotalSize << std::endl;*/
 
-        // Send token to first non-aggregator to start filling shm
-        // Also informs next process its starting offset (for correct metadata)
-        uint64_t nextWriterPos = m_DataPos + Data->Size();
-        tokenChain.SendToken(nextWriterPos);
-
         WriteMyOwnData(Data);
 
         /* Write from shm until every non-aggr sent all data */
@@ -132,22 +136,19 @@ void BP5Writer::WriteData_TwoLevelShm(format::BufferV *Data)
     }
     else
     {
-        // non-aggregators fill shared buffer in marching order
-        // they also receive their starting offset this way
-        m_StartDataPos = tokenChain.RecvToken();
-
-        /*std::cout << "Rank " << m_Comm.Rank()
-                  << " non-aggregator recv token to fill shm = "
-                  << m_StartDataPos << std::endl;*/
-
-        SendDataToAggregator(Data);
-
-        uint64_t nextWriterPos = m_StartDataPos + Data->Size();
-        tokenChain.SendToken(nextWriterPos);
+        // non-aggregators fill the shm ring concurrently
+        SendDataToAggregator(Data, myStreamOffset);
     }
 
     if (a->m_Comm.Size() > 1)
     {
+        // non-aggregators learn where the aggregator started writing, their
+        // data follows the aggregator's own data (for correct metadata)
+        uint64_t aggStartPos = a->m_Comm.BroadcastValue(m_StartDataPos, 0);
+        if (!a->m_IsAggregator)
+        {
+            m_StartDataPos = aggStartPos + mySizes[0] + myStreamOffset;
+        }
         a->DestroyShm();
     }
 }
@@ -181,113 +182,68 @@ void BP5Writer::WriteMyOwnData(format::BufferV *Data)
     return out.str();
 }*/
 
-void BP5Writer::SendDataToAggregator(format::BufferV *Data)
+void BP5Writer::SendDataToAggregator(format::BufferV *Data,
+                                     const uint64_t StreamOffset)
 {
-    /* Only one process is running this function at once
-       See shmFillerToken in the caller function
+    /* All non-aggregators run this function at once
 
-       In a loop, copy the local data into the shared memory, alternating
-       between the two segments.
+       Copy the local data into the chunks of the shm ring that cover
+       [StreamOffset, StreamOffset + Data->Size()). Other processes may copy
+       into the same chunk at the same time, at other offsets.
     */
 
     aggregator::MPIShmChain *a =
         dynamic_cast<aggregator::MPIShmChain *>(m_Aggregator);
 
     std::vector<core::iovec> DataVec = Data->DataVec();
-    size_t nBlocks = DataVec.size();
+    const uint64_t slotSize = a->RingSlotSize();
 
-    // size_t sent = 0;
-    size_t block = 0;
-    size_t temp_offset = 0;
-    while (block < nBlocks)
+    uint64_t pos = StreamOffset;
+    for (const auto &iov : DataVec)
     {
-        // potentially blocking call waiting on Aggregator
-        aggregator::MPIShmChain::ShmDataBuffer *b = a->LockProducerBuffer();
-        // b->max_size: how much we can copy
-        // b->actual_size: how much we actually copy
-        b->actual_size = 0;
-        while (true)
+        size_t temp_offset = 0;
+        while (temp_offset < iov.iov_len)
         {
-            /* Copy n bytes from the current block, current offset to shm
-                making sure to use up to shm_size bytes
-            */
-            size_t n = DataVec[block].iov_len - temp_offset;
-            if (n > (b->max_size - b->actual_size))
-            {
-                n = b->max_size - b->actual_size;
-            }
-            std::memcpy(&b->buf[b->actual_size],
-                        (const char *)DataVec[block].iov_base + temp_offset, n);
-            b->actual_size += n;
-
-            /* Have we processed the entire block or staying with it? */
-            if (n + temp_offset < DataVec[block].iov_len)
-            {
-                temp_offset += n;
-            }
-            else
+            const uint64_t chunk = pos / slotSize;
+            const size_t chunkOffset = static_cast<size_t>(pos % slotSize);
+            size_t n = iov.iov_len - temp_offset;
+            if (n > slotSize - chunkOffset)
             {
-                temp_offset = 0;
-                ++block;
-            }
-
-            /* Have we reached the max allowed shm size ?*/
-            if (b->actual_size >= b->max_size)
-            {
-                break;
-            }
-            if (block >= nBlocks)
-            {
-                break;
+                n = static_cast<size_t>(slotSize - chunkOffset);
             }
+            // potentially blocking call waiting on Aggregator
+            char *buf = a->LockProducerChunk(chunk);
+            std::memcpy(buf + chunkOffset,
+                        (const char *)iov.iov_base + temp_offset, n);
+            a->FilledProducerChunk(chunk, n);
+            temp_offset += n;
+            pos += n;
         }
-        // sent += b->actual_size;
-
-        /*if (m_RankMPI >= 42)
-        {
-            std::cout << "Rank " << m_Comm.Rank()
-                      << " filled shm, data_size = " << b->actual_size
-                      << " block = " << block
-                      << " temp offset = " << temp_offset << " sent = " << sent
-                      << " buf = " << static_cast<void *>(b->buf) << " = "
-                      << DoubleBufferToString((double *)b->buf,
-                                              b->actual_size / sizeof(double))
-                      << std::endl;
-        }*/
-
-        a->UnlockProducerBuffer();
     }
 }
+
 void BP5Writer::WriteOthersData(size_t TotalSize)
 {
     /* Only an Aggregator calls this function */
     aggregator::MPIShmChain *a =
         dynamic_cast<aggregator::MPIShmChain *>(m_Aggregator);
 
+    const uint64_t slotSize = a->RingSlotSize();
+    uint64_t chunk = 0;
     size_t wrote = 0;
     while (wrote < TotalSize)
     {
-        // potentially blocking call waiting on some non-aggr process
-        aggregator::MPIShmChain::ShmDataBuffer *b = a->LockConsumerBuffer();
-
-        /*std::cout << "Rank " << m_Comm.Rank()
-                  << " write from shm, data_size = " << b->actual_size
-                  << " total so far = " << wrote
-                  << " buf = " << static_cast<void *>(b->buf) << " = "
-                  << DoubleBufferToString((double *)b->buf,
-                                          b->actual_size / sizeof(double))
-                  << std::endl;*/
-        /*<< " buf = " << static_cast<void *>(b->buf) << " = ["
-        << (int)b->buf[0] << (int)b->buf[1] << "..."
-        << (int)b->buf[b->actual_size - 2]
-        << (int)b->buf[b->actual_size - 1] << "]" << std::endl;*/
-
-        // b->actual_size: how much we need to write
-        m_FileDataManager.WriteFiles(b->buf, b->actual_size);
-
-        wrote += b->actual_size;
-
-        a->UnlockConsumerBuffer();
+        size_t n = TotalSize - wrote;
+        if (n > slotSize)
+        {
+            n = static_cast<size_t>(slotSize);
+        }
+        // potentially blocking call waiting on some non-aggr processes
+        char *buf = a->LockConsumerChunk(chunk, n);
+        m_FileDataManager.WriteFiles(buf, n);
+        wrote += n;
+        a->UnlockConsumerChunk(chunk);
+        ++chunk;
     }
     m_DataPos += TotalSize;
 }
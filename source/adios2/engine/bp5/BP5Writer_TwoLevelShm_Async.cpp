@@ -136,6 +136,7 @@ int BP5Writer::AsyncWriteThread_TwoLevelShm(AsyncWriteInfo *info)
     /* DO NOT use MPI in this separate thread, including destroying
        shm segments explicitely (a->DestroyShm) or implicitely (tokenChain) */
     Seconds ts = Now() - info->tstart;
+    info->profiler->Start("async_write");
     // std::cout << "ASYNC rank " << info->rank_global
     //          << " starts at: " << ts.count() << std::endl;
     aggregator::MPIShmChain *a =
@@ -160,6 +161,7 @@ int BP5Writer::AsyncWriteThread_TwoLevelShm(AsyncWriteInfo *info)
         info->tokenChain->SendToken(nextWriterPos);
     }
     delete info->Data;
+    info->profiler->Stop("async_write");
 
     ts = Now() - info->tstart;
     /*std::cout << "ASYNC " << info->rank_global << " ended at: " << ts.count()
@@ -267,6 +269,7 @@ void BP5Writer::WriteData_TwoLevelShm_Async(format::BufferV *Data)
     m_AsyncWriteInfo->tstart = m_EngineStart;
     m_AsyncWriteInfo->tokenChain = new shm::TokenChain<uint64_t>(&a->m_Comm);
     m_AsyncWriteInfo->tm = &m_FileDataManager;
+    m_AsyncWriteInfo->profiler = &m_Profiler;
     m_AsyncWriteInfo->Data = Data;
     m_AsyncWriteInfo->flagRush = &m_flagRush;
     m_AsyncWriteInfo->lock = &m_AsyncWriteLock;
@@ -122,6 +122,7 @@ void DataManMonitor::EndStep(const size_t step)
         }
         averageLatency = averageLatency / m_LatencyMilliseconds.size();
     }
+    m_AverageLatency = averageLatency;
 
     if (m_Verbose)
     {
@@ -147,6 +148,22 @@ void DataManMonitor::EndStep(const size_t step)
     }
 }
 
+void DataManMonitor::GetMetrics(Metrics &metrics) const
+{
+    if (m_CurrentStep < 0 || m_TotalBytes.empty())
+    {
+        return;
+    }
+    metrics["data_bytes"] = static_cast<double>(m_TotalBytes.back());
+    metrics["step_data_bytes"] = static_cast<double>(m_StepBytes);
+    metrics["total_seconds"] = m_TotalTime / 1000000.0;
+    metrics["bandwidth_MBps"] = m_TotalRate;
+    metrics["average_bandwidth_MBps"] = m_AverageRate;
+    metrics["drop_rate"] = m_DropRate;
+    metrics["steps_per_second"] = m_StepsPerSecond;
+    metrics["average_latency_ms"] = m_AverageLatency;
+}
+
 void DataManMonitor::AddBytes(const size_t bytes)
 {
     m_TotalBytes.back() += bytes;
@@ -16,6 +16,8 @@
 #include <queue>
 #include <string>
 
+#include "adios2/common/ADIOSTypes.h"
+
 namespace adios2
 {
 namespace core
@@ -42,6 +44,8 @@ public:
     void AddTransport(const std::string &method);
     void OutputJson(const std::string &filename);
     void OutputCsv(const std::string &filename);
+    /** rates and latencies as of the last EndStep */
+    void GetMetrics(Metrics &metrics) const;
 
 private:
     bool FileExisted(const std::string &filename);
@@ -68,6 +72,7 @@ private:
     double m_DropRate = 0;
     double m_StepsPerSecond = 0;
     double m_AccumulatedLatency = 0;
+    double m_AverageLatency = 0;
     std::string m_CompressionMethod;
     float m_CompressionAccuracy = 0;
     float m_RequiredAccuracy = 0.00001;
@@ -360,6 +360,17 @@ void DataManReader::DoClose(const int transportIndex)
     }
 }
 
+Metrics DataManReader::DoGetMetrics() const
+{
+    Metrics metrics;
+    metrics["steps"] = static_cast<double>(m_CurrentStep + 1);
+    if (m_MonitorActive)
+    {
+        m_Monitor.GetMetrics(metrics);
+    }
+    return metrics;
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
@@ -72,6 +72,7 @@ private:
     void RequestThread();
 
     void DoClose(const int transportIndex = -1) final;
+    Metrics DoGetMetrics() const final;
 
 #define declare_type(T)                                                        \
     void DoGetSync(Variable<T> &, T *) final;                                  \
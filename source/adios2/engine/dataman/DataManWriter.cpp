@@ -291,6 +291,17 @@ void DataManWriter::DoClose(const int transportIndex)
     m_IsClosed = true;
 }
 
+Metrics DataManWriter::DoGetMetrics() const
+{
+    Metrics metrics;
+    metrics["steps"] = static_cast<double>(m_CurrentStep + 1);
+    if (m_MonitorActive)
+    {
+        m_Monitor.GetMetrics(metrics);
+    }
+    return metrics;
+}
+
 bool DataManWriter::IsBufferQueueEmpty()
 {
     std::lock_guard<std::mutex> l(m_BufferQueueMutex);
@@ -96,6 +96,7 @@ private:
     void PutDeferredCommon(Variable<T> &variable, const T *values);
 
     void DoClose(const int transportIndex = -1) final;
+    Metrics DoGetMetrics() const final;
 };
 
 } // end namespace engine
@@ -75,6 +75,8 @@ void HDF5ReaderP::Init()
             ", in call to Open");
     }
 
+    m_H5File.ParseFileParameters(m_IO); // has to precede Init
+
     m_H5File.Init(m_Name, m_Comm, false);
     m_H5File.ParseParameters(m_IO);
 
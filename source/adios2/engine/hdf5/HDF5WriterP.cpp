@@ -62,6 +62,8 @@ void HDF5WriterP::Init()
             ", in call to ADIOS Open or HDF5Writer constructor");
     }
 
+    m_H5File.ParseFileParameters(m_IO); // has to precede Init/Append
+
     if (m_OpenMode == Mode::Append)
     {
         m_H5File.Append(m_Name, m_Comm);
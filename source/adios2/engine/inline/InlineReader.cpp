@@ -15,6 +15,7 @@
 #include <adios2-perfstubs-interface.h>
 
 #include <iostream>
+#include <thread>
 
 namespace adios2
 {
@@ -89,6 +90,7 @@ StepStatus InlineReader::BeginStep(const StepMode mode,
         return StepStatus::EndOfStream;
     }
     m_InsideStep = true;
+    m_AssembledSelections.clear();
 
     if (m_Verbosity == 5)
     {
@@ -107,6 +109,8 @@ void InlineReader::PerformGets()
         std::cout << "Inline Reader " << m_ReaderRank << "     PerformGets()\n";
     }
     SetDeferredVariablePointers();
+    PerformCopies(m_DeferredCopies);
+    m_DeferredCopies.clear();
 }
 
 size_t InlineReader::CurrentStep() const
@@ -137,6 +141,11 @@ void InlineReader::EndStep()
     {
         SetDeferredVariablePointers();
     }
+    if (!m_DeferredCopies.empty())
+    {
+        PerformCopies(m_DeferredCopies);
+        m_DeferredCopies.clear();
+    }
     m_InsideStep = false;
 }
 
@@ -218,6 +227,14 @@ void InlineReader::InitParameters()
                     "integer in the range [0,5], in call to "
                     "Open or Engine constructor");
         }
+        else if (key == "threads")
+        {
+            m_Threads = static_cast<size_t>(std::stoul(value));
+        }
+    }
+    if (m_Threads == 0)
+    {
+        m_Threads = std::max(1U, std::thread::hardware_concurrency());
     }
 }
 
@@ -263,6 +280,50 @@ void InlineReader::SetDeferredVariablePointers()
     m_DeferredVariables.clear();
 }
 
+void InlineReader::PerformCopies(const std::vector<SelectionCopy> &copies) const
+{
+    if (copies.empty())
+    {
+        return;
+    }
+    // small selections are not worth a thread launch
+    constexpr size_t minBytesPerThread = 1024 * 1024;
+    size_t totalBytes = 0;
+    for (const auto &copy : copies)
+    {
+        totalBytes += helper::GetTotalSize(copy.InCount) * copy.TypeSize;
+    }
+    const size_t nThreads = std::min(
+        {m_Threads, copies.size(), totalBytes / minBytesPerThread + 1});
+
+    const bool isRowMajor = (m_IO.m_ArrayOrder == ArrayOrdering::RowMajor);
+    const bool isLittleEndian = helper::IsLittleEndian();
+    auto lf_Copy = [&](const size_t first) {
+        for (size_t i = first; i < copies.size(); i += nThreads)
+        {
+            const SelectionCopy &copy = copies[i];
+            helper::NdCopy(copy.In, copy.InStart, copy.InCount, isRowMajor,
+                           isLittleEndian, copy.Out, copy.OutStart,
+                           copy.OutCount, isRowMajor, isLittleEndian,
+                           copy.TypeSize);
+        }
+    };
+
+    // blocks of one writer step do not overlap, so the copies write
+    // disjoint parts of the output
+    std::vector<std::thread> threads;
+    threads.reserve(nThreads - 1);
+    for (size_t t = 1; t < nThreads; ++t)
+    {
+        threads.emplace_back(lf_Copy, t);
+    }
+    lf_Copy(0);
+    for (auto &thread : threads)
+    {
+        thread.join();
+    }
+}
+
 #define declare_type(T)                                                        \
     template void InlineReader::Get<T>(Variable<T> &, T **) const;
 ADIOS2_FOREACH_PRIMITIVE_STDTYPE_1ARG(declare_type)
@@ -54,6 +54,12 @@ public:
 
     bool IsInsideStep() const;
 
+    /**
+     * Zero-copy Get. For global arrays the pointer addresses the current
+     * selection inside the writer's block when one block holds it
+     * contiguously, otherwise it points to a copy assembled by the engine
+     * which stays valid until the next BeginStep.
+     */
     template <typename T>
     void Get(Variable<T> &, T **) const;
 
@@ -61,6 +67,21 @@ private:
     const InlineWriter *GetWriter() const;
     int m_Verbosity = 0;
     int m_ReaderRank; // my rank in the readers' comm
+    size_t m_Threads = 0; // threads used to assemble selections, 0 = auto
+
+    /** one writer block to selection copy, element type erased */
+    struct SelectionCopy
+    {
+        const char *In;
+        Dims InStart;
+        Dims InCount;
+        char *Out;
+        Dims OutStart;
+        Dims OutCount;
+        int TypeSize;
+    };
+    std::vector<SelectionCopy> m_DeferredCopies;
+    mutable std::map<std::string, std::vector<char>> m_AssembledSelections;
 
     // step info should be received from the writer side in BeginStep()
     size_t m_CurrentStep = static_cast<size_t>(-1);
@@ -105,6 +126,14 @@ private:
 #undef declare_type
 
     void SetDeferredVariablePointers();
+
+    /** Adds copies from every block overlapping the variable selection */
+    template <class T>
+    void AddSelectionCopies(const Variable<T> &variable, T *data,
+                            std::vector<SelectionCopy> &copies) const;
+
+    /** Runs NdCopy for each entry, spread over m_Threads threads */
+    void PerformCopies(const std::vector<SelectionCopy> &copies) const;
 };
 
 } // end namespace engine
@@ -32,6 +32,13 @@ inline void InlineReader::GetSyncCommon(Variable<T> &variable, T *data)
                   << variable.m_Name << ")\n";
     }
     variable.m_Data = data;
+    if (variable.m_ShapeID == ShapeID::GlobalArray)
+    {
+        std::vector<SelectionCopy> copies;
+        AddSelectionCopies(variable, data, copies);
+        PerformCopies(copies);
+        return;
+    }
     auto blockInfo = variable.m_BlocksInfo.back();
     if (blockInfo.IsValue)
     {
@@ -51,16 +58,87 @@ void InlineReader::Get(core::Variable<T> &variable, T **data) const
         std::cout << "Inline Reader " << m_ReaderRank << "     Get("
                   << variable.m_Name << ")\n";
     }
-    auto blockInfo = variable.m_BlocksInfo.back();
-    *data = blockInfo.Data;
+    if (variable.m_ShapeID != ShapeID::GlobalArray)
+    {
+        auto blockInfo = variable.m_BlocksInfo.back();
+        *data = blockInfo.Data;
+        return;
+    }
+
+    const bool isRowMajor = (m_IO.m_ArrayOrder == ArrayOrdering::RowMajor);
+    const Box<Dims> selection =
+        helper::StartEndBox(variable.m_Start, variable.m_Count);
+    for (const auto &blockInfo : variable.m_BlocksInfo)
+    {
+        bool covers = true;
+        for (size_t d = 0; d < variable.m_Count.size(); ++d)
+        {
+            if (variable.m_Start[d] < blockInfo.Start[d] ||
+                variable.m_Start[d] + variable.m_Count[d] >
+                    blockInfo.Start[d] + blockInfo.Count[d])
+            {
+                covers = false;
+                break;
+            }
+        }
+        size_t offset = 0;
+        if (covers && helper::IsIntersectionContiguousSubarray(
+                          helper::StartEndBox(blockInfo.Start, blockInfo.Count),
+                          selection, isRowMajor, offset))
+        {
+            *data = blockInfo.Data + offset;
+            return;
+        }
+    }
+
+    // no single block holds the selection contiguously, assemble it
+    std::vector<char> &buffer = m_AssembledSelections[variable.m_Name];
+    buffer.resize(helper::GetTotalSize(variable.m_Count) * sizeof(T));
+    std::vector<SelectionCopy> copies;
+    AddSelectionCopies(variable, reinterpret_cast<T *>(buffer.data()), copies);
+    PerformCopies(copies);
+    *data = reinterpret_cast<T *>(buffer.data());
 }
 
 template <class T>
 void InlineReader::GetDeferredCommon(Variable<T> &variable, T *data)
 {
+    if (variable.m_ShapeID == ShapeID::GlobalArray)
+    {
+        variable.m_Data = data;
+        AddSelectionCopies(variable, data, m_DeferredCopies);
+        return;
+    }
+    if (variable.m_ShapeID == ShapeID::GlobalValue ||
+        variable.m_ShapeID == ShapeID::LocalValue)
+    {
+        GetSyncCommon(variable, data);
+        return;
+    }
     helper::Throw<std::runtime_error>(
         "Engine", "InlineReader", "GetDeferredCommon",
-        "GetBlockDeferredCommon should be used instead of GetDeferredCommon.");
+        "GetBlockDeferredCommon should be used instead of GetDeferredCommon "
+        "for local arrays.");
+}
+
+template <class T>
+void InlineReader::AddSelectionCopies(const Variable<T> &variable, T *data,
+                                      std::vector<SelectionCopy> &copies) const
+{
+    for (const auto &blockInfo : variable.m_BlocksInfo)
+    {
+        const Box<Dims> overlap = helper::IntersectionStartCount(
+            blockInfo.Start, blockInfo.Count, variable.m_Start,
+            variable.m_Count);
+        if (overlap.first.empty())
+        {
+            continue;
+        }
+        copies.push_back({reinterpret_cast<const char *>(blockInfo.Data),
+                          blockInfo.Start, blockInfo.Count,
+                          reinterpret_cast<char *>(data), variable.m_Start,
+                          variable.m_Count, static_cast<int>(sizeof(T))});
+    }
 }
 
 template <class T>
@@ -12,6 +12,8 @@
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/operator/compress/CompressSirius.h"
 
+#include <sstream>
+
 namespace adios2
 {
 namespace core
@@ -24,6 +26,16 @@ MhsWriter::MhsWriter(IO &io, const std::string &name, const Mode mode,
 : Engine("MhsWriter", io, name, mode, std::move(comm))
 {
     helper::GetParameter(io.m_Parameters, "Tiers", m_Tiers);
+    // concurrent collective I/O from several threads requires
+    // MPI_THREAD_MULTIPLE, so it is only on by default for a single rank
+    m_Threading = (m_Comm.Size() == 1);
+    helper::GetParameter(io.m_Parameters, "Threading", m_Threading);
+    helper::GetParameter(io.m_Parameters, "QueueLimit", m_QueueLimit);
+    if (m_QueueLimit == 0)
+    {
+        m_QueueLimit = 1;
+    }
+
     for (const auto &transportParams : io.m_TransportsParameters)
     {
         auto itVar = transportParams.find("variable");
@@ -39,9 +51,14 @@ MhsWriter::MhsWriter(IO &io, const std::string &name, const Mode mode,
 
         if (itTransport->second == "sirius")
         {
-            m_TransportMap.emplace(
-                itVar->second,
-                std::make_shared<compress::CompressSirius>(io.m_Parameters));
+            auto &ops = m_TransportMap[itVar->second];
+            for (int i = 0; i < m_Tiers; ++i)
+            {
+                Params params = io.m_Parameters;
+                params["Tier"] = std::to_string(i);
+                ops.emplace_back(
+                    std::make_shared<compress::CompressSirius>(params));
+            }
         }
         else
         {
@@ -49,17 +66,58 @@ MhsWriter::MhsWriter(IO &io, const std::string &name, const Mode mode,
                 "Engine", "MhsWriter", "MhsWriter", "invalid operator");
         }
     }
+
+    // AsyncWrite is either one value for all tiers or a comma separated list
+    // with one value per tier
+    std::vector<bool> asyncWrite(m_Tiers, false);
+    auto itAsync = io.m_Parameters.find("AsyncWrite");
+    if (itAsync != io.m_Parameters.end())
+    {
+        std::vector<std::string> values;
+        std::istringstream ss(itAsync->second);
+        std::string value;
+        while (std::getline(ss, value, ','))
+        {
+            values.push_back(value);
+        }
+        if (values.size() != 1 && values.size() != asyncWrite.size())
+        {
+            helper::Throw<std::invalid_argument>(
+                "Engine", "MhsWriter", "MhsWriter",
+                "AsyncWrite needs one value or one value per tier (" +
+                    std::to_string(m_Tiers) + "), got " + itAsync->second);
+        }
+        for (size_t i = 0; i < asyncWrite.size(); ++i)
+        {
+            asyncWrite[i] = helper::StringTo<bool>(
+                values[values.size() == 1 ? 0 : i], "for AsyncWrite");
+        }
+    }
+
     for (int i = 0; i < m_Tiers; ++i)
     {
         m_SubIOs.emplace_back(
             &io.m_ADIOS.DeclareIO("SubIO" + std::to_string(i)));
         m_SubEngines.emplace_back(&m_SubIOs.back()->Open(
             m_Name + ".tier" + std::to_string(i), adios2::Mode::Write));
+        m_Workers.emplace_back(new TierWorker());
+        m_Workers.back()->AsyncWrite = m_Threading && asyncWrite[i];
+    }
+
+    if (m_Threading)
+    {
+        for (auto &w : m_Workers)
+        {
+            TierWorker &worker = *w;
+            worker.Thread = std::thread(&MhsWriter::TierThread, this,
+                                        std::ref(worker));
+        }
     }
 }
 
 MhsWriter::~MhsWriter()
 {
+    StopWorkers();
     for (int i = 0; i < m_Tiers; ++i)
     {
         m_IO.m_ADIOS.RemoveIO("SubIO" + std::to_string(i));
@@ -68,37 +126,62 @@ MhsWriter::~MhsWriter()
 
 StepStatus MhsWriter::BeginStep(StepMode mode, const float timeoutSeconds)
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->BeginStep(mode, timeoutSeconds);
+        Engine *e = m_SubEngines[i];
+        Enqueue(i, [e, mode, timeoutSeconds]() {
+            e->BeginStep(mode, timeoutSeconds);
+        });
     }
     return StepStatus::OK;
 }
 
-size_t MhsWriter::CurrentStep() const { return m_SubEngines[0]->CurrentStep(); }
+size_t MhsWriter::CurrentStep() const { return m_CurrentStep; }
 
 void MhsWriter::PerformPuts()
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
+    {
+        Engine *e = m_SubEngines[i];
+        Enqueue(i, [e]() { e->PerformPuts(); }, true);
+    }
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->PerformPuts();
+        WaitForPuts(i);
     }
 }
 
 void MhsWriter::EndStep()
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->EndStep();
+        Engine *e = m_SubEngines[i];
+        Enqueue(i, [e]() { e->EndStep(); });
     }
+    // user buffers may be reused after EndStep, all Puts must be consumed,
+    // the writes themselves may still run on AsyncWrite tiers
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
+    {
+        if (m_Workers[i]->AsyncWrite)
+        {
+            WaitForPuts(i);
+        }
+        else
+        {
+            WaitForTier(i);
+        }
+    }
+    ++m_CurrentStep;
 }
 
 void MhsWriter::Flush(const int transportIndex)
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
     {
-        e->Flush(transportIndex);
+        Engine *e = m_SubEngines[i];
+        Enqueue(i, [e, transportIndex]() { e->Flush(transportIndex); });
     }
+    WaitForAll();
 }
 
 // PRIVATE
@@ -117,9 +200,152 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 
 void MhsWriter::DoClose(const int transportIndex)
 {
-    for (auto &e : m_SubEngines)
+    for (size_t i = 0; i < m_SubEngines.size(); ++i)
+    {
+        Engine *e = m_SubEngines[i];
+        Enqueue(i, [e]() { e->Close(); });
+    }
+    WaitForAll();
+    StopWorkers();
+}
+
+void MhsWriter::TierThread(TierWorker &worker)
+{
+    while (true)
+    {
+        std::pair<std::function<void()>, bool> task;
+        {
+            std::unique_lock<std::mutex> lock(worker.Mutex);
+            worker.CV.wait(lock, [&worker]() {
+                return worker.Stop || !worker.Queue.empty();
+            });
+            if (worker.Queue.empty())
+            {
+                return;
+            }
+            task = std::move(worker.Queue.front());
+            worker.Queue.pop_front();
+            ++worker.Running;
+        }
+        worker.CV.notify_all();
+
+        std::exception_ptr error;
+        try
+        {
+            task.first();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(worker.Mutex);
+            --worker.Running;
+            if (task.second)
+            {
+                --worker.PendingPuts;
+            }
+            if (error && !worker.Error)
+            {
+                worker.Error = error;
+            }
+        }
+        worker.CV.notify_all();
+    }
+}
+
+void MhsWriter::Enqueue(const size_t tier, std::function<void()> task,
+                        const bool isPut)
+{
+    if (!m_Threading)
+    {
+        task();
+        return;
+    }
+
+    TierWorker &worker = *m_Workers[tier];
+    {
+        std::unique_lock<std::mutex> lock(worker.Mutex);
+        worker.CV.wait(lock, [&]() {
+            return worker.Queue.size() < m_QueueLimit || worker.Error;
+        });
+        if (worker.Error)
+        {
+            std::exception_ptr error = worker.Error;
+            worker.Error = nullptr;
+            std::rethrow_exception(error);
+        }
+        worker.Queue.emplace_back(std::move(task), isPut);
+        if (isPut)
+        {
+            ++worker.PendingPuts;
+        }
+    }
+    worker.CV.notify_all();
+}
+
+void MhsWriter::WaitForPuts(const size_t tier)
+{
+    if (!m_Threading)
     {
-        e->Close();
+        return;
+    }
+
+    TierWorker &worker = *m_Workers[tier];
+    std::unique_lock<std::mutex> lock(worker.Mutex);
+    worker.CV.wait(lock, [&worker]() {
+        return worker.PendingPuts == 0 || worker.Error;
+    });
+    if (worker.Error)
+    {
+        std::exception_ptr error = worker.Error;
+        worker.Error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void MhsWriter::WaitForTier(const size_t tier)
+{
+    if (!m_Threading)
+    {
+        return;
+    }
+
+    TierWorker &worker = *m_Workers[tier];
+    std::unique_lock<std::mutex> lock(worker.Mutex);
+    worker.CV.wait(lock, [&worker]() {
+        return (worker.Queue.empty() && worker.Running == 0) || worker.Error;
+    });
+    if (worker.Error)
+    {
+        std::exception_ptr error = worker.Error;
+        worker.Error = nullptr;
+        std::rethrow_exception(error);
+    }
+}
+
+void MhsWriter::WaitForAll()
+{
+    for (size_t i = 0; i < m_Workers.size(); ++i)
+    {
+        WaitForTier(i);
+    }
+}
+
+void MhsWriter::StopWorkers()
+{
+    for (auto &w : m_Workers)
+    {
+        {
+            std::lock_guard<std::mutex> lock(w->Mutex);
+            w->Stop = true;
+        }
+        w->CV.notify_all();
+        if (w->Thread.joinable())
+        {
+            w->Thread.join();
+        }
     }
 }
 
@@ -13,6 +13,14 @@
 
 #include "adios2/core/Engine.h"
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 namespace adios2
 {
 namespace core
@@ -38,10 +46,43 @@ public:
 private:
     std::vector<IO *> m_SubIOs;
     std::vector<Engine *> m_SubEngines;
-    std::unordered_map<std::string, std::shared_ptr<Operator>> m_TransportMap;
+    /** one operator instance per tier, so tiers can be written concurrently */
+    std::unordered_map<std::string, std::vector<std::shared_ptr<Operator>>>
+        m_TransportMap;
     int m_Tiers = 1;
+    bool m_Threading = false;
+    size_t m_QueueLimit = 32;
+    size_t m_CurrentStep = 0;
+
+    /**
+     * Each tier's sub-engine is driven by its own I/O thread through a
+     * bounded task queue, so tiers are written concurrently instead of one
+     * after the other. With AsyncWrite the tier's EndStep (the actual write)
+     * also runs in the background and only Puts are waited for.
+     */
+    struct TierWorker
+    {
+        std::thread Thread;
+        std::deque<std::pair<std::function<void()>, bool>> Queue;
+        std::mutex Mutex;
+        std::condition_variable CV;
+        size_t Running = 0;
+        size_t PendingPuts = 0;
+        bool Stop = false;
+        bool AsyncWrite = false;
+        std::exception_ptr Error;
+    };
+    std::vector<std::unique_ptr<TierWorker>> m_Workers;
 
-    void PutSubEngine(bool finalPut = false);
+    void TierThread(TierWorker &worker);
+    void Enqueue(const size_t tier, std::function<void()> task,
+                 const bool isPut = false);
+    /** waits until all Puts (user buffers) of a tier are consumed */
+    void WaitForPuts(const size_t tier);
+    /** waits until a tier has executed all queued tasks */
+    void WaitForTier(const size_t tier);
+    void WaitForAll();
+    void StopWorkers();
 
 #define declare_type(T)                                                        \
     void DoPutSync(Variable<T> &, const T *) final;                            \
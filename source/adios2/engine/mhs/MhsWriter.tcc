@@ -24,13 +24,21 @@ template <>
 void MhsWriter::PutDeferredCommon<std::string>(Variable<std::string> &variable,
                                                const std::string *data)
 {
-    auto var = m_SubIOs[0]->InquireVariable<std::string>(variable.m_Name);
-    if (!var)
-    {
-        var = &m_SubIOs[0]->DefineVariable<std::string>(variable.m_Name,
-                                                        {LocalValueDim});
-    }
-    m_SubEngines[0]->Put(variable, data, Mode::Sync);
+    IO *io = m_SubIOs[0];
+    Engine *engine = m_SubEngines[0];
+    const std::string name = variable.m_Name;
+    const std::string value = *data;
+    Enqueue(0,
+            [io, engine, name, value]() {
+                auto var = io->InquireVariable<std::string>(name);
+                if (!var)
+                {
+                    var = &io->DefineVariable<std::string>(name,
+                                                           {LocalValueDim});
+                }
+                engine->Put(*var, value, Mode::Sync);
+            },
+            true);
 }
 
 template <class T>
@@ -43,45 +51,43 @@ void MhsWriter::PutSyncCommon(Variable<T> &variable, const T *data)
 template <class T>
 void MhsWriter::PutDeferredCommon(Variable<T> &variable, const T *data)
 {
-    bool putToAll = false;
+    const std::vector<std::shared_ptr<Operator>> *ops = nullptr;
     auto itVar = m_TransportMap.find(variable.m_Name);
     if (itVar != m_TransportMap.end())
     {
-        if (itVar->second->m_TypeString == "sirius")
-        {
-            putToAll = true;
-        }
-    }
-
-    auto var0 = m_SubIOs[0]->InquireVariable<T>(variable.m_Name);
-    if (!var0)
-    {
-        var0 =
-            &m_SubIOs[0]->DefineVariable<T>(variable.m_Name, variable.m_Shape);
-        itVar = m_TransportMap.find(variable.m_Name);
-        if (itVar != m_TransportMap.end())
-        {
-            var0->AddOperation(itVar->second);
-        }
+        ops = &itVar->second;
     }
 
-    var0->SetSelection({variable.m_Start, variable.m_Count});
-    m_SubEngines[0]->Put(*var0, data, Mode::Sync);
+    // sirius splits the data across all tiers, everything else goes to tier 0
+    const size_t tiers = ops ? m_SubEngines.size() : 1;
+    const std::string name = variable.m_Name;
+    const Dims shape = variable.m_Shape;
+    const Dims start = variable.m_Start;
+    const Dims count = variable.m_Count;
 
-    if (putToAll)
+    // each tier only touches its own sub-IO and sub-engine, so the tasks of
+    // different tiers can run concurrently. The data pointer stays valid until
+    // PerformPuts/EndStep, which wait for the Puts to be consumed.
+    for (size_t i = 0; i < tiers; ++i)
     {
-        for (size_t i = 1; i < m_SubEngines.size(); ++i)
-        {
-            auto var = m_SubIOs[i]->InquireVariable<T>(variable.m_Name);
-            if (!var)
-            {
-                var = &m_SubIOs[i]->DefineVariable<T>(variable.m_Name,
-                                                      variable.m_Shape);
-                var->AddOperation(itVar->second);
-            }
-            var->SetSelection({variable.m_Start, variable.m_Count});
-            m_SubEngines[i]->Put(*var, data, Mode::Sync);
-        }
+        IO *io = m_SubIOs[i];
+        Engine *engine = m_SubEngines[i];
+        std::shared_ptr<Operator> op = ops ? (*ops)[i] : nullptr;
+        Enqueue(i,
+                [io, engine, op, name, shape, start, count, data]() {
+                    auto var = io->InquireVariable<T>(name);
+                    if (!var)
+                    {
+                        var = &io->DefineVariable<T>(name, shape);
+                        if (op)
+                        {
+                            var->AddOperation(op);
+                        }
+                    }
+                    var->SetSelection({start, count});
+                    engine->Put(*var, data, Mode::Sync);
+                },
+                true);
     }
 }
 
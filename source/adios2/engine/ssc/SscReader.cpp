@@ -15,6 +15,8 @@
 #include "adios2/helper/adiosString.h"
 #include <adios2-perfstubs-interface.h>
 
+#include <chrono>
+
 namespace adios2
 {
 namespace core
@@ -51,8 +53,12 @@ StepStatus SscReader::BeginStep(StepMode stepMode, const float timeoutSeconds)
 {
     PERFSTUBS_SCOPED_TIMER_FUNC();
 
+    const auto tstart = std::chrono::steady_clock::now();
     auto ret = m_EngineInstance->BeginStep(stepMode, timeoutSeconds,
                                            m_ReaderSelectionsLocked);
+    m_BeginStepSeconds += std::chrono::duration<double>(
+                              std::chrono::steady_clock::now() - tstart)
+                              .count();
 
     helper::Log("Engine", "SscReader", "BeginStep",
                 std::to_string(CurrentStep()),
@@ -81,7 +87,11 @@ void SscReader::EndStep()
                 m_Verbosity >= 10 ? m_Comm.Rank() : 0, m_Comm.Rank(), 5,
                 m_Verbosity, helper::LogMode::INFO);
 
-    return m_EngineInstance->EndStep(m_ReaderSelectionsLocked);
+    const auto tstart = std::chrono::steady_clock::now();
+    m_EngineInstance->EndStep(m_ReaderSelectionsLocked);
+    m_EndStepSeconds += std::chrono::duration<double>(
+                            std::chrono::steady_clock::now() - tstart)
+                            .count();
 }
 
 void SscReader::DoClose(const int transportIndex)
@@ -95,6 +105,15 @@ void SscReader::DoClose(const int transportIndex)
     m_EngineInstance->Close(transportIndex);
 }
 
+Metrics SscReader::DoGetMetrics() const
+{
+    Metrics metrics;
+    m_EngineInstance->GetMetrics(metrics);
+    metrics["begin_step_seconds"] = m_BeginStepSeconds;
+    metrics["end_step_seconds"] = m_EndStepSeconds;
+    return metrics;
+}
+
 #define declare_type(T)                                                        \
     void SscReader::DoGetSync(Variable<T> &variable, T *data)                  \
     {                                                                          \
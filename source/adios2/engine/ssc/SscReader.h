@@ -50,8 +50,12 @@ private:
                        const size_t step) const final;
 
     void DoClose(const int transportIndex = -1) final;
+    Metrics DoGetMetrics() const final;
 
     int m_Verbosity = 0;
+    /** time spent in BeginStep/EndStep, i.e. waiting on the other side */
+    double m_BeginStepSeconds = 0.0;
+    double m_EndStepSeconds = 0.0;
     std::string m_EngineMode = "generic";
     std::shared_ptr<ssc::SscReaderBase> m_EngineInstance;
 };
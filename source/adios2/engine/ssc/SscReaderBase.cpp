@@ -34,6 +34,12 @@ SscReaderBase::SscReaderBase(IO &io, const std::string &name, const Mode mode,
 
 SscReaderBase::~SscReaderBase() {}
 
+void SscReaderBase::GetMetrics(Metrics &metrics) const
+{
+    metrics["steps"] = static_cast<double>(m_CurrentStep + 1);
+    metrics["step_buffer_bytes"] = static_cast<double>(m_Buffer.size());
+}
+
 void SscReaderBase::SyncMpiPattern(MPI_Comm comm)
 {
 
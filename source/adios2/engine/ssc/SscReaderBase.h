@@ -40,6 +40,9 @@ public:
     virtual void EndStep(const bool readerLocked) = 0;
     virtual void Close(const int transportIndex) = 0;
 
+    /** adds the step count and the size of the step buffer */
+    virtual void GetMetrics(Metrics &metrics) const;
+
 #define declare_type(T)                                                        \
     virtual std::vector<typename Variable<T>::BPInfo> BlocksInfo(              \
         const Variable<T> &variable, const size_t step) const = 0;
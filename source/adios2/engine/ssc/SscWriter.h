@@ -48,8 +48,12 @@ private:
     void DoPutStructDeferred(VariableStruct &, const void *) final;
 
     void DoClose(const int transportIndex = -1) final;
+    Metrics DoGetMetrics() const final;
 
     int m_Verbosity = 0;
+    /** time spent in BeginStep/EndStep, i.e. waiting on the other side */
+    double m_BeginStepSeconds = 0.0;
+    double m_EndStepSeconds = 0.0;
     std::string m_EngineMode = "generic";
     std::shared_ptr<ssc::SscWriterBase> m_EngineInstance;
 };
@@ -42,6 +42,12 @@ SscWriterBase::SscWriterBase(IO &io, const std::string &name, const Mode mode,
 
 SscWriterBase::~SscWriterBase() {}
 
+void SscWriterBase::GetMetrics(Metrics &metrics) const
+{
+    metrics["steps"] = static_cast<double>(m_CurrentStep + 1);
+    metrics["step_buffer_bytes"] = static_cast<double>(m_Buffer.size());
+}
+
 void SscWriterBase::SyncMpiPattern(MPI_Comm comm)
 {
     MPI_Group streamGroup;
@@ -40,6 +40,9 @@ public:
     virtual void EndStep(const bool writerLocked) = 0;
     virtual void Close(const int transportIndex) = 0;
 
+    /** adds the step count and the size of the step buffer */
+    virtual void GetMetrics(Metrics &metrics) const;
+
     virtual void PutDeferred(VariableBase &, const void *) = 0;
 
 protected:
@@ -46,6 +46,18 @@ void SstParamParser::ParseParams(IO &io, struct _SstParams &Params)
         return false;
     };
 
+    auto lf_SetSizeBytesParameter = [&](const std::string key,
+                                        size_t &parameter) {
+        auto itKey = io.m_Parameters.find(key);
+        if (itKey != io.m_Parameters.end())
+        {
+            parameter = helper::StringToByteUnits(
+                itKey->second, "for Parameter key=" + key + " in call to Open");
+            return true;
+        }
+        return false;
+    };
+
     auto lf_SetStringParameter = [&](const std::string key, char *&parameter) {
         auto itKey = io.m_Parameters.find(key);
         if (itKey != io.m_Parameters.end())
@@ -201,6 +213,10 @@ void SstParamParser::ParseParams(IO &io, struct _SstParams &Params)
             {
                 parameter = SstQueueFullDiscard;
             }
+            else if (method == "spill")
+            {
+                parameter = SstQueueFullSpill;
+            }
             else
             {
                 helper::Throw<std::invalid_argument>(
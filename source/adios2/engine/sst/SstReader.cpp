@@ -749,6 +749,36 @@ void SstReader::PerformGets()
 
 void SstReader::DoClose(const int transportIndex) { SstReaderClose(m_Input); }
 
+Metrics SstReader::DoGetMetrics() const
+{
+    struct _SstStats Stats;
+    size_t QueuedTimesteps;
+    SstGetStats(m_Input, &Stats, &QueuedTimesteps);
+
+    Metrics metrics;
+    metrics["steps"] = static_cast<double>(Stats.TimestepsConsumed);
+    // steps announced by the writers but not consumed yet
+    metrics["queued_steps"] =
+        Stats.TimestepMetadataReceived > Stats.TimestepsConsumed
+            ? static_cast<double>(Stats.TimestepMetadataReceived -
+                                  Stats.TimestepsConsumed)
+            : 0.0;
+    metrics["metadata_bytes"] =
+        static_cast<double>(Stats.MetadataBytesReceived);
+    metrics["data_bytes"] = static_cast<double>(Stats.DataBytesReceived);
+    metrics["preload_bytes"] = static_cast<double>(Stats.PreloadBytesReceived);
+    metrics["bytes_read"] = static_cast<double>(Stats.BytesRead);
+    metrics["metadata_latency_max_seconds"] = Stats.MetadataLatencyMaxSecs;
+    if (Stats.TimestepMetadataReceived > 0)
+    {
+        metrics["metadata_latency_seconds"] =
+            Stats.MetadataLatencySecs /
+            static_cast<double>(Stats.TimestepMetadataReceived);
+    }
+    metrics["fan_in"] = Stats.RunningFanIn;
+    return metrics;
+}
+
 MinVarInfo *SstReader::MinBlocksInfo(const VariableBase &Var,
                                      const size_t Step) const
 {
@@ -96,6 +96,7 @@ private:
 #undef declare_type
 
     void DoClose(const int transportIndex = -1) final;
+    Metrics DoGetMetrics() const final;
 
     template <class T>
     void GetSyncCommon(Variable<T> &variable, T *data);
@@ -117,6 +117,32 @@ SstWriter::SstWriter(IO &io, const std::string &name, const Mode mode,
         SstWriterInitMetadataCallback(m_Output, this, AssembleMetadata,
                                       FreeAssembledMetadata);
     }
+
+    /*
+     *  With QueueFullPolicy=spill, SST calls this from its spill thread once
+     *  the data block of a queued timestep is on disk.  Only the data goes,
+     *  the metadata and the block structure are freed by lf_FreeBlocks when
+     *  the timestep is released.
+     */
+    auto ReleaseSpilledData = [](void *writer, void *ClientData) {
+        SstWriter *Writer = reinterpret_cast<SstWriter *>(writer);
+        if (Writer->Params.MarshalMethod == SstMarshalBP5)
+        {
+            BP5DataBlock *Block = reinterpret_cast<BP5DataBlock *>(ClientData);
+            delete Block->TSInfo->DataBuffer;
+            Block->TSInfo->DataBuffer = nullptr;
+        }
+        else if (Writer->Params.MarshalMethod == SstMarshalBP)
+        {
+            BP3DataBlock *Block = reinterpret_cast<BP3DataBlock *>(ClientData);
+            std::vector<char>().swap(Block->serializer->m_Data.m_Buffer);
+        }
+    };
+
+    if (Params.MarshalMethod != SstMarshalFFS)
+    {
+        SstWriterInitReleaseDataCallback(m_Output, this, ReleaseSpilledData);
+    }
 }
 
 SstWriter::~SstWriter() { SstStreamDestroy(m_Output); }
@@ -403,6 +429,26 @@ ADIOS2_FOREACH_STDTYPE_1ARG(declare_type)
 
 void SstWriter::DoClose(const int transportIndex) { SstWriterClose(m_Output); }
 
+Metrics SstWriter::DoGetMetrics() const
+{
+    struct _SstStats Stats;
+    size_t QueuedTimesteps;
+    SstGetStats(m_Output, &Stats, &QueuedTimesteps);
+
+    Metrics metrics;
+    metrics["steps"] = static_cast<double>(Stats.TimestepsCreated);
+    metrics["steps_delivered"] = static_cast<double>(Stats.TimestepsDelivered);
+    metrics["queued_steps"] = static_cast<double>(QueuedTimesteps);
+    metrics["data_bytes"] = static_cast<double>(Stats.DataBytesProvided);
+    metrics["spilled_steps"] = static_cast<double>(Stats.SpilledTimesteps);
+    metrics["spilled_bytes"] = static_cast<double>(Stats.SpilledBytes);
+    metrics["spill_served_bytes"] = static_cast<double>(Stats.SpillServedBytes);
+    metrics["metadata_sends"] = static_cast<double>(Stats.MetadataSends);
+    metrics["metadata_send_seconds"] = Stats.MetadataSendSecs;
+    metrics["metadata_send_max_seconds"] = Stats.MetadataSendMaxSecs;
+    return metrics;
+}
+
 } // end namespace engine
 } // end namespace core
 } // end namespace adios2
@@ -84,6 +84,7 @@ private:
 
     void MarshalAttributes();
     void DoClose(const int transportIndex = -1) final;
+    Metrics DoGetMetrics() const final;
 };
 
 } // end namespace engine
@@ -11,6 +11,7 @@
 #include "OperatorFactory.h"
 #include "adios2/helper/adiosFunctions.h"
 #include "adios2/operator/compress/CompressNull.h"
+#include "adios2/operator/compress/CompressTemporal.h"
 #include "adios2/operator/plugin/PluginOperator.h"
 #include <numeric>
 
@@ -72,6 +73,8 @@ std::string OperatorTypeToString(const Operator::OperatorType type)
         return "sirius";
     case Operator::COMPRESS_SZ:
         return "sz";
+    case Operator::COMPRESS_TEMPORAL:
+        return "temporal";
     case Operator::COMPRESS_ZFP:
         return "zfp";
     case Operator::PLUGIN_INTERFACE:
@@ -136,6 +139,10 @@ std::shared_ptr<Operator> MakeOperator(const std::string &type,
         ret = std::make_shared<compress::CompressSZ>(parameters);
 #endif
     }
+    else if (typeLowerCase == "temporal")
+    {
+        ret = std::make_shared<compress::CompressTemporal>(parameters);
+    }
     else if (typeLowerCase == "zfp")
     {
 #ifdef ADIOS2_HAVE_ZFP
@@ -22,7 +22,6 @@ std::unordered_map<std::string, int> CompressSirius::m_CurrentTierMap;
 std::vector<std::unordered_map<std::string, std::vector<char>>>
     CompressSirius::m_TierBuffersMap;
 int CompressSirius::m_CurrentTier;
-std::vector<std::vector<char>> CompressSirius::m_TierBuffers;
 int CompressSirius::m_Tiers = 0;
 bool CompressSirius::m_CurrentReadFinished = false;
 
@@ -30,8 +29,8 @@ CompressSirius::CompressSirius(const Params &parameters)
 : Operator("sirius", COMPRESS_SIRIUS, "compress", parameters)
 {
     helper::GetParameter(parameters, "Tiers", m_Tiers);
+    helper::GetParameter(parameters, "Tier", m_Tier);
     m_TierBuffersMap.resize(m_Tiers);
-    m_TierBuffers.resize(m_Tiers);
 }
 
 size_t CompressSirius::Operate(const char *dataIn, const Dims &blockStart,
@@ -61,28 +60,20 @@ size_t CompressSirius::Operate(const char *dataIn, const Dims &blockStart,
     size_t totalInputBytes =
         helper::GetTotalSize(blockCount, helper::GetDataTypeSize(varType));
 
-    // if called from Tier 0 sub-engine, then compute tier buffers and put into
-    // m_TierBuffers
+    // every tier is a contiguous view of the input, copied straight into the
+    // output buffer without staging it in intermediate tier buffers
     size_t bytesPerTier = totalInputBytes / m_Tiers;
-    if (m_CurrentTier == 0)
-    {
-        for (size_t i = 0; i < m_TierBuffers.size(); i++)
-        {
-            m_TierBuffers[i].resize(bytesPerTier);
-            std::memcpy(m_TierBuffers[i].data(), dataIn + i * bytesPerTier,
-                        bytesPerTier);
-        }
-    }
-
-    // for all tiers' sub-engines, copy data from m_TierBuffers to output buffer
-    std::memcpy(bufferOut + bufferOutOffset,
-                m_TierBuffers[m_CurrentTier].data(),
-                m_TierBuffers[m_CurrentTier].size());
+    const int tier = m_Tier >= 0 ? m_Tier : m_CurrentTier;
+    std::memcpy(bufferOut + bufferOutOffset, dataIn + tier * bytesPerTier,
+                bytesPerTier);
 
     bufferOutOffset += bytesPerTier;
 
-    m_CurrentTier++;
-    m_CurrentTier %= m_Tiers;
+    if (m_Tier < 0)
+    {
+        m_CurrentTier++;
+        m_CurrentTier %= m_Tiers;
+    }
 
     return bufferOutOffset;
 }
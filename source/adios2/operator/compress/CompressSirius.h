@@ -43,8 +43,9 @@ public:
 private:
     static int m_Tiers;
 
-    // for compress
-    static std::vector<std::vector<char>> m_TierBuffers;
+    // for compress, tier served by this instance. If not set with the "Tier"
+    // parameter, instances cycle through the tiers in m_CurrentTier
+    int m_Tier = -1;
     static int m_CurrentTier;
 
     // for decompress
@@ -0,0 +1,415 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * CompressTemporal.cpp
+ *
+ */
+
+#include "CompressTemporal.h"
+
+#include <cstring>   //std::memcpy
+#include <stdexcept> //std::invalid_argument
+
+#include "adios2/helper/adiosFunctions.h"
+#include "adios2/operator/OperatorFactory.h"
+
+namespace adios2
+{
+namespace core
+{
+namespace compress
+{
+
+namespace
+{
+
+// common header, generation, distance, element size, encoding, raw size
+const size_t HeaderSizeV1 = 4 + 8 + 8 + 1 + 1 + 8;
+
+template <class T>
+T GetHeaderValue(const char *buffer, size_t &pos)
+{
+    T ret;
+    std::memcpy(&ret, buffer + pos, sizeof(T));
+    pos += sizeof(T);
+    return ret;
+}
+
+void PutVarint(std::vector<char> &out, size_t value)
+{
+    while (value >= 0x80)
+    {
+        out.push_back(static_cast<char>((value & 0x7f) | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<char>(value));
+}
+
+void PutLiterals(std::vector<char> &out, const char *data, size_t size)
+{
+    while (size > 0)
+    {
+        const size_t n = size < 128 ? size : 128;
+        out.push_back(static_cast<char>(n - 1));
+        out.insert(out.end(), data, data + n);
+        data += n;
+        size -= n;
+    }
+}
+
+/*
+ * A token below 0x80 is followed by token + 1 literal bytes, a token 0x80 by
+ * the varint length of a run of zero bytes
+ */
+void EncodeZeroRuns(const char *data, const size_t size, std::vector<char> &out)
+{
+    size_t literalStart = 0;
+    size_t i = 0;
+    while (i < size)
+    {
+        if (data[i] != 0)
+        {
+            ++i;
+            continue;
+        }
+        size_t j = i;
+        while (j < size && data[j] == 0)
+        {
+            ++j;
+        }
+        if (j - i >= 3)
+        {
+            PutLiterals(out, data + literalStart, i - literalStart);
+            out.push_back(static_cast<char>(0x80));
+            PutVarint(out, j - i);
+            literalStart = j;
+        }
+        i = j;
+    }
+    PutLiterals(out, data + literalStart, size - literalStart);
+}
+
+void DecodeZeroRuns(const char *in, const size_t sizeIn, char *out,
+                    const size_t sizeOut)
+{
+    size_t pos = 0;
+    size_t outPos = 0;
+    while (pos < sizeIn)
+    {
+        const unsigned char token = static_cast<unsigned char>(in[pos++]);
+        size_t n = 0;
+        if (token < 0x80)
+        {
+            n = static_cast<size_t>(token) + 1;
+            if (pos + n > sizeIn || outPos + n > sizeOut)
+            {
+                break;
+            }
+            std::memcpy(out + outPos, in + pos, n);
+            pos += n;
+        }
+        else
+        {
+            unsigned int shift = 0;
+            unsigned char byte = 0x80;
+            while ((byte & 0x80) && pos < sizeIn && shift < 64)
+            {
+                byte = static_cast<unsigned char>(in[pos++]);
+                n |= static_cast<size_t>(byte & 0x7f) << shift;
+                shift += 7;
+            }
+            if (outPos + n > sizeOut)
+            {
+                break;
+            }
+            std::memset(out + outPos, 0, n);
+        }
+        outPos += n;
+    }
+    if (pos != sizeIn || outPos != sizeOut)
+    {
+        helper::Throw<std::runtime_error>("Operator", "CompressTemporal",
+                                          "InverseOperate",
+                                          "corrupted zero-run encoded buffer");
+    }
+}
+
+} // end anonymous namespace
+
+CompressTemporal::CompressTemporal(const Params &parameters)
+: Operator("temporal", COMPRESS_TEMPORAL, "compress", parameters)
+{
+}
+
+size_t CompressTemporal::Operate(const char *dataIn, const Dims &blockStart,
+                                 const Dims &blockCount, const DataType type,
+                                 char *bufferOut)
+{
+    const uint8_t bufferVersion = 1;
+    size_t bufferOutOffset = 0;
+
+    const size_t elementSize = helper::GetDataTypeSize(type);
+    const size_t sizeIn = helper::GetTotalSize(blockCount, elementSize);
+
+    int keyframeInterval = 10;
+    std::string backend;
+    const std::string hint(" in call to CompressTemporal Operate " +
+                           ToString(type) + "\n");
+    helper::SetParameterValueInt(ops::temporal::key::keyframeInterval,
+                                 m_Parameters, keyframeInterval, hint);
+    if (keyframeInterval < 1)
+    {
+        helper::Throw<std::invalid_argument>(
+            "Operator", "CompressTemporal", "Operate",
+            "keyframeInterval must be a positive integer" + hint);
+    }
+    auto itBackend = m_Parameters.find(ops::temporal::key::backend);
+    if (itBackend != m_Parameters.end())
+    {
+        backend = helper::LowerCase(itBackend->second);
+    }
+    if (backend.empty() || backend == "zeroruns")
+    {
+        m_Backend.reset();
+    }
+    else if (!m_Backend || m_Backend->m_TypeString != backend)
+    {
+        if (backend == m_TypeString)
+        {
+            helper::Throw<std::invalid_argument>(
+                "Operator", "CompressTemporal", "Operate",
+                "temporal can not be its own backend" + hint);
+        }
+        m_Backend = MakeOperator(backend, {});
+    }
+
+    auto itRef = m_References.find(std::make_pair(blockStart, blockCount));
+    const bool isNew = (itRef == m_References.end());
+    if (isNew)
+    {
+        itRef = m_References
+                    .emplace(std::make_pair(blockStart, blockCount),
+                             BlockReference())
+                    .first;
+    }
+    BlockReference &reference = itRef->second;
+
+    const uint64_t generation = isNew ? 0 : reference.Generation + 1;
+    uint64_t distance = 0;
+    if (!isNew && reference.ElementSize == elementSize &&
+        reference.Data.size() == sizeIn &&
+        reference.Distance + 1 < static_cast<size_t>(keyframeInterval))
+    {
+        distance = reference.Distance + 1;
+    }
+
+    // XOR with the previous version, bytes of equal significance together
+    std::vector<char> shuffled(sizeIn);
+    const size_t elements = elementSize ? sizeIn / elementSize : 0;
+    for (size_t b = 0; b < elementSize; ++b)
+    {
+        char *out = shuffled.data() + b * elements;
+        const char *in = dataIn + b;
+        if (distance > 0)
+        {
+            const char *ref = reference.Data.data() + b;
+            for (size_t e = 0; e < elements; ++e)
+            {
+                out[e] = in[e * elementSize] ^ ref[e * elementSize];
+            }
+        }
+        else
+        {
+            for (size_t e = 0; e < elements; ++e)
+            {
+                out[e] = in[e * elementSize];
+            }
+        }
+    }
+
+    uint8_t encoding = m_Backend ? Backend : ZeroRuns;
+    std::vector<char> encoded;
+    if (encoding == Backend)
+    {
+        encoded.resize(2 * sizeIn + 1024);
+        try
+        {
+            encoded.resize(m_Backend->Operate(shuffled.data(), {}, {sizeIn},
+                                              DataType::UInt8,
+                                              encoded.data()));
+        }
+        catch (std::exception &)
+        {
+            // e.g. bzip2 refuses output larger than the input
+            encoding = Stored;
+        }
+    }
+    else
+    {
+        encoded.reserve(sizeIn / 2);
+        EncodeZeroRuns(shuffled.data(), sizeIn, encoded);
+    }
+    if (encoded.size() >= sizeIn)
+    {
+        encoding = Stored;
+    }
+    if (encoding == Stored)
+    {
+        distance = 0;
+    }
+
+    MakeCommonHeader(bufferOut, bufferOutOffset, bufferVersion);
+    PutParameter(bufferOut, bufferOutOffset, generation);
+    PutParameter(bufferOut, bufferOutOffset, distance);
+    PutParameter(bufferOut, bufferOutOffset,
+                 static_cast<uint8_t>(elementSize));
+    PutParameter(bufferOut, bufferOutOffset, encoding);
+    PutParameter(bufferOut, bufferOutOffset, static_cast<uint64_t>(sizeIn));
+
+    if (encoding == Stored)
+    {
+        std::memcpy(bufferOut + bufferOutOffset, dataIn, sizeIn);
+        bufferOutOffset += sizeIn;
+    }
+    else
+    {
+        std::memcpy(bufferOut + bufferOutOffset, encoded.data(),
+                    encoded.size());
+        bufferOutOffset += encoded.size();
+    }
+
+    reference.Data.assign(dataIn, dataIn + sizeIn);
+    reference.ElementSize = elementSize;
+    reference.Generation = generation;
+    reference.Distance = distance;
+
+    return bufferOutOffset;
+}
+
+Operator::ReferenceInfo
+CompressTemporal::GetReferenceInfo(const char *bufferIn,
+                                   const size_t sizeIn) const
+{
+    ReferenceInfo info;
+    if (sizeIn < HeaderSizeV1)
+    {
+        helper::Throw<std::runtime_error>("Operator", "CompressTemporal",
+                                          "GetReferenceInfo",
+                                          "temporal buffer is too short");
+    }
+    size_t bufferInOffset = 1; // skip operator type
+    const uint8_t bufferVersion =
+        GetHeaderValue<uint8_t>(bufferIn, bufferInOffset);
+    if (bufferVersion != 1)
+    {
+        helper::Throw<std::runtime_error>("Operator", "CompressTemporal",
+                                          "GetReferenceInfo",
+                                          "invalid temporal buffer version");
+    }
+    bufferInOffset += 2; // skip two reserved bytes
+    info.Versioned = true;
+    info.Generation = GetHeaderValue<uint64_t>(bufferIn, bufferInOffset);
+    info.Distance = GetHeaderValue<uint64_t>(bufferIn, bufferInOffset);
+    return info;
+}
+
+size_t CompressTemporal::InverseOperate(const char *bufferIn,
+                                        const size_t sizeIn, char *dataOut)
+{
+    return InverseOperateFrom(bufferIn, sizeIn, nullptr, dataOut);
+}
+
+size_t CompressTemporal::InverseOperateFrom(const char *bufferIn,
+                                            const size_t sizeIn,
+                                            const char *reference,
+                                            char *dataOut)
+{
+    const ReferenceInfo info = GetReferenceInfo(bufferIn, sizeIn);
+    if (info.Distance > 0 && reference == nullptr)
+    {
+        helper::Throw<std::runtime_error>(
+            "Operator", "CompressTemporal", "InverseOperate",
+            "block version " + std::to_string(info.Generation) +
+                " is stored as the difference to the previous version, "
+                "which was not read. Read all steps in order, or open the "
+                "BP5 file in ReadRandomAccess mode.");
+    }
+    return DecodeV1(bufferIn, sizeIn, info.Distance > 0 ? reference : nullptr,
+                    dataOut);
+}
+
+bool CompressTemporal::IsDataTypeValid(const DataType type) const
+{
+    return type != DataType::None && type != DataType::String &&
+           type != DataType::Struct;
+}
+
+size_t CompressTemporal::DecodeV1(const char *bufferIn, const size_t sizeIn,
+                                  const char *reference, char *dataOut)
+{
+    size_t bufferInOffset = 4 + 8 + 8; // common header, generation, distance
+    const size_t elementSize =
+        GetHeaderValue<uint8_t>(bufferIn, bufferInOffset);
+    const uint8_t encoding =
+        GetHeaderValue<uint8_t>(bufferIn, bufferInOffset);
+    const size_t sizeOut =
+        GetHeaderValue<uint64_t>(bufferIn, bufferInOffset);
+    const char *payload = bufferIn + HeaderSizeV1;
+    const size_t payloadSize = sizeIn - HeaderSizeV1;
+
+    if (encoding == Stored)
+    {
+        if (payloadSize != sizeOut)
+        {
+            helper::Throw<std::runtime_error>(
+                "Operator", "CompressTemporal", "InverseOperate",
+                "corrupted temporal buffer");
+        }
+        std::memcpy(dataOut, payload, sizeOut);
+        return sizeOut;
+    }
+
+    std::vector<char> shuffled(sizeOut);
+    if (encoding == ZeroRuns)
+    {
+        DecodeZeroRuns(payload, payloadSize, shuffled.data(), sizeOut);
+    }
+    else if (encoding == Backend)
+    {
+        Decompress(payload, payloadSize, shuffled.data());
+    }
+    else
+    {
+        helper::Throw<std::runtime_error>("Operator", "CompressTemporal",
+                                          "InverseOperate",
+                                          "invalid temporal encoding");
+    }
+
+    const size_t elements = elementSize ? sizeOut / elementSize : 0;
+    for (size_t b = 0; b < elementSize; ++b)
+    {
+        const char *in = shuffled.data() + b * elements;
+        char *out = dataOut + b;
+        if (reference)
+        {
+            const char *ref = reference + b;
+            for (size_t e = 0; e < elements; ++e)
+            {
+                out[e * elementSize] = in[e] ^ ref[e * elementSize];
+            }
+        }
+        else
+        {
+            for (size_t e = 0; e < elements; ++e)
+            {
+                out[e * elementSize] = in[e];
+            }
+        }
+    }
+    return sizeOut;
+}
+
+} // end namespace compress
+} // end namespace core
+} // end namespace adios2
@@ -0,0 +1,107 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * CompressTemporal.h : lossless compression of a block as the difference to
+ * the previous version of the same block, with periodic keyframes
+ *
+ */
+
+#ifndef ADIOS2_OPERATOR_COMPRESS_COMPRESSTEMPORAL_H_
+#define ADIOS2_OPERATOR_COMPRESS_COMPRESSTEMPORAL_H_
+
+#include "adios2/core/Operator.h"
+
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace adios2
+{
+namespace core
+{
+namespace compress
+{
+
+/**
+ * Keeps the last version of every block it operated on, keyed by the block's
+ * start and count, and writes the XOR of the new version with it. The result
+ * is byte-shuffled by element size, so the bytes that did not change line up
+ * in zero runs, and entropy coded by a zero-run length encoding or by another
+ * operator given with the "backend" parameter. Every "keyframeInterval"
+ * versions (and whenever the encoding does not pay off) the block is written
+ * on its own, so a reader decodes any version from at most
+ * keyframeInterval - 1 earlier versions.
+ */
+class CompressTemporal : public Operator
+{
+
+public:
+    /**
+     * Unique constructor
+     */
+    CompressTemporal(const Params &parameters);
+
+    ~CompressTemporal() = default;
+
+    /**
+     * @param dataIn
+     * @param blockStart
+     * @param blockCount
+     * @param type
+     * @param bufferOut
+     * @return size of compressed buffer
+     */
+    size_t Operate(const char *dataIn, const Dims &blockStart,
+                   const Dims &blockCount, const DataType type,
+                   char *bufferOut) final;
+
+    /**
+     * Decodes keyframes only, deltas need InverseOperateFrom
+     * @param bufferIn
+     * @param sizeIn
+     * @param dataOut
+     * @return size of decompressed buffer
+     */
+    size_t InverseOperate(const char *bufferIn, const size_t sizeIn,
+                          char *dataOut) final;
+
+    size_t InverseOperateFrom(const char *bufferIn, const size_t sizeIn,
+                              const char *reference, char *dataOut) final;
+
+    ReferenceInfo GetReferenceInfo(const char *bufferIn,
+                                   const size_t sizeIn) const final;
+
+    bool IsDataTypeValid(const DataType type) const final;
+
+private:
+    enum Encoding : uint8_t
+    {
+        Stored = 0,   // raw block, always a keyframe
+        ZeroRuns = 1, // shuffled delta, zero-run length encoded
+        Backend = 2   // shuffled delta, compressed by the backend operator
+    };
+
+    struct BlockReference
+    {
+        std::vector<char> Data;
+        size_t ElementSize = 0;
+        size_t Generation = 0;
+        size_t Distance = 0;
+    };
+
+    /** last version of each block, by block start and count */
+    std::map<std::pair<Dims, Dims>, BlockReference> m_References;
+
+    std::shared_ptr<Operator> m_Backend;
+
+    size_t DecodeV1(const char *bufferIn, const size_t sizeIn,
+                    const char *reference, char *dataOut);
+};
+
+} // end namespace compress
+} // end namespace core
+} // end namespace adios2
+
+#endif /* ADIOS2_OPERATOR_COMPRESS_COMPRESSTEMPORAL_H_ */
@@ -12,6 +12,7 @@
 #include "adios2/helper/adiosMemory.h" // PaddingToAlignOffset
 
 #include <iostream>
+#include <new> // placement new
 
 namespace adios2
 {
@@ -270,7 +271,130 @@ void MPIShmChain::CreateShm(size_t blocksize, const size_t maxsegmentsize,
               << " bufB = " << static_cast<void *>(m_Shm->bufB) << std::endl;*/
 }
 
-void MPIShmChain::DestroyShm() { m_Comm.Win_free(m_Win); }
+void MPIShmChain::DestroyShm()
+{
+    m_Comm.Win_free(m_Win);
+    m_Ring = nullptr;
+    m_RingBuf = nullptr;
+}
+
+void MPIShmChain::CreateShmRing(const size_t nslots, size_t slotsize,
+                                const size_t maxsegmentsize,
+                                const size_t alignment_size)
+{
+    if (!m_Comm.IsMPI())
+    {
+        helper::Throw<std::runtime_error>(
+            "Toolkit", "aggregator::mpi::MPIShmChain", "CreateShmRing",
+            "called with a non-MPI communicator");
+    }
+    if (nslots == 0)
+    {
+        helper::Throw<std::invalid_argument>(
+            "Toolkit", "aggregator::mpi::MPIShmChain", "CreateShmRing",
+            "the number of shared memory slots must be at least 1");
+    }
+    {
+        std::atomic<uint64_t> a;
+        if (!a.is_lock_free())
+        {
+            helper::Throw<std::runtime_error>(
+                "Toolkit", "aggregator::mpi::MPIShmChain", "CreateShmRing",
+                "64-bit atomics are not lock-free on this platform, they "
+                "cannot be shared between processes");
+        }
+    }
+
+    size_t structsize = nslots * sizeof(ShmRingSlot);
+    structsize += helper::PaddingToAlignOffset(structsize, alignment_size);
+    // every process computes the same slot size
+    if (maxsegmentsize > structsize + nslots * alignment_size)
+    {
+        const size_t maxslot = (maxsegmentsize - structsize) / nslots;
+        if (slotsize > maxslot)
+        {
+            slotsize = maxslot - maxslot % alignment_size;
+        }
+    }
+    else
+    {
+        slotsize = alignment_size;
+    }
+    slotsize += helper::PaddingToAlignOffset(slotsize, alignment_size);
+    if (slotsize == 0)
+    {
+        slotsize = alignment_size;
+    }
+
+    char *ptr;
+    if (!m_Rank)
+    {
+        m_Win = m_Comm.Win_allocate_shared(structsize + nslots * slotsize, 1,
+                                           &ptr);
+    }
+    else
+    {
+        m_Win = m_Comm.Win_allocate_shared(0, 1, &ptr);
+        size_t shmsize;
+        int disp_unit;
+        m_Comm.Win_shared_query(m_Win, 0, &shmsize, &disp_unit, &ptr);
+    }
+    m_Ring = reinterpret_cast<ShmRingSlot *>(ptr);
+    m_RingBuf = ptr + structsize;
+    m_RingSlots = nslots;
+    m_RingSlotSize = slotsize;
+
+    if (!m_Rank)
+    {
+        for (size_t i = 0; i < nslots; ++i)
+        {
+            ShmRingSlot *slot = new (&m_Ring[i]) ShmRingSlot;
+            slot->filled.store(0, std::memory_order_relaxed);
+            slot->chunk.store(i, std::memory_order_release);
+        }
+    }
+    // producers must not look at the slots before they are initialized
+    m_Comm.Barrier("barrier after shm ring creation in MPIShmChain");
+}
+
+/*
+   The ring is handed over slot by slot without locks. A slot holds chunk k
+   until the Consumer has written it out, then it holds chunk k + slots. The
+   Consumer resets 'filled' before it publishes the next chunk number, so a
+   Producer who sees its chunk in the slot also sees the empty slot.
+*/
+
+char *MPIShmChain::LockProducerChunk(const uint64_t chunk)
+{
+    ShmRingSlot &slot = m_Ring[chunk % m_RingSlots];
+    while (slot.chunk.load(std::memory_order_acquire) != chunk)
+    {
+        std::this_thread::sleep_for(std::chrono::duration<double>(0.00001));
+    }
+    return m_RingBuf + (chunk % m_RingSlots) * m_RingSlotSize;
+}
+
+void MPIShmChain::FilledProducerChunk(const uint64_t chunk, const size_t n)
+{
+    m_Ring[chunk % m_RingSlots].filled.fetch_add(n, std::memory_order_release);
+}
+
+char *MPIShmChain::LockConsumerChunk(const uint64_t chunk, const size_t size)
+{
+    ShmRingSlot &slot = m_Ring[chunk % m_RingSlots];
+    while (slot.filled.load(std::memory_order_acquire) < size)
+    {
+        std::this_thread::sleep_for(std::chrono::duration<double>(0.00001));
+    }
+    return m_RingBuf + (chunk % m_RingSlots) * m_RingSlotSize;
+}
+
+void MPIShmChain::UnlockConsumerChunk(const uint64_t chunk)
+{
+    ShmRingSlot &slot = m_Ring[chunk % m_RingSlots];
+    slot.filled.store(0, std::memory_order_relaxed);
+    slot.chunk.store(chunk + m_RingSlots, std::memory_order_release);
+}
 
 /*
    The buffering strategy is the following.
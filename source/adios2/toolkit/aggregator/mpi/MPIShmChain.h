@@ -114,6 +114,31 @@ public:
                    const size_t alignment_size);
     void DestroyShm();
 
+    /*
+        Ring of slots in shared memory, used by the synchronous TwoLevelShm
+        writer. The data of the non-aggregators is one stream (in rank order),
+        cut into chunks of the slot size, chunk k goes into slot k % slots.
+        Producers copy into the current chunk of a slot concurrently, at
+        disjoint offsets, while the aggregator drains the chunks in order.
+    */
+
+    /* slotsize is aligned and capped so that the segment fits in
+     * maxsegmentsize, every process must pass the same arguments */
+    void CreateShmRing(const size_t nslots, size_t slotsize,
+                       const size_t maxsegmentsize,
+                       const size_t alignment_size);
+    /* size of a slot, valid after CreateShmRing */
+    size_t RingSlotSize() const noexcept { return m_RingSlotSize; }
+
+    /* Producer: wait until chunk is in its slot, return the slot buffer */
+    char *LockProducerChunk(const uint64_t chunk);
+    /* Producer: n bytes have been copied into the chunk */
+    void FilledProducerChunk(const uint64_t chunk, const size_t n);
+    /* Consumer: wait until size bytes are in chunk, return the slot buffer */
+    char *LockConsumerChunk(const uint64_t chunk, const size_t size);
+    /* Consumer: chunk is written, hand over its slot to chunk + slots */
+    void UnlockConsumerChunk(const uint64_t chunk);
+
 private:
     struct HandshakeStruct
     {
@@ -154,6 +179,18 @@ private:
     ShmSegment *m_Shm;
     char *m_ShmBufA;
     char *m_ShmBufB;
+
+    struct ShmRingSlot
+    {
+        // chunk of the stream the slot holds now
+        std::atomic<uint64_t> chunk;
+        // bytes of the chunk copied in so far
+        std::atomic<uint64_t> filled;
+    };
+    ShmRingSlot *m_Ring = nullptr;
+    char *m_RingBuf = nullptr;
+    size_t m_RingSlots = 0;
+    size_t m_RingSlotSize = 0;
 };
 
 } // end namespace aggregator
@@ -58,6 +58,22 @@ public:
         size_t *DataLengths;  // Per-block Lengths [BlockCount]
     } MetaArrayRecOperator;
 
+    /* Follows the MinMax field when sub-block statistics are enabled */
+    struct SubBlockStatsRec
+    {
+        size_t SubBlockSize;    // Requested elements per sub-block
+        size_t MinMaxCount;     // 2 * total sub-blocks of all blocks
+        size_t *SubBlockCounts; // Per-block sub-block count [BlockCount]
+        void *MinMaxs;          // Sub-block min/max pairs    [MinMaxCount]
+    };
+
+    /* With the DeduplicateBlocks writer parameter, the DataLocation of a
+     * block that is identical to the writer's block of the previous step
+     * holds the absolute position of the earlier copy in the writer's data
+     * subfile, marked by this bit, instead of an offset in the step's data */
+    static const size_t DataLocationInFile = (size_t)1
+                                             << (sizeof(size_t) * 8 - 1);
+
     struct BP5MetadataInfoStruct
     {
         size_t BitFieldCount;
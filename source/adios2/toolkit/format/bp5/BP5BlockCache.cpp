@@ -0,0 +1,90 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BP5BlockCache.cpp
+ */
+
+#include "BP5BlockCache.h"
+
+namespace adios2
+{
+namespace format
+{
+
+BP5BlockCache::BP5BlockCache(const size_t capacity) : m_Capacity(capacity) {}
+
+size_t BP5BlockCache::KeyHash::operator()(const Key &key) const noexcept
+{
+    size_t h = std::hash<size_t>()(key.Step);
+    h = h * 31 + std::hash<size_t>()(key.WriterRank);
+    h = h * 31 + std::hash<size_t>()(key.VarNum);
+    h = h * 31 + std::hash<size_t>()(key.Block);
+    return h;
+}
+
+BP5BlockCache::EntryPtr BP5BlockCache::Lookup(const Key &key,
+                                              const size_t offset,
+                                              const size_t length)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Index.find(key);
+    if (it == m_Index.end())
+    {
+        ++m_Stats.Misses;
+        return nullptr;
+    }
+    const EntryPtr &entry = it->second->second;
+    if (offset < entry->OffsetInBlock ||
+        offset + length > entry->OffsetInBlock + entry->Data.size())
+    {
+        ++m_Stats.Misses;
+        return nullptr;
+    }
+    m_LRU.splice(m_LRU.begin(), m_LRU, it->second);
+    ++m_Stats.Hits;
+    m_Stats.HitBytes += length;
+    return entry;
+}
+
+void BP5BlockCache::Insert(const Key &key, EntryPtr entry)
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    auto it = m_Index.find(key);
+    if (it != m_Index.end())
+    {
+        Erase(it);
+    }
+    const size_t size = entry->Data.size();
+    if (size > m_Capacity)
+    {
+        return;
+    }
+    while (m_Stats.Bytes + size > m_Capacity)
+    {
+        Erase(m_Index.find(m_LRU.back().first));
+        ++m_Stats.Evictions;
+    }
+    m_LRU.emplace_front(key, std::move(entry));
+    m_Index[key] = m_LRU.begin();
+    m_Stats.Bytes += size;
+}
+
+BP5BlockCache::Stats BP5BlockCache::GetStats() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    return m_Stats;
+}
+
+size_t BP5BlockCache::Capacity() const noexcept { return m_Capacity; }
+
+void BP5BlockCache::Erase(
+    std::unordered_map<Key, LRUList::iterator, KeyHash>::iterator it)
+{
+    m_Stats.Bytes -= it->second->second->Data.size();
+    m_LRU.erase(it->second);
+    m_Index.erase(it);
+}
+
+} // end namespace format
+} // end namespace adios2
@@ -0,0 +1,103 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * BP5BlockCache.h
+ *
+ * Memory-bounded LRU cache of block data for BP5Deserializer
+ */
+
+#ifndef ADIOS2_TOOLKIT_FORMAT_BP5_BP5BLOCKCACHE_H_
+#define ADIOS2_TOOLKIT_FORMAT_BP5_BP5BLOCKCACHE_H_
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace adios2
+{
+namespace format
+{
+
+/**
+ * Keeps recently read blocks in memory so that repeated Gets of the same
+ * block skip the read and, for operated variables, the decompression.
+ * An entry holds either a whole decompressed block or a raw byte span of an
+ * uncompressed block starting at OffsetInBlock.
+ * Lookups and insertions may come from different threads.
+ */
+class BP5BlockCache
+{
+public:
+    struct Key
+    {
+        size_t Step;
+        size_t WriterRank;
+        size_t VarNum;
+        size_t Block;
+
+        bool operator==(const Key &other) const noexcept
+        {
+            return Step == other.Step && WriterRank == other.WriterRank &&
+                   VarNum == other.VarNum && Block == other.Block;
+        }
+    };
+
+    struct Entry
+    {
+        size_t OffsetInBlock = 0;
+        std::vector<char> Data;
+    };
+    using EntryPtr = std::shared_ptr<const Entry>;
+
+    struct Stats
+    {
+        size_t Hits = 0;
+        size_t Misses = 0;
+        size_t Evictions = 0;
+        size_t HitBytes = 0; ///< bytes served from the cache
+        size_t Bytes = 0;    ///< bytes currently held
+    };
+
+    explicit BP5BlockCache(const size_t capacity);
+    ~BP5BlockCache() = default;
+
+    /**
+     * Returns the entry holding bytes [offset, offset + length) of the block
+     * and marks it most recently used, or nullptr (counted as a miss)
+     */
+    EntryPtr Lookup(const Key &key, const size_t offset, const size_t length);
+
+    /** Adds or replaces the entry for key, evicting least recently used
+     * entries to stay within capacity. Entries larger than the capacity
+     * are not kept. */
+    void Insert(const Key &key, EntryPtr entry);
+
+    Stats GetStats() const;
+
+    size_t Capacity() const noexcept;
+
+private:
+    struct KeyHash
+    {
+        size_t operator()(const Key &key) const noexcept;
+    };
+
+    using LRUList = std::list<std::pair<Key, EntryPtr>>;
+
+    const size_t m_Capacity;
+    LRUList m_LRU; ///< front is most recently used
+    std::unordered_map<Key, LRUList::iterator, KeyHash> m_Index;
+    Stats m_Stats;
+    mutable std::mutex m_Mutex;
+
+    void Erase(std::unordered_map<Key, LRUList::iterator, KeyHash>::iterator);
+};
+
+} // end namespace format
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_FORMAT_BP5_BP5BLOCKCACHE_H_ */
@@ -46,6 +46,8 @@ namespace format
 {
 static void ApplyElementMinMax(MinMaxStruct &MinMax, DataType Type,
                                void *Element);
+static bool MinMaxOverlaps(const DataType Type, const void *MinMaxPair,
+                           const MinMaxStruct &Filter);
 
 void BP5Deserializer::InstallMetaMetaData(MetaMetaInfoBlock &MM)
 {
@@ -170,7 +172,8 @@ void BP5Deserializer::BreakdownVarName(const char *Name, char **base_name_p,
 
 void BP5Deserializer::BreakdownArrayName(const char *Name, char **base_name_p,
                                          DataType *type_p, int *element_size_p,
-                                         char **Operator, bool *MinMax)
+                                         char **Operator, bool *MinMax,
+                                         bool *SubBlockMinMax)
 {
     int Type;
     int ElementSize;
@@ -180,6 +183,7 @@ void BP5Deserializer::BreakdownArrayName(const char *Name, char **base_name_p,
     const char *Plus = index(Name, '+');
     *Operator = NULL;
     *MinMax = false;
+    *SubBlockMinMax = false;
     while (Plus && (*Plus == '+'))
     {
         int Len;
@@ -196,6 +200,15 @@ void BP5Deserializer::BreakdownArrayName(const char *Name, char **base_name_p,
             *MinMax = true;
             Plus += 3;
         }
+        else if (strncmp(Plus, "+SB", 3) == 0)
+        {
+            *SubBlockMinMax = true;
+            Plus += 3;
+        }
+        else
+        {
+            break;
+        }
     }
     *element_size_p = ElementSize;
     *type_p = (DataType)Type;
@@ -282,8 +295,10 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
             int ElementSize;
             char *Operator = NULL;
             bool MinMax = false;
+            bool SubBlockMinMax = false;
             BreakdownArrayName(FieldList[i + 4].field_name, &ArrayName, &Type,
-                               &ElementSize, &Operator, &MinMax);
+                               &ElementSize, &Operator, &MinMax,
+                               &SubBlockMinMax);
             VarRec = LookupVarByName(ArrayName);
             if (!VarRec)
             {
@@ -306,6 +321,12 @@ BP5Deserializer::ControlInfo *BP5Deserializer::BuildControl(FMFormat Format)
                 VarRec->MinMaxOffset = MetaRecFields * sizeof(void *);
                 MetaRecFields++;
             }
+            if (SubBlockMinMax)
+            {
+                // the four fields of SubBlockStatsRec
+                VarRec->SubBlockOffset = MetaRecFields * sizeof(void *);
+                MetaRecFields += 4;
+            }
             i += MetaRecFields;
             free(ArrayName);
         }
@@ -988,6 +1009,17 @@ bool BP5Deserializer::QueueGetSingle(core::VariableBase &variable,
         Req.Step = Step;
         Req.MemSpace = MemSpace;
         Req.Data = DestData;
+        Req.HasValueFilter = variable.m_HasValueFilter;
+        Req.ValueFilter = variable.m_ValueFilter;
+        Req.Stride = variable.m_Stride;
+        if (!Req.Stride.empty() && (MemSpace != MemorySpace::Host))
+        {
+            helper::Throw<std::invalid_argument>(
+                "Toolkit", "format::BP5Deserializer", "QueueGetSingle",
+                "strided selections are only supported into host memory, "
+                "variable " +
+                    variable.m_Name);
+        }
         PendingRequests.push_back(Req);
     }
     else if ((variable.m_SelectionType == adios2::SelectionType::WriteBlock) ||
@@ -1082,6 +1114,610 @@ static size_t CalcBlockLength(const size_t dimensionsSize, const size_t *count)
     return len;
 }
 
+/*
+ * With a value filter on the request and sub-block statistics in the
+ * metadata, read only the sub-blocks of this block whose min/max overlap
+ * the filter and that intersect the selection.  Contiguous sub-blocks are
+ * contiguous in row-major memory, so each one is a single read.  Returns
+ * false if the block must be read the regular way.
+ */
+bool BP5Deserializer::GenerateSubBlockReadRequests(
+    const BP5ArrayRequest &Req, size_t ReqIndex, size_t WriterRank,
+    MetaArrayRec *writer_meta_base, size_t Block,
+    std::vector<ReadRequest> &Ret) const
+{
+    if (!Req.HasValueFilter || (Req.VarRec->SubBlockOffset == SIZE_MAX) ||
+        (Req.VarRec->Operator != NULL) || !m_WriterIsRowMajor ||
+        !m_ReaderIsRowMajor || (Req.MemSpace != MemorySpace::Host))
+    {
+        return false;
+    }
+    const SubBlockStatsRec *SB =
+        (const SubBlockStatsRec *)(((char *)writer_meta_base) +
+                                   Req.VarRec->SubBlockOffset);
+    if (!SB->SubBlockCounts || (SB->SubBlockCounts[Block] == 0))
+    {
+        return false;
+    }
+    size_t MMPos = 0;
+    for (size_t B = 0; B < Block; B++)
+    {
+        MMPos += SB->SubBlockCounts[B];
+    }
+    const size_t DimCount = Req.VarRec->DimCount;
+    const size_t ElemSize = helper::GetDataTypeSize(Req.VarRec->Type);
+    const size_t *BlockOffsets = &writer_meta_base->Offsets[Block * DimCount];
+    const Dims BlockCount(&writer_meta_base->Count[Block * DimCount],
+                          &writer_meta_base->Count[(Block + 1) * DimCount]);
+    const helper::BlockDivisionInfo Div = helper::DivideBlock(
+        BlockCount, SB->SubBlockSize, helper::BlockDivisionMethod::Contiguous);
+    if (Div.NBlocks != SB->SubBlockCounts[Block])
+    {
+        return false;
+    }
+    for (unsigned int SubBlock = 0; SubBlock < Div.NBlocks; SubBlock++)
+    {
+        const char *MinMaxPair =
+            (const char *)SB->MinMaxs + 2 * (MMPos + SubBlock) * ElemSize;
+        if (!MinMaxOverlaps(Req.VarRec->Type, MinMaxPair, Req.ValueFilter))
+        {
+            continue;
+        }
+        const Box<Dims> Sub = helper::GetSubBlock(BlockCount, Div, SubBlock);
+        std::array<size_t, helper::MAX_DIMS> substart;
+        std::array<size_t, helper::MAX_DIMS> intersectionstart;
+        std::array<size_t, helper::MAX_DIMS> intersectioncount;
+        for (size_t Dim = 0; Dim < DimCount; Dim++)
+        {
+            substart[Dim] = BlockOffsets[Dim] + Sub.first[Dim];
+        }
+        if (!IntersectionStartCount(DimCount, Req.Start.data(),
+                                    Req.Count.data(), &substart[0],
+                                    Sub.second.data(), &intersectionstart[0],
+                                    &intersectioncount[0]))
+        {
+            continue;
+        }
+        const size_t StartOffsetInBlock =
+            ElemSize * LinearIndex(DimCount, BlockCount.data(),
+                                   Sub.first.data(), true);
+        ReadRequest RR;
+        RR.Timestep = Req.Step;
+        RR.WriterRank = WriterRank;
+        RR.StartOffset =
+            writer_meta_base->DataLocation[Block] + StartOffsetInBlock;
+        RR.ReadLength = ElemSize * helper::GetTotalSize(Sub.second);
+        RR.DestinationAddr = (char *)malloc(RR.ReadLength);
+        RR.Internal = NULL;
+        RR.OffsetInBlock = StartOffsetInBlock;
+        RR.ReqIndex = ReqIndex;
+        RR.BlockID = Block;
+        RR.SubBlockID = SubBlock;
+        Ret.push_back(RR);
+    }
+    return true;
+}
+
+/*
+ * Row-major view of a strided request against one block: for each dimension
+ * the first selected index (relative to the selection) that falls in the
+ * block and the number of selected indices in it.  Returns false if no
+ * selected element is in the block.
+ */
+struct StridedBlockView
+{
+    Dims SelStart, SelCount, Stride, BlkStart, BlkCount;
+    Dims First, N;
+};
+
+static bool MakeStridedBlockView(const Dims &SelStart, const Dims &SelCount,
+                                 const Dims &Stride, const size_t *BlkStart,
+                                 const size_t *BlkCount, size_t DimCount,
+                                 bool IsRowMajor, StridedBlockView &V)
+{
+    V.SelStart = SelStart;
+    V.SelCount = SelCount;
+    V.Stride = Stride;
+    V.BlkStart.assign(BlkStart, BlkStart + DimCount);
+    V.BlkCount.assign(BlkCount, BlkCount + DimCount);
+    if (!IsRowMajor)
+    {
+        std::reverse(V.SelStart.begin(), V.SelStart.end());
+        std::reverse(V.SelCount.begin(), V.SelCount.end());
+        std::reverse(V.Stride.begin(), V.Stride.end());
+        std::reverse(V.BlkStart.begin(), V.BlkStart.end());
+        std::reverse(V.BlkCount.begin(), V.BlkCount.end());
+    }
+    V.First.resize(DimCount);
+    V.N.resize(DimCount);
+    for (size_t d = 0; d < DimCount; d++)
+    {
+        const size_t Lo = V.BlkStart[d];
+        const size_t Hi = V.BlkStart[d] + V.BlkCount[d];
+        if (Hi <= V.SelStart[d])
+        {
+            return false;
+        }
+        const size_t K0 = (Lo > V.SelStart[d])
+                              ? (Lo - V.SelStart[d] + V.Stride[d] - 1) /
+                                    V.Stride[d]
+                              : 0;
+        const size_t KEnd =
+            std::min(V.SelCount[d],
+                     (Hi - V.SelStart[d] + V.Stride[d] - 1) / V.Stride[d]);
+        if (K0 >= KEnd)
+        {
+            return false;
+        }
+        V.First[d] = K0;
+        V.N[d] = KEnd - K0;
+    }
+    return true;
+}
+
+/* element offset in the block of the first selected element of row Row */
+static size_t StridedRowOffset(const StridedBlockView &V, size_t Row,
+                               Dims &K)
+{
+    const size_t DimCount = V.N.size();
+    size_t Offset = 0;
+    size_t Pitch = 1;
+    K[DimCount - 1] = V.First[DimCount - 1];
+    for (size_t d = DimCount; d-- > 0;)
+    {
+        if (d < DimCount - 1)
+        {
+            K[d] = V.First[d] + Row % V.N[d];
+            Row /= V.N[d];
+        }
+        Offset += (V.SelStart[d] + K[d] * V.Stride[d] - V.BlkStart[d]) * Pitch;
+        Pitch *= V.BlkCount[d];
+    }
+    return Offset;
+}
+
+static size_t StridedRowCount(const StridedBlockView &V)
+{
+    size_t Rows = 1;
+    for (size_t d = 0; d + 1 < V.N.size(); d++)
+    {
+        Rows *= V.N[d];
+    }
+    return Rows;
+}
+
+/*
+ * For a strided request, read only the runs of the block that hold
+ * selected elements.  A run is a row of the fastest dimension from its first
+ * to its last selected element, or a single element when the stride gap
+ * exceeds the sieve threshold; runs separated by at most m_SieveThreshold
+ * bytes are merged into one read.  Operated blocks are read whole, the
+ * decimation happens when copying out of the decompressed block.
+ */
+bool BP5Deserializer::GenerateStridedReadRequests(
+    const BP5ArrayRequest &Req, size_t ReqIndex, size_t WriterRank,
+    MetaArrayRecOperator *writer_meta_base, size_t Block,
+    std::vector<ReadRequest> &Ret) const
+{
+    if (Req.Stride.empty())
+    {
+        return false;
+    }
+    const size_t DimCount = Req.VarRec->DimCount;
+    StridedBlockView V;
+    if (!MakeStridedBlockView(Req.Start, Req.Count, Req.Stride,
+                              &writer_meta_base->Offsets[Block * DimCount],
+                              &writer_meta_base->Count[Block * DimCount],
+                              DimCount, m_ReaderIsRowMajor, V))
+    {
+        return true;
+    }
+
+    ReadRequest RR;
+    RR.Timestep = Req.Step;
+    RR.WriterRank = WriterRank;
+    RR.Internal = NULL;
+    RR.ReqIndex = ReqIndex;
+    RR.BlockID = Block;
+    if (Req.VarRec->Operator != NULL)
+    {
+        RR.StartOffset = writer_meta_base->DataLocation[Block];
+        RR.ReadLength = writer_meta_base->DataLengths[Block];
+        RR.DestinationAddr = (char *)malloc(RR.ReadLength);
+        RR.OffsetInBlock = 0;
+        Ret.push_back(RR);
+        return true;
+    }
+
+    const size_t ElemSize = helper::GetDataTypeSize(Req.VarRec->Type);
+    const size_t Last = DimCount - 1;
+    const size_t Step = V.Stride[Last] * ElemSize;
+    const size_t RowLength = (V.N[Last] - 1) * Step + ElemSize;
+    const bool SplitRows = (Step - ElemSize > m_SieveThreshold);
+    const size_t Rows = StridedRowCount(V);
+    Dims K(DimCount);
+    size_t RunStart = 0, RunEnd = 0;
+    bool HaveRun = false;
+    auto lf_Flush = [&]() {
+        RR.StartOffset = writer_meta_base->DataLocation[Block] + RunStart;
+        RR.ReadLength = RunEnd - RunStart;
+        RR.DestinationAddr = (char *)malloc(RR.ReadLength);
+        RR.OffsetInBlock = RunStart;
+        Ret.push_back(RR);
+    };
+    auto lf_AddRun = [&](size_t Start, size_t End) {
+        if (HaveRun && (Start <= RunEnd + m_SieveThreshold))
+        {
+            RunEnd = End;
+            return;
+        }
+        if (HaveRun)
+        {
+            lf_Flush();
+        }
+        RunStart = Start;
+        RunEnd = End;
+        HaveRun = true;
+    };
+    for (size_t Row = 0; Row < Rows; Row++)
+    {
+        const size_t RowStart = ElemSize * StridedRowOffset(V, Row, K);
+        if (!SplitRows)
+        {
+            lf_AddRun(RowStart, RowStart + RowLength);
+            continue;
+        }
+        for (size_t J = 0; J < V.N[Last]; J++)
+        {
+            lf_AddRun(RowStart + J * Step, RowStart + J * Step + ElemSize);
+        }
+    }
+    if (HaveRun)
+    {
+        lf_Flush();
+    }
+    return true;
+}
+
+/*
+ * Copy the selected elements held by one strided read (a run of the block,
+ * or the whole decompressed block) into the user buffer.
+ */
+void BP5Deserializer::FinalizeStridedGet(const BP5ArrayRequest &Req,
+                                         const ReadRequest &Read,
+                                         MetaArrayRec *writer_meta_base)
+{
+    const size_t DimCount = Req.VarRec->DimCount;
+    const size_t ElemSize = Req.VarRec->ElementSize;
+    StridedBlockView V;
+    if (!MakeStridedBlockView(
+            Req.Start, Req.Count, Req.Stride,
+            &writer_meta_base->Offsets[Read.BlockID * DimCount],
+            &writer_meta_base->Count[Read.BlockID * DimCount], DimCount,
+            m_ReaderIsRowMajor, V))
+    {
+        return;
+    }
+
+    const char *BlockData = Read.DestinationAddr - Read.OffsetInBlock;
+    size_t DataStart = Read.OffsetInBlock;
+    size_t DataEnd = Read.OffsetInBlock + Read.ReadLength;
+    BP5BlockCache::EntryPtr Decompressed;
+    if (Req.VarRec->Operator != NULL)
+    {
+        Decompressed = DecompressBlock(Req, Read, writer_meta_base,
+                                       ElemSize *
+                                           helper::GetTotalSize(V.BlkCount));
+        BlockData = Decompressed->Data.data();
+        DataStart = 0;
+        DataEnd = Decompressed->Data.size();
+    }
+
+    const size_t Last = DimCount - 1;
+    const size_t Step = V.Stride[Last] * ElemSize;
+    const size_t Rows = StridedRowCount(V);
+    Dims K(DimCount);
+
+    // rows are ordered by offset, find the first one ending after DataStart
+    size_t Lo = 0, Hi = Rows;
+    while (Lo < Hi)
+    {
+        const size_t Mid = Lo + (Hi - Lo) / 2;
+        const size_t RowEnd = ElemSize * StridedRowOffset(V, Mid, K) +
+                              (V.N[Last] - 1) * Step + ElemSize;
+        if (RowEnd <= DataStart)
+        {
+            Lo = Mid + 1;
+        }
+        else
+        {
+            Hi = Mid;
+        }
+    }
+
+    char *Out = (char *)Req.Data;
+    for (size_t Row = Lo; Row < Rows; Row++)
+    {
+        const size_t RowStart = ElemSize * StridedRowOffset(V, Row, K);
+        if (RowStart >= DataEnd)
+        {
+            break;
+        }
+        const size_t J0 = (RowStart >= DataStart)
+                              ? 0
+                              : (DataStart - RowStart + Step - 1) / Step;
+        const size_t J1 =
+            std::min(V.N[Last] - 1, (DataEnd - ElemSize - RowStart) / Step);
+        if (J0 > J1)
+        {
+            continue;
+        }
+        size_t OutIndex = 0;
+        for (size_t d = 0; d < DimCount; d++)
+        {
+            OutIndex = OutIndex * V.SelCount[d] + K[d];
+        }
+        OutIndex += J0;
+        const char *In = BlockData + RowStart + J0 * Step;
+        if (V.Stride[Last] == 1)
+        {
+            std::memcpy(Out + OutIndex * ElemSize, In,
+                        (J1 - J0 + 1) * ElemSize);
+            continue;
+        }
+        for (size_t J = J0; J <= J1; J++, OutIndex++, In += Step)
+        {
+            std::memcpy(Out + OutIndex * ElemSize, In, ElemSize);
+        }
+    }
+}
+
+void BP5Deserializer::SetBlockCacheSize(const size_t bytes)
+{
+    if (bytes == 0)
+    {
+        m_BlockCache.reset();
+    }
+    else if (!m_BlockCache || m_BlockCache->Capacity() != bytes)
+    {
+        m_BlockCache.reset(new BP5BlockCache(bytes));
+    }
+}
+
+bool BP5Deserializer::GetBlockCacheStats(BP5BlockCache::Stats &stats) const
+{
+    if (!m_BlockCache)
+    {
+        return false;
+    }
+    stats = m_BlockCache->GetStats();
+    return true;
+}
+
+BP5BlockCache::Key
+BP5Deserializer::BlockCacheKey(const BP5ArrayRequest &Req,
+                               const ReadRequest &Read) const noexcept
+{
+    return {Req.Step, Read.WriterRank, Req.VarRec->VarNum, Read.BlockID};
+}
+
+/*
+ * Serve reads from the block cache where possible.  Operated blocks are
+ * cached decompressed and whole, plain blocks as the byte span last read.
+ * Sub-block reads and the sieved runs of strided selections are not cached.
+ */
+void BP5Deserializer::LookupBlockCache(std::vector<ReadRequest> &Reads)
+{
+    if (!m_BlockCache)
+    {
+        return;
+    }
+    for (auto &Read : Reads)
+    {
+        const BP5ArrayRequest &Req = PendingRequests[Read.ReqIndex];
+        const bool Operated = (Req.VarRec->Operator != NULL);
+        if (Read.SubBlockID != SIZE_MAX || (!Operated && !Req.Stride.empty()))
+        {
+            continue;
+        }
+        size_t Offset = Read.OffsetInBlock;
+        size_t Length = Read.ReadLength;
+        if (Operated)
+        {
+            MetaArrayRec *writer_meta_base = (MetaArrayRec *)GetMetadataBase(
+                Req.VarRec, Req.Step, Read.WriterRank);
+            const size_t DimCount = Req.VarRec->DimCount;
+            Offset = 0;
+            Length = Req.VarRec->ElementSize *
+                     helper::GetTotalSize(Dims(
+                         &writer_meta_base->Count[Read.BlockID * DimCount],
+                         &writer_meta_base->Count[(Read.BlockID + 1) *
+                                                  DimCount]));
+        }
+        Read.Cached =
+            m_BlockCache->Lookup(BlockCacheKey(Req, Read), Offset, Length);
+        if (Read.Cached)
+        {
+            free(Read.DestinationAddr);
+            Read.DestinationAddr = NULL;
+        }
+    }
+}
+
+/*
+ * Returns the decompressed block held by an operated read, from the block
+ * cache when it was there, and caches a newly decompressed one.
+ */
+BP5BlockCache::EntryPtr
+BP5Deserializer::DecompressBlock(const BP5ArrayRequest &Req,
+                                 const ReadRequest &Read,
+                                 MetaArrayRec *writer_meta_base,
+                                 const size_t DecompressedSize)
+{
+    if (Read.Cached)
+    {
+        return Read.Cached;
+    }
+    auto Block = std::make_shared<BP5BlockCache::Entry>();
+    Block->Data.resize(DecompressedSize);
+    DecodeOperatedBlock(Req.VarRec, Read.WriterRank, Read.Timestep,
+                        Read.BlockID, (MetaArrayRecOperator *)writer_meta_base,
+                        Read.DestinationAddr, Block->Data.data(),
+                        DecompressedSize);
+    if (m_BlockCache)
+    {
+        m_BlockCache->Insert(BlockCacheKey(Req, Read), Block);
+    }
+    return Block;
+}
+
+/*
+ * A block of a stateful operator with Distance > 0 decodes from the previous
+ * version of the same block (same writer, offsets and count). That is the
+ * last version decoded when reading step after step. Otherwise, in random
+ * access mode, the earlier versions back to the nearest keyframe (or to the
+ * last decoded one) are read from the preceding steps and decoded forward.
+ */
+void BP5Deserializer::DecodeOperatedBlock(
+    const BP5VarRec *VarRec, size_t WriterRank, size_t Step, size_t BlockID,
+    MetaArrayRecOperator *writer_meta_base, const char *In, char *Out,
+    size_t OutSize)
+{
+    const size_t InSize = writer_meta_base->DataLengths[BlockID];
+    core::Operator::OperatorType Type;
+    std::memcpy(&Type, In, 1);
+    std::shared_ptr<core::Operator> Op =
+        core::MakeOperator(core::OperatorTypeToString(Type), {});
+    const core::Operator::ReferenceInfo Info =
+        Op->GetReferenceInfo(In, InSize);
+    if (!Info.Versioned)
+    {
+        Op->InverseOperate(In, InSize, Out);
+        return;
+    }
+
+    const size_t DimCount = writer_meta_base->Dims;
+    auto BlockKey = [&](MetaArrayRecOperator *Meta, size_t Block) {
+        std::vector<size_t> Dims(Meta->Count + Block * DimCount,
+                                 Meta->Count + (Block + 1) * DimCount);
+        if (Meta->Offsets)
+        {
+            Dims.insert(Dims.end(), Meta->Offsets + Block * DimCount,
+                        Meta->Offsets + (Block + 1) * DimCount);
+        }
+        return Dims;
+    };
+    const BlockReferenceKey Key(VarRec, WriterRank,
+                                BlockKey(writer_meta_base, BlockID));
+    BlockReference &Last = m_BlockReferences[Key];
+    const bool HaveLast = (Last.Data.size() == OutSize);
+
+    const char *Reference = nullptr;
+    std::vector<char> Earlier;
+    if (Info.Distance > 0 && HaveLast &&
+        Last.Generation + 1 == Info.Generation)
+    {
+        Reference = Last.Data.data();
+    }
+    else if (Info.Distance > 0 && m_RandomAccessMode && m_ReadDataCallback)
+    {
+        // decode forward from the keyframe, or from the last decoded
+        // version when it lies between the keyframe and this one
+        size_t Needed = Info.Distance;
+        const char *Start = nullptr;
+        if (HaveLast && Last.Generation < Info.Generation &&
+            Last.Generation >= Info.Generation - Info.Distance)
+        {
+            Needed = Info.Generation - 1 - Last.Generation;
+            Start = Last.Data.data();
+        }
+
+        struct Version
+        {
+            size_t Step;
+            size_t BlockID;
+            MetaArrayRecOperator *Meta;
+        };
+        std::vector<Version> Versions; // newest first
+        MetaArrayRecOperator *Meta = writer_meta_base;
+        size_t S = Step;
+        size_t B = BlockID;
+        while (Versions.size() < Needed)
+        {
+            if (B == 0)
+            {
+                Meta = nullptr;
+                while (!Meta && S > 0)
+                {
+                    --S;
+                    if (WriterRank < WriterCohortSize(S))
+                    {
+                        Meta = (MetaArrayRecOperator *)GetMetadataBase(
+                            const_cast<BP5VarRec *>(VarRec), S, WriterRank);
+                    }
+                }
+                if (!Meta)
+                {
+                    break;
+                }
+                B = Meta->BlockCount;
+                continue;
+            }
+            --B;
+            if (Meta->Dims == DimCount &&
+                BlockKey(Meta, B) == std::get<2>(Key))
+            {
+                Versions.push_back({S, B, Meta});
+            }
+        }
+        if (Versions.size() < Needed)
+        {
+            helper::Throw<std::runtime_error>(
+                "Toolkit", "format::BP5Deserializer", "DecodeOperatedBlock",
+                "could not find the earlier versions of a block of variable " +
+                    std::string(VarRec->VarName) + " it was encoded against");
+        }
+
+        std::vector<char> Compressed;
+        std::vector<char> Decoded(OutSize);
+        if (Start)
+        {
+            Earlier.assign(Start, Start + OutSize);
+        }
+        size_t Generation = Info.Generation - Needed;
+        for (auto it = Versions.rbegin(); it != Versions.rend(); ++it)
+        {
+            const size_t Length = it->Meta->DataLengths[it->BlockID];
+            Compressed.resize(Length);
+            m_ReadDataCallback(WriterRank, it->Step,
+                               it->Meta->DataLocation[it->BlockID], Length,
+                               Compressed.data());
+            const core::Operator::ReferenceInfo VersionInfo =
+                Op->GetReferenceInfo(Compressed.data(), Length);
+            if (VersionInfo.Generation != Generation)
+            {
+                helper::Throw<std::runtime_error>(
+                    "Toolkit", "format::BP5Deserializer",
+                    "DecodeOperatedBlock",
+                    "the earlier versions of a block of variable " +
+                        std::string(VarRec->VarName) + " are out of sequence");
+            }
+            Op->InverseOperateFrom(Compressed.data(), Length,
+                                   Earlier.empty() ? nullptr : Earlier.data(),
+                                   Decoded.data());
+            Earlier.swap(Decoded);
+            Decoded.resize(OutSize);
+            ++Generation;
+        }
+        Reference = Earlier.data();
+    }
+
+    // without a reference the operator reports why it can not decode
+    Op->InverseOperateFrom(In, InSize, Reference, Out);
+    Last.Generation = Info.Generation;
+    Last.Data.assign(Out, Out + OutSize);
+}
+
 std::vector<BP5Deserializer::ReadRequest>
 BP5Deserializer::GenerateReadRequests()
 {
@@ -1118,10 +1754,19 @@ BP5Deserializer::GenerateReadRequests()
                     RR.StartOffset =
                         writer_meta_base->DataLocation[NeededBlock];
 
-                    RR.ReadLength =
-                        helper::GetDataTypeSize(Req->VarRec->Type) *
-                        CalcBlockLength(Req->VarRec->DimCount,
-                                        &writer_meta_base->Count[StartDim]);
+                    if (Req->VarRec->Operator != NULL)
+                    {
+                        // the whole operated block, decoded in FinalizeGets
+                        RR.ReadLength =
+                            writer_meta_base->DataLengths[NeededBlock];
+                    }
+                    else
+                    {
+                        RR.ReadLength =
+                            helper::GetDataTypeSize(Req->VarRec->Type) *
+                            CalcBlockLength(Req->VarRec->DimCount,
+                                            &writer_meta_base->Count[StartDim]);
+                    }
                     RR.DestinationAddr = (char *)malloc(RR.ReadLength);
                     RR.Internal = NULL;
                     RR.OffsetInBlock = 0;
@@ -1149,6 +1794,12 @@ BP5Deserializer::GenerateReadRequests()
                 for (size_t Block = 0; Block < writer_meta_base->BlockCount;
                      Block++)
                 {
+                    if (GenerateStridedReadRequests(*Req, ReqIndex, WriterRank,
+                                                    writer_meta_base, Block,
+                                                    Ret))
+                    {
+                        continue;
+                    }
                     std::array<size_t, helper::MAX_DIMS> intersectionstart;
                     std::array<size_t, helper::MAX_DIMS> intersectioncount;
 
@@ -1177,6 +1828,13 @@ BP5Deserializer::GenerateReadRequests()
                             RR.OffsetInBlock = 0;
                             Ret.push_back(RR);
                         }
+                        else if (GenerateSubBlockReadRequests(
+                                     *Req, ReqIndex, WriterRank,
+                                     (MetaArrayRec *)writer_meta_base, Block,
+                                     Ret))
+                        {
+                            // only sub-blocks matching the value filter
+                        }
                         else
                         {
                             for (size_t Dim = 0; Dim < Req->VarRec->DimCount;
@@ -1224,17 +1882,41 @@ BP5Deserializer::GenerateReadRequests()
             }
         }
     }
+    LookupBlockCache(Ret);
     return Ret;
 }
 
+BP5Deserializer::GetRequests BP5Deserializer::DetachPendingRequests()
+{
+    GetRequests Requests;
+    Requests.swap(PendingRequests);
+    return Requests;
+}
+
 void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Reads)
+{
+    FinalizeGets(Reads, PendingRequests);
+    PendingRequests.clear();
+}
+
+void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> &Reads,
+                                   const GetRequests &Requests)
 {
     for (const auto &Read : Reads)
     {
-        auto Req = PendingRequests[Read.ReqIndex];
+        const auto &Req = Requests[Read.ReqIndex];
         int ElementSize = Req.VarRec->ElementSize;
         MetaArrayRec *writer_meta_base = (MetaArrayRec *)GetMetadataBase(
             Req.VarRec, Req.Step, Read.WriterRank);
+        if (!Req.Stride.empty())
+        {
+            FinalizeStridedGet(Req, Read, writer_meta_base);
+            if (!Read.MappedData)
+            {
+                free((char *)Read.DestinationAddr);
+            }
+            continue;
+        }
 
         size_t *GlobalDimensions = writer_meta_base->Shape;
         int DimCount = writer_meta_base->Dims;
@@ -1248,7 +1930,7 @@ void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Reads)
         const size_t *SelSize = NULL;
         char *IncomingData = Read.DestinationAddr;
         char *VirtualIncomingData = Read.DestinationAddr - Read.OffsetInBlock;
-        std::vector<char> decompressBuffer;
+        BP5BlockCache::EntryPtr Decompressed;
         if (Req.VarRec->Operator != NULL)
         {
             size_t DestSize = Req.VarRec->ElementSize;
@@ -1258,14 +1940,25 @@ void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Reads)
                     writer_meta_base
                         ->Count[dim + Read.BlockID * writer_meta_base->Dims];
             }
-            decompressBuffer.resize(DestSize);
-            core::Decompress(IncomingData,
-                             ((MetaArrayRecOperator *)writer_meta_base)
-                                 ->DataLengths[Read.BlockID],
-                             decompressBuffer.data());
-            IncomingData = decompressBuffer.data();
+            Decompressed =
+                DecompressBlock(Req, Read, writer_meta_base, DestSize);
+            IncomingData = const_cast<char *>(Decompressed->Data.data());
             VirtualIncomingData = IncomingData;
         }
+        else if (Read.Cached)
+        {
+            VirtualIncomingData = const_cast<char *>(Read.Cached->Data.data()) -
+                                  Read.Cached->OffsetInBlock;
+            IncomingData = VirtualIncomingData + Read.OffsetInBlock;
+        }
+        else if (m_BlockCache && Read.SubBlockID == SIZE_MAX)
+        {
+            auto Span = std::make_shared<BP5BlockCache::Entry>();
+            Span->OffsetInBlock = Read.OffsetInBlock;
+            Span->Data.assign(Read.DestinationAddr,
+                              Read.DestinationAddr + Read.ReadLength);
+            m_BlockCache->Insert(BlockCacheKey(Req, Read), std::move(Span));
+        }
         if (Req.Start.size())
         {
             SelOffset = Req.Start.data();
@@ -1294,6 +1987,24 @@ void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Reads)
 
         auto inStart = adios2::Dims(RankOffset, RankOffset + DimCount);
         auto inCount = adios2::Dims(RankSize, RankSize + DimCount);
+        if (Read.SubBlockID != SIZE_MAX)
+        {
+            // the read holds just this sub-block, a box inside the block
+            const SubBlockStatsRec *SB =
+                (const SubBlockStatsRec *)(((char *)writer_meta_base) +
+                                           Req.VarRec->SubBlockOffset);
+            const helper::BlockDivisionInfo Div =
+                helper::DivideBlock(inCount, SB->SubBlockSize,
+                                    helper::BlockDivisionMethod::Contiguous);
+            const Box<Dims> Sub = helper::GetSubBlock(
+                inCount, Div, static_cast<unsigned int>(Read.SubBlockID));
+            for (int i = 0; i < DimCount; i++)
+            {
+                inStart[i] += Sub.first[i];
+            }
+            inCount = Sub.second;
+            VirtualIncomingData = IncomingData;
+        }
         auto outStart = adios2::Dims(SelOffset, SelOffset + DimCount);
         auto outCount = adios2::Dims(SelSize, SelSize + DimCount);
         if (!m_ReaderIsRowMajor)
@@ -1308,9 +2019,11 @@ void BP5Deserializer::FinalizeGets(std::vector<ReadRequest> Reads)
                        (char *)Req.Data, outStart, outCount, true, true,
                        ElementSize, Dims(), Dims(), Dims(), Dims(), false,
                        Req.MemSpace);
-        free((char *)Read.DestinationAddr);
+        if (!Read.MappedData)
+        {
+            free((char *)Read.DestinationAddr);
+        }
     }
-    PendingRequests.clear();
 }
 
 void BP5Deserializer::MapGlobalToLocalIndex(size_t Dims,
@@ -1539,6 +2252,13 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t Step)
             MMs = *(MinMaxStruct **)(((char *)writer_meta_base) +
                                      VarRec->MinMaxOffset);
         }
+        const SubBlockStatsRec *SB = NULL;
+        size_t SBPos = 0;
+        if (VarRec->SubBlockOffset != SIZE_MAX)
+        {
+            SB = (const SubBlockStatsRec *)(((char *)writer_meta_base) +
+                                            VarRec->SubBlockOffset);
+        }
         for (size_t i = 0; i < WriterBlockCount; i++)
         {
             size_t *Offsets = NULL;
@@ -1565,6 +2285,14 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t Step)
                 ApplyElementMinMax(Blk.MinMax, VarRec->Type,
                                    (void *)BlockMaxAddr);
             }
+            if (SB && SB->SubBlockCounts)
+            {
+                Blk.SubBlockSize = SB->SubBlockSize;
+                Blk.SubBlockCount = SB->SubBlockCounts[i];
+                Blk.SubBlockMinMax =
+                    ((char *)SB->MinMaxs) + 2 * SBPos * VarRec->ElementSize;
+                SBPos += Blk.SubBlockCount;
+            }
             // Blk.BufferP
             MV->BlocksInfo.push_back(Blk);
         }
@@ -1572,6 +2300,27 @@ MinVarInfo *BP5Deserializer::MinBlocksInfo(const VariableBase &Var, size_t Step)
     return MV;
 }
 
+static bool MinMaxOverlaps(const DataType Type, const void *MinMaxPair,
+                           const MinMaxStruct &Filter)
+{
+    if ((Type == DataType::Char) || (Type == DataType::Int8))
+    {
+        const int8_t *MM = (const int8_t *)MinMaxPair;
+        return !((MM[1] < Filter.MinUnion.field_int8) ||
+                 (MM[0] > Filter.MaxUnion.field_int8));
+    }
+#define pertype(T, N)                                                          \
+    else if (Type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        const T *MM = (const T *)MinMaxPair;                                   \
+        return !((MM[1] < Filter.MinUnion.field_##N) ||                        \
+                 (MM[0] > Filter.MaxUnion.field_##N));                         \
+    }
+    ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+    return true;
+}
+
 static void ApplyElementMinMax(MinMaxStruct &MinMax, DataType Type,
                                void *Element)
 {
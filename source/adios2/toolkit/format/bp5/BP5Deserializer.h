@@ -14,10 +14,15 @@
 #include "adios2/core/Variable.h"
 
 #include "BP5Base.h"
+#include "BP5BlockCache.h"
 #include "atl.h"
 #include "ffs.h"
 #include "fm.h"
 
+#include <functional>
+#include <map>
+#include <tuple>
+
 #ifdef _WIN32
 #pragma warning(disable : 4250)
 #endif
@@ -49,6 +54,12 @@ public:
         size_t ReqIndex;
         size_t OffsetInBlock;
         size_t BlockID;
+        size_t SubBlockID = SIZE_MAX; // set when only a sub-block is read
+        /** set when the block cache holds the data, nothing is to be read */
+        BP5BlockCache::EntryPtr Cached;
+        /** DestinationAddr was replaced by the engine with memory it owns,
+         * e.g. a mapped file, and is not to be freed */
+        bool MappedData = false;
     };
     void InstallMetaMetaData(MetaMetaInfoBlock &MMList);
     void InstallMetaData(void *MetadataBlock, size_t BlockLen,
@@ -76,6 +87,21 @@ public:
     const bool m_WriterIsRowMajor;
     const bool m_ReaderIsRowMajor;
     core::Engine *m_Engine = NULL;
+    /** gaps of at most this many bytes between the runs of a strided
+     * selection are read rather than starting a new read */
+    size_t m_SieveThreshold = 4096;
+
+    /** enables the block cache with a capacity in bytes, 0 disables it */
+    void SetBlockCacheSize(const size_t bytes);
+    /** false when the block cache is disabled */
+    bool GetBlockCacheStats(BP5BlockCache::Stats &stats) const;
+
+    /** reads data of a writer rank in an earlier step, set by the engine to
+     * fetch the earlier versions of a block a stateful operator (e.g.
+     * temporal) encoded it against, used in random access mode */
+    std::function<void(size_t WriterRank, size_t Timestep, size_t StartOffset,
+                       size_t Length, char *Destination)>
+        m_ReadDataCallback;
 
 private:
     size_t m_VarCount = 0;
@@ -90,6 +116,7 @@ private:
         DataType Type;
         int ElementSize = 0;
         size_t MinMaxOffset = SIZE_MAX;
+        size_t SubBlockOffset = SIZE_MAX;
         size_t *GlobalDims = NULL;
         size_t LastTSAdded = SIZE_MAX;
         size_t FirstTSSeen = SIZE_MAX;
@@ -172,7 +199,8 @@ private:
                           DataType *type_p, int *element_size_p);
     void BreakdownArrayName(const char *Name, char **base_name_p,
                             DataType *type_p, int *element_size_p,
-                            char **Operator, bool *MinMax);
+                            char **Operator, bool *MinMax,
+                            bool *SubBlockMinMax);
     void *VarSetup(core::Engine *engine, const char *variableName,
                    const DataType type, void *data);
     void *ArrayVarSetup(core::Engine *engine, const char *variableName,
@@ -202,10 +230,62 @@ private:
         Dims Count;
         MemorySpace MemSpace;
         void *Data;
+        bool HasValueFilter = false;
+        MinMaxStruct ValueFilter;
+        Dims Stride; // empty unless the selection is strided
     };
     std::vector<BP5ArrayRequest> PendingRequests;
+
+public:
+    /** Get requests detached from the deserializer together with the reads
+     * generated for them, see DetachPendingRequests */
+    using GetRequests = std::vector<BP5ArrayRequest>;
+    /** Moves the queued Get requests out after GenerateReadRequests, so that
+     * they can be finalized on another thread while new Gets are queued */
+    GetRequests DetachPendingRequests();
+    void FinalizeGets(std::vector<ReadRequest> &Reads,
+                      const GetRequests &Requests);
+
+private:
     void *GetMetadataBase(BP5VarRec *VarRec, size_t Step,
                           size_t WriterRank) const;
+    bool GenerateSubBlockReadRequests(const BP5ArrayRequest &Req,
+                                      size_t ReqIndex, size_t WriterRank,
+                                      MetaArrayRec *writer_meta_base,
+                                      size_t Block,
+                                      std::vector<ReadRequest> &Ret) const;
+    bool GenerateStridedReadRequests(const BP5ArrayRequest &Req,
+                                     size_t ReqIndex, size_t WriterRank,
+                                     MetaArrayRecOperator *writer_meta_base,
+                                     size_t Block,
+                                     std::vector<ReadRequest> &Ret) const;
+    void FinalizeStridedGet(const BP5ArrayRequest &Req,
+                            const ReadRequest &Read,
+                            MetaArrayRec *writer_meta_base);
+    std::unique_ptr<BP5BlockCache> m_BlockCache;
+    BP5BlockCache::Key BlockCacheKey(const BP5ArrayRequest &Req,
+                                     const ReadRequest &Read) const noexcept;
+    void LookupBlockCache(std::vector<ReadRequest> &Reads);
+    BP5BlockCache::EntryPtr DecompressBlock(const BP5ArrayRequest &Req,
+                                            const ReadRequest &Read,
+                                            MetaArrayRec *writer_meta_base,
+                                            const size_t DecompressedSize);
+    /** last decoded version of each block written by a stateful operator,
+     * by variable, writer rank and block offsets and count */
+    struct BlockReference
+    {
+        size_t Generation = 0;
+        std::vector<char> Data;
+    };
+    using BlockReferenceKey =
+        std::tuple<const BP5VarRec *, size_t, std::vector<size_t>>;
+    std::map<BlockReferenceKey, BlockReference> m_BlockReferences;
+    /** decompresses an operated block, reconstructing blocks that were
+     * encoded against earlier versions of themselves */
+    void DecodeOperatedBlock(const BP5VarRec *VarRec, size_t WriterRank,
+                             size_t Step, size_t BlockID,
+                             MetaArrayRecOperator *writer_meta_base,
+                             const char *In, char *Out, size_t OutSize);
     size_t CurTimestep = 0;
 };
 
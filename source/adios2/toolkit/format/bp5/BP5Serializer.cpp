@@ -258,7 +258,8 @@ static char *BuildShortName(const ShapeID Shape, const int Index,
 
 static char *BuildLongName(const char *base_name, const ShapeID Shape,
                            const int type, const int element_size,
-                           const char *Operator, bool MinMax)
+                           const char *Operator, bool MinMax,
+                           bool SubBlockMinMax)
 {
     const char *Prefix = NamePrefix(Shape);
     int Len = strlen(base_name) + 3 + strlen(Prefix) + 16;
@@ -278,6 +279,12 @@ static char *BuildLongName(const char *base_name, const ShapeID Shape,
         Ret = (char *)realloc(Ret, Len);
         strcat(Ret, "+MM");
     }
+    if (SubBlockMinMax)
+    {
+        Len += 3;
+        Ret = (char *)realloc(Ret, Len);
+        strcat(Ret, "+SB");
+    }
     strcat(Ret, "_");
     strcat(Ret, base_name);
     return Ret;
@@ -450,11 +457,17 @@ BP5Serializer::CreateWriterRec(void *Variable, const char *Name, DataType Type,
         {
             OperatorType = strdup((VB->m_Operations[0])->m_TypeString.data());
         }
+        const bool SubBlockStats = (m_StatsLevel > 0) &&
+                                   (m_StatsBlockSize > 0) &&
+                                   (Type != DataType::String) &&
+                                   (Type != DataType::FloatComplex) &&
+                                   (Type != DataType::DoubleComplex) &&
+                                   (Type != DataType::Struct);
         // Array field.  To Metadata, add FMFields for DimCount, Shape, Count
         // and Offsets matching _MetaArrayRec
-        char *LongName =
-            BuildLongName(Name, VB->m_ShapeID, (int)Type, ElemSize,
-                          OperatorType, /* minmax */ (m_StatsLevel > 0));
+        char *LongName = BuildLongName(
+            Name, VB->m_ShapeID, (int)Type, ElemSize, OperatorType,
+            /* minmax */ (m_StatsLevel > 0), SubBlockStats);
         char *DimsName = BuildShortName(VB->m_ShapeID, Info.RecCount, "Dims");
         char *BlockCountName =
             BuildShortName(VB->m_ShapeID, Info.RecCount, "BlockCount");
@@ -470,6 +483,14 @@ BP5Serializer::CreateWriterRec(void *Variable, const char *Name, DataType Type,
             BuildShortName(VB->m_ShapeID, Info.RecCount, "DataLengths");
         char *MinMaxName =
             BuildShortName(VB->m_ShapeID, Info.RecCount, "MinMax");
+        char *SBSizeName =
+            BuildShortName(VB->m_ShapeID, Info.RecCount, "SubBlockSize");
+        char *SBMMCountName =
+            BuildShortName(VB->m_ShapeID, Info.RecCount, "SubBlockMMCount");
+        char *SBCountsName =
+            BuildShortName(VB->m_ShapeID, Info.RecCount, "SubBlockCounts");
+        char *SBMinMaxName =
+            BuildShortName(VB->m_ShapeID, Info.RecCount, "SubBlockMinMax");
         AddField(&Info.MetaFields, &Info.MetaFieldCount, DimsName,
                  DataType::Int64, sizeof(size_t));
         Rec->MetaOffset = Info.MetaFields[Info.MetaFieldCount - 1].field_offset;
@@ -498,6 +519,22 @@ BP5Serializer::CreateWriterRec(void *Variable, const char *Name, DataType Type,
             Rec->MinMaxOffset = Offset;
             AddDoubleArrayField(&Info.MetaFields, &Info.MetaFieldCount,
                                 MinMaxName, Type, ElemSize, BlockCountName);
+            Offset += sizeof(void *);
+        }
+        Rec->SubBlockOffset = SIZE_MAX;
+        if (SubBlockStats)
+        {
+            // fields of SubBlockStatsRec
+            Rec->SubBlockOffset = Offset;
+            AddField(&Info.MetaFields, &Info.MetaFieldCount, SBSizeName,
+                     DataType::Int64, sizeof(size_t));
+            AddField(&Info.MetaFields, &Info.MetaFieldCount, SBMMCountName,
+                     DataType::Int64, sizeof(size_t));
+            AddVarArrayField(&Info.MetaFields, &Info.MetaFieldCount,
+                             SBCountsName, DataType::Int64, sizeof(size_t),
+                             BlockCountName);
+            AddVarArrayField(&Info.MetaFields, &Info.MetaFieldCount,
+                             SBMinMaxName, Type, ElemSize, SBMMCountName);
         }
         Rec->OperatorType = OperatorType;
         free(LongName);
@@ -510,6 +547,10 @@ BP5Serializer::CreateWriterRec(void *Variable, const char *Name, DataType Type,
         free(LocationsName);
         free(LengthsName);
         free(MinMaxName);
+        free(SBSizeName);
+        free(SBMMCountName);
+        free(SBCountsName);
+        free(SBMinMaxName);
         RecalcMarshalStorageSize();
 
         // Changing the formats renders these invalid
@@ -563,10 +604,134 @@ void BP5Serializer::DumpDeferredBlocks(bool forceCopyDeferred)
             CurDataBuffer->AddToVec(Def.DataSize, Def.Data, Def.AlignReq,
                                     forceCopyDeferred);
         MetaEntry->DataLocation[Def.BlockID] = DataOffset;
+        if (m_DeduplicateBlocks)
+        {
+            auto it = m_DedupCurrent.find(
+                std::make_pair(Def.MetaOffset, Def.BlockID));
+            if (it != m_DedupCurrent.end())
+            {
+                it->second.Location = DataOffset;
+            }
+        }
     }
     DeferredExterns.clear();
 }
 
+static inline uint64_t Rotl64(const uint64_t x, const int r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static inline uint64_t FMix64(uint64_t k)
+{
+    k ^= k >> 33;
+    k *= 0xff51afd7ed558ccdULL;
+    k ^= k >> 33;
+    k *= 0xc4ceb9fe1a85ec53ULL;
+    k ^= k >> 33;
+    return k;
+}
+
+/* 128-bit MurmurHash3 (x64 variant) of a data block */
+static void HashBlock(const void *Data, const size_t Size, uint64_t Hash[2])
+{
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+    const char *p = static_cast<const char *>(Data);
+    uint64_t h1 = 0, h2 = 0, k1, k2;
+
+    const size_t nblocks = Size / 16;
+    for (size_t i = 0; i < nblocks; i++, p += 16)
+    {
+        std::memcpy(&k1, p, sizeof(k1));
+        std::memcpy(&k2, p + 8, sizeof(k2));
+        k1 *= c1;
+        k1 = Rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        h1 = Rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+        k2 *= c2;
+        k2 = Rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        h2 = Rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    const size_t tail = Size & 15;
+    k1 = 0;
+    k2 = 0;
+    if (tail > 8)
+    {
+        std::memcpy(&k2, p + 8, tail - 8);
+        k2 *= c2;
+        k2 = Rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+    }
+    if (tail > 0)
+    {
+        std::memcpy(&k1, p, tail > 8 ? 8 : tail);
+        k1 *= c1;
+        k1 = Rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+    }
+
+    h1 ^= Size;
+    h2 ^= Size;
+    h1 += h2;
+    h2 += h1;
+    h1 = FMix64(h1);
+    h2 = FMix64(h2);
+    h1 += h2;
+    h2 += h1;
+    Hash[0] = h1;
+    Hash[1] = h2;
+}
+
+BP5Serializer::DedupRec *BP5Serializer::LookupDedup(const size_t MetaOffset,
+                                                    const size_t BlockID,
+                                                    const void *Data,
+                                                    const size_t Size)
+{
+    const auto Key = std::make_pair(MetaOffset, BlockID);
+    DedupRec &Rec = m_DedupCurrent[Key];
+    HashBlock(Data, Size, Rec.Hash);
+    Rec.Size = Size;
+    Rec.Location = 0;
+    Rec.InFile = false;
+
+    auto prev = m_DedupPrevious.find(Key);
+    if (prev != m_DedupPrevious.end() && prev->second.InFile &&
+        (prev->second.Size == Size) && (prev->second.Hash[0] == Rec.Hash[0]) &&
+        (prev->second.Hash[1] == Rec.Hash[1]))
+    {
+        Rec.Location = prev->second.Location;
+        Rec.InFile = true;
+    }
+    return &Rec;
+}
+
+void BP5Serializer::DataPlaced(const size_t StepDataOffset, const size_t Size,
+                               const uint64_t FilePos)
+{
+    for (auto &Entry : m_DedupCurrent)
+    {
+        DedupRec &Rec = Entry.second;
+        if (!Rec.InFile && (Rec.Location >= StepDataOffset) &&
+            (Rec.Location < StepDataOffset + Size))
+        {
+            Rec.Location = DataLocationInFile |
+                           (FilePos + (Rec.Location - StepDataOffset));
+            Rec.InFile = true;
+        }
+    }
+}
+
 static void GetMinMax(const void *Data, size_t ElemCount, const DataType Type,
                       MinMaxStruct &MinMax, MemorySpace MemSpace)
 {
@@ -599,6 +764,44 @@ static void GetMinMax(const void *Data, size_t ElemCount, const DataType Type,
     ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
 }
 
+/*
+ * Sub-block min/max pairs for one block, using the same contiguous
+ * division as BP4 so that readers can rebuild the sub-block boxes with
+ * helper::DivideBlock().  The block-level MinMax is produced in the same
+ * pass over the data.
+ */
+static void GetSubBlockMinMax(const void *Data, const size_t DimCount,
+                              const size_t *Count, const DataType Type,
+                              const size_t SubBlockSize, MinMaxStruct &MinMax,
+                              std::vector<char> &SubBlockMinMax,
+                              size_t &SubBlockCount)
+{
+    MinMax.Init(Type);
+    SubBlockMinMax.clear();
+    SubBlockCount = 0;
+    const Dims count(Count, Count + DimCount);
+    if (helper::GetTotalSize(count) == 0)
+        return;
+    const helper::BlockDivisionInfo info = helper::DivideBlock(
+        count, SubBlockSize, helper::BlockDivisionMethod::Contiguous);
+    if (Type == DataType::Struct)
+    {
+    }
+#define pertype(T, N)                                                          \
+    else if (Type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        std::vector<T> MinMaxs;                                                \
+        helper::GetMinMaxSubblocks((const T *)Data, count, info, MinMaxs,      \
+                                   MinMax.MinUnion.field_##N,                  \
+                                   MinMax.MaxUnion.field_##N, 1);              \
+        SubBlockCount = MinMaxs.size() / 2;                                    \
+        SubBlockMinMax.resize(MinMaxs.size() * sizeof(T));                     \
+        memcpy(SubBlockMinMax.data(), MinMaxs.data(), SubBlockMinMax.size());  \
+    }
+    ADIOS2_FOREACH_MINMAX_STDTYPE_2ARGS(pertype)
+#undef pertype
+}
+
 void BP5Serializer::Marshal(void *Variable, const char *Name,
                             const DataType Type, size_t ElemSize,
                             size_t DimCount, const size_t *Shape,
@@ -679,9 +882,22 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
 
         MinMaxStruct MinMax;
         MinMax.Init(Type);
+        std::vector<char> SubBlockMinMax;
+        size_t SubBlockCount = 0;
         if ((m_StatsLevel > 0) && !Span)
         {
-            GetMinMax(Data, ElemCount, (DataType)Rec->Type, MinMax, MemSpace);
+            if ((Rec->SubBlockOffset != SIZE_MAX) &&
+                (MemSpace == MemorySpace::Host))
+            {
+                GetSubBlockMinMax(Data, DimCount, Count, (DataType)Rec->Type,
+                                  m_StatsBlockSize, MinMax, SubBlockMinMax,
+                                  SubBlockCount);
+            }
+            else
+            {
+                GetMinMax(Data, ElemCount, (DataType)Rec->Type, MinMax,
+                          MemSpace);
+            }
         }
 
         if (Rec->OperatorType)
@@ -693,7 +909,11 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
             for (size_t i = 0; i < DimCount; i++)
             {
                 tmpCount.push_back(Count[i]);
-                tmpOffsets.push_back(Offsets[i]);
+                if (Offsets)
+                {
+                    // local arrays have no offsets
+                    tmpOffsets.push_back(Offsets[i]);
+                }
             }
             size_t AllocSize = ElemCount * ElemSize + 100;
             BufferV::BufferPos pos =
@@ -708,11 +928,29 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
         }
         else if (Span == nullptr)
         {
-            if (!DeferAddToVec)
+            DedupRec *Dedup = NULL;
+            if (m_DeduplicateBlocks && (MemSpace == MemorySpace::Host))
+            {
+                const size_t BlockID =
+                    AlreadyWritten ? MetaEntry->BlockCount : 0;
+                Dedup = LookupDedup(Rec->MetaOffset, BlockID, Data,
+                                    ElemCount * ElemSize);
+            }
+            if (Dedup && Dedup->InFile)
+            {
+                // unchanged since the previous step, point to that copy
+                DataOffset = Dedup->Location;
+                DeferAddToVec = false;
+            }
+            else if (!DeferAddToVec)
             {
                 DataOffset = m_PriorDataBufferSizeTotal +
                              CurDataBuffer->AddToVec(ElemCount * ElemSize, Data,
                                                      ElemSize, Sync, MemSpace);
+                if (Dedup)
+                {
+                    Dedup->Location = DataOffset;
+                }
             }
         }
         else
@@ -752,6 +990,19 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
                 memcpy(((char *)*MMPtrLoc) + ElemSize, &MinMax.MaxUnion,
                        ElemSize);
             }
+            if (Rec->SubBlockOffset != SIZE_MAX)
+            {
+                SubBlockStatsRec *SBEntry =
+                    (SubBlockStatsRec *)(((char *)MetaEntry) +
+                                         Rec->SubBlockOffset);
+                SBEntry->SubBlockSize = m_StatsBlockSize;
+                SBEntry->MinMaxCount = 2 * SubBlockCount;
+                SBEntry->SubBlockCounts = (size_t *)malloc(sizeof(size_t));
+                SBEntry->SubBlockCounts[0] = SubBlockCount;
+                SBEntry->MinMaxs = malloc(SubBlockMinMax.size() + 1);
+                memcpy(SBEntry->MinMaxs, SubBlockMinMax.data(),
+                       SubBlockMinMax.size());
+            }
             if (DeferAddToVec)
             {
                 DeferredExtern rec = {Rec->MetaOffset, 0, Data,
@@ -801,6 +1052,25 @@ void BP5Serializer::Marshal(void *Variable, const char *Name,
                            ElemSize * (2 * (MetaEntry->BlockCount - 1) + 1),
                        &MinMax.MaxUnion, ElemSize);
             }
+            if (Rec->SubBlockOffset != SIZE_MAX)
+            {
+                SubBlockStatsRec *SBEntry =
+                    (SubBlockStatsRec *)(((char *)MetaEntry) +
+                                         Rec->SubBlockOffset);
+                SBEntry->SubBlockCounts = (size_t *)realloc(
+                    SBEntry->SubBlockCounts,
+                    MetaEntry->BlockCount * sizeof(size_t));
+                SBEntry->SubBlockCounts[MetaEntry->BlockCount - 1] =
+                    SubBlockCount;
+                SBEntry->MinMaxs =
+                    realloc(SBEntry->MinMaxs,
+                            SBEntry->MinMaxCount * ElemSize +
+                                SubBlockMinMax.size() + 1);
+                memcpy(((char *)SBEntry->MinMaxs) +
+                           SBEntry->MinMaxCount * ElemSize,
+                       SubBlockMinMax.data(), SubBlockMinMax.size());
+                SBEntry->MinMaxCount += 2 * SubBlockCount;
+            }
             if (DeferAddToVec)
             {
                 DeferredExterns.push_back({Rec->MetaOffset,
@@ -879,6 +1149,11 @@ void BP5Serializer::InitStep(BufferV *DataBuffer)
     }
     CurDataBuffer = DataBuffer;
     m_PriorDataBufferSizeTotal = 0;
+    if (m_DeduplicateBlocks)
+    {
+        m_DedupPrevious.swap(m_DedupCurrent);
+        m_DedupCurrent.clear();
+    }
 }
 
 BufferV *BP5Serializer::ReinitStepData(BufferV *DataBuffer,
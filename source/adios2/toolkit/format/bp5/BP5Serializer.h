@@ -17,6 +17,9 @@
 #include "atl.h"
 #include "ffs.h"
 #include "fm.h"
+
+#include <map>
+#include <utility>
 #ifdef _WIN32
 #pragma warning(disable : 4250)
 #endif
@@ -108,6 +111,18 @@ public:
     size_t DebugGetDataBufferSize() const;
 
     int m_StatsLevel = 1;
+    /* elements per sub-block for sub-block min/max, 0 to disable */
+    size_t m_StatsBlockSize = 0;
+
+    /* reference unchanged blocks of the previous step instead of copying
+     * them, see DataLocationInFile */
+    bool m_DeduplicateBlocks = false;
+
+    /** Tells block deduplication that Size bytes of this step's data
+     * starting at StepDataOffset were written at FilePos of the data
+     * subfile */
+    void DataPlaced(const size_t StepDataOffset, const size_t Size,
+                    const uint64_t FilePos);
 
     /* Variables to help appending to existing file */
     size_t m_PreMetaMetadataFileLength = 0;
@@ -129,6 +144,7 @@ private:
         int DimCount;
         int Type;
         size_t MinMaxOffset;
+        size_t SubBlockOffset;
     } * BP5WriterRec;
 
     struct FFSWriterMarshalBase
@@ -156,6 +172,20 @@ private:
     };
     std::vector<DeferredExtern> DeferredExterns;
 
+    struct DedupRec
+    {
+        uint64_t Hash[2];
+        size_t Size;
+        size_t Location; // offset in step data, or position in file if InFile
+        bool InFile;
+    };
+    /* by (MetaOffset, BlockID) of the current and the previous step */
+    using DedupMap = std::map<std::pair<size_t, size_t>, DedupRec>;
+    DedupMap m_DedupCurrent;
+    DedupMap m_DedupPrevious;
+    DedupRec *LookupDedup(const size_t MetaOffset, const size_t BlockID,
+                          const void *Data, const size_t Size);
+
     FFSWriterMarshalBase Info;
     void *MetadataBuf = NULL;
     bool NewAttribute = false;
@@ -11,6 +11,7 @@
 #include "HDF5Common.h"
 #include "HDF5Common.tcc"
 
+#include <algorithm>
 #include <complex>
 #include <ios>
 #include <iostream>
@@ -49,6 +50,18 @@ const std::string HDF5Common::PARAMETER_COLLECTIVE = "H5CollectiveMPIO";
 const std::string HDF5Common::PARAMETER_CHUNK_FLAG = "H5ChunkDim";
 const std::string HDF5Common::PARAMETER_CHUNK_VARS = "H5ChunkVars";
 const std::string HDF5Common::PARAMETER_HAS_IDLE_WRITER_RANK = "IdleH5Writer";
+const std::string HDF5Common::PARAMETER_CHUNK_TARGET_SIZE = "H5ChunkTargetSize";
+const std::string HDF5Common::PARAMETER_CHUNK_CACHE_SIZE = "H5ChunkCacheSize";
+const std::string HDF5Common::PARAMETER_CHUNK_CACHE_SLOTS = "H5ChunkCacheSlots";
+const std::string HDF5Common::PARAMETER_CHUNK_CACHE_PREEMPTION =
+    "H5ChunkCachePreemption";
+const std::string HDF5Common::PARAMETER_ALIGNMENT = "H5Alignment";
+const std::string HDF5Common::PARAMETER_ALIGNMENT_THRESHOLD =
+    "H5AlignmentThreshold";
+const std::string HDF5Common::PARAMETER_COLLECTIVE_METADATA =
+    "H5CollectiveMetadata";
+const std::string HDF5Common::PARAMETER_PAGE_SIZE = "H5PageSize";
+const std::string HDF5Common::PARAMETER_PAGE_BUFFER_SIZE = "H5PageBufferSize";
 
 #define CHECK_H5_RETURN(returnCode, reason)                                    \
     {                                                                          \
@@ -119,11 +132,25 @@ void HDF5Common::ParseParameters(core::IO &io)
     m_ChunkVarNames.clear();
     m_ChunkPID = -1;
     m_ChunkDim = 0;
+    m_AutoChunk = false;
 
     {
         std::vector<hsize_t> chunkDim;
         auto chunkFlagKey = io.m_Parameters.find(PARAMETER_CHUNK_FLAG);
-        if (chunkFlagKey != io.m_Parameters.end())
+        if (chunkFlagKey != io.m_Parameters.end() &&
+            chunkFlagKey->second == "auto")
+        {
+            // chunk dims are derived per dataset in CreateAutoChunkProperty
+            m_AutoChunk = true;
+            auto itKey = io.m_Parameters.find(PARAMETER_CHUNK_TARGET_SIZE);
+            if (itKey != io.m_Parameters.end())
+            {
+                m_ChunkTargetSize = helper::StringToByteUnits(
+                    itKey->second, "for Parameter key=" + itKey->first +
+                                       " in HDF5 engine");
+            }
+        }
+        else if (chunkFlagKey != io.m_Parameters.end())
         { // note space is the delimiter
             std::stringstream ss(chunkFlagKey->second);
             int i;
@@ -140,7 +167,7 @@ void HDF5Common::ParseParameters(core::IO &io)
     //
     // if no chunk dim specified, then ignore this parameter
     //
-    if (-1 != m_ChunkPID)
+    if (-1 != m_ChunkPID || m_AutoChunk)
     {
         auto chunkVarKey = io.m_Parameters.find(PARAMETER_CHUNK_VARS);
         if (chunkVarKey != io.m_Parameters.end())
@@ -155,6 +182,189 @@ void HDF5Common::ParseParameters(core::IO &io)
     m_OrderByC = (io.m_ArrayOrder == ArrayOrdering::RowMajor);
 }
 
+void HDF5Common::ParseFileParameters(core::IO &io)
+{
+    auto lf_Bytes = [&](const std::string &key, size_t &value) {
+        auto itKey = io.m_Parameters.find(key);
+        if (itKey != io.m_Parameters.end())
+        {
+            value = helper::StringToByteUnits(
+                itKey->second,
+                "for Parameter key=" + key + " in HDF5 engine");
+        }
+    };
+
+    lf_Bytes(PARAMETER_CHUNK_CACHE_SIZE, m_ChunkCacheSize);
+    lf_Bytes(PARAMETER_ALIGNMENT, m_Alignment);
+    lf_Bytes(PARAMETER_ALIGNMENT_THRESHOLD, m_AlignmentThreshold);
+    lf_Bytes(PARAMETER_PAGE_SIZE, m_PageSize);
+    lf_Bytes(PARAMETER_PAGE_BUFFER_SIZE, m_PageBufferSize);
+
+    auto itKey = io.m_Parameters.find(PARAMETER_CHUNK_CACHE_SLOTS);
+    if (itKey != io.m_Parameters.end())
+    {
+        m_ChunkCacheSlots = helper::StringToSizeT(
+            itKey->second, "for Parameter key=" + itKey->first +
+                               " in HDF5 engine");
+    }
+
+    itKey = io.m_Parameters.find(PARAMETER_CHUNK_CACHE_PREEMPTION);
+    if (itKey != io.m_Parameters.end())
+    {
+        m_ChunkCachePreemption = helper::StringTo<double>(
+            itKey->second, "for Parameter key=" + itKey->first +
+                               " in HDF5 engine");
+        if (m_ChunkCachePreemption < 0.0 || m_ChunkCachePreemption > 1.0)
+        {
+            helper::Throw<std::invalid_argument>(
+                "Toolkit", "interop::hdf5::HDF5Common", "ParseFileParameters",
+                PARAMETER_CHUNK_CACHE_PREEMPTION + " must be in [0,1]");
+        }
+    }
+
+    itKey = io.m_Parameters.find(PARAMETER_COLLECTIVE_METADATA);
+    if (itKey != io.m_Parameters.end())
+    {
+        m_CollectiveMetadata =
+            (itKey->second == "yes" || itKey->second == "true");
+    }
+}
+
+void HDF5Common::SetFileAccessProperties(hid_t faplId)
+{
+    if (m_Alignment > 0)
+    {
+        CHECK_H5_RETURN(
+            H5Pset_alignment(faplId, m_AlignmentThreshold, m_Alignment),
+            "SetFileAccessProperties: H5Pset_alignment");
+    }
+
+    if (m_ChunkCacheSize > 0 || m_ChunkCacheSlots > 0 ||
+        m_ChunkCachePreemption >= 0.0)
+    {
+        // the file access cache is the default for every dataset opened or
+        // created in the file, so it covers reads and writes alike
+        int mdcElements;
+        size_t nSlots, nBytes;
+        double w0;
+        CHECK_H5_RETURN(H5Pget_cache(faplId, &mdcElements, &nSlots, &nBytes,
+                                     &w0),
+                        "SetFileAccessProperties: H5Pget_cache");
+        if (m_ChunkCacheSlots > 0)
+        {
+            nSlots = m_ChunkCacheSlots;
+        }
+        if (m_ChunkCacheSize > 0)
+        {
+            nBytes = m_ChunkCacheSize;
+        }
+        if (m_ChunkCachePreemption >= 0.0)
+        {
+            w0 = m_ChunkCachePreemption;
+        }
+        CHECK_H5_RETURN(H5Pset_cache(faplId, mdcElements, nSlots, nBytes, w0),
+                        "SetFileAccessProperties: H5Pset_cache");
+    }
+
+    if (m_CollectiveMetadata && m_MPI && m_CommSize > 1)
+    {
+        CHECK_H5_RETURN(m_MPI->set_coll_metadata(faplId, 1),
+                        "SetFileAccessProperties: collective metadata");
+    }
+
+#if H5_VERSION_GE(1, 10, 1)
+    // page buffering is not supported by the MPI-IO driver
+    if (m_PageSize > 0 && m_PageBufferSize > 0 && m_CommSize == 1)
+    {
+        CHECK_H5_RETURN(H5Pset_page_buffer_size(faplId, m_PageBufferSize, 0, 0),
+                        "SetFileAccessProperties: H5Pset_page_buffer_size");
+    }
+#endif
+}
+
+hid_t HDF5Common::CreateFileCreationProperties()
+{
+    if (m_PageSize == 0)
+    {
+        return H5P_DEFAULT;
+    }
+
+#if H5_VERSION_GE(1, 10, 1)
+    // paged aggregation: metadata and raw data are allocated in pages of
+    // m_PageSize bytes, which keeps small metadata writes together
+    hid_t fcplId = H5Pcreate(H5P_FILE_CREATE);
+    CHECK_H5_RETURN(
+        H5Pset_file_space_strategy(fcplId, H5F_FSPACE_STRATEGY_PAGE, 0, 1),
+        "CreateFileCreationProperties: H5Pset_file_space_strategy");
+    CHECK_H5_RETURN(H5Pset_file_space_page_size(fcplId, m_PageSize),
+                    "CreateFileCreationProperties: "
+                    "H5Pset_file_space_page_size");
+    return fcplId;
+#else
+    if (m_CommRank == 0)
+    {
+        std::cerr << "ADIOS2 HDF5 engine: " << PARAMETER_PAGE_SIZE
+                  << " requires HDF5 >= 1.10.1, ignored\n";
+    }
+    return H5P_DEFAULT;
+#endif
+}
+
+hid_t HDF5Common::CreateAutoChunkProperty(const std::vector<hsize_t> &dimsf,
+                                          size_t elementSize)
+{
+    if (!m_AutoChunk || dimsf.empty())
+    {
+        return -1;
+    }
+
+    std::vector<hsize_t> chunk(dimsf);
+    for (auto &d : chunk)
+    {
+        d = std::max<hsize_t>(d, 1);
+    }
+
+    auto lf_Elements = [&]() -> size_t {
+        size_t n = 1;
+        for (const auto d : chunk)
+        {
+            n *= static_cast<size_t>(d);
+        }
+        return n;
+    };
+    auto lf_NChunks = [&]() -> size_t {
+        size_t n = 1;
+        for (size_t i = 0; i < chunk.size(); ++i)
+        {
+            n *= static_cast<size_t>((std::max<hsize_t>(dimsf[i], 1) +
+                                      chunk[i] - 1) /
+                                     chunk[i]);
+        }
+        return n;
+    };
+
+    // halve the largest dimension until a chunk fits the target size and
+    // there are at least as many chunks as writers, so each writer's block
+    // maps to its own chunks. Depends only on shape and comm size, hence
+    // identical on all ranks.
+    while (lf_Elements() * elementSize > m_ChunkTargetSize ||
+           lf_NChunks() < static_cast<size_t>(m_CommSize))
+    {
+        auto itMax = std::max_element(chunk.begin(), chunk.end());
+        if (*itMax <= 1)
+        {
+            break;
+        }
+        *itMax = (*itMax + 1) / 2;
+    }
+
+    hid_t chunkPID = H5Pcreate(H5P_DATASET_CREATE);
+    CHECK_H5_RETURN(H5Pset_chunk(chunkPID, static_cast<int>(chunk.size()),
+                                 chunk.data()),
+                    "CreateAutoChunkProperty: H5Pset_chunk");
+    return chunkPID;
+}
+
 void HDF5Common::Append(const std::string &name, helper::Comm const &comm)
 {
     m_PropertyListId = H5Pcreate(H5P_FILE_ACCESS);
@@ -166,6 +376,7 @@ void HDF5Common::Append(const std::string &name, helper::Comm const &comm)
             m_MPI = mpi;
         }
     }
+    SetFileAccessProperties(m_PropertyListId);
 
     m_FileId = H5Fopen(name.c_str(), H5F_ACC_RDWR, m_PropertyListId);
     H5Pclose(m_PropertyListId);
@@ -217,6 +428,7 @@ void HDF5Common::Init(const std::string &name, helper::Comm const &comm,
             m_MPI = mpi;
         }
     }
+    SetFileAccessProperties(m_PropertyListId);
 
     // std::string ts0 = "/AdiosStep0";
     std::string ts0;
@@ -227,8 +439,13 @@ void HDF5Common::Init(const std::string &name, helper::Comm const &comm,
         /*
          * Create a new file collectively and release property list identifier.
          */
-        m_FileId = H5Fcreate(name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT,
+        hid_t fcplId = CreateFileCreationProperties();
+        m_FileId = H5Fcreate(name.c_str(), H5F_ACC_TRUNC, fcplId,
                              m_PropertyListId);
+        if (fcplId != H5P_DEFAULT)
+        {
+            H5Pclose(fcplId);
+        }
         if (m_FileId >= 0)
         {
             m_GroupId = H5Gcreate2(m_FileId, ts0.c_str(), H5P_DEFAULT,
@@ -979,7 +1196,8 @@ hid_t HDF5Common::GetTypeStringScalar(const std::string &input)
 
 void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type,
                                hid_t filespaceID,
-                               std::vector<hid_t> &datasetChain)
+                               std::vector<hid_t> &datasetChain,
+                               hid_t autoChunkPID)
 {
     std::vector<std::string> list;
     char delimiter = '/';
@@ -1024,6 +1242,12 @@ void HDF5Common::CreateDataset(const std::string &varName, hid_t h5Type,
         else if (m_ChunkVarNames.find(varName) != m_ChunkVarNames.end())
             varCreateProperty = m_ChunkPID;
     }
+    else if (-1 != autoChunkPID)
+    {
+        if (m_ChunkVarNames.empty() ||
+            m_ChunkVarNames.find(varName) != m_ChunkVarNames.end())
+            varCreateProperty = autoChunkPID;
+    }
 
     /*
     hid_t dsetID = H5Dcreate(topId, list.back().c_str(), h5Type, filespaceID,
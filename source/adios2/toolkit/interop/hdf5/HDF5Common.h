@@ -127,8 +127,23 @@ public:
     static const std::string PARAMETER_CHUNK_FLAG;
     static const std::string PARAMETER_CHUNK_VARS;
     static const std::string PARAMETER_HAS_IDLE_WRITER_RANK;
+    static const std::string PARAMETER_CHUNK_TARGET_SIZE;
+    static const std::string PARAMETER_CHUNK_CACHE_SIZE;
+    static const std::string PARAMETER_CHUNK_CACHE_SLOTS;
+    static const std::string PARAMETER_CHUNK_CACHE_PREEMPTION;
+    static const std::string PARAMETER_ALIGNMENT;
+    static const std::string PARAMETER_ALIGNMENT_THRESHOLD;
+    static const std::string PARAMETER_COLLECTIVE_METADATA;
+    static const std::string PARAMETER_PAGE_SIZE;
+    static const std::string PARAMETER_PAGE_BUFFER_SIZE;
 
     void ParseParameters(core::IO &io);
+    /*
+     * Parses the parameters that map to file access/creation properties
+     * (alignment, chunk cache, collective metadata, paged aggregation), must
+     * be called before Init/Append
+     */
+    void ParseFileParameters(core::IO &io);
     void Init(const std::string &name, helper::Comm const &comm, bool toWrite);
     void Append(const std::string &name, helper::Comm const &comm);
 
@@ -145,7 +160,8 @@ public:
     void DefineDataset(core::Variable<T> &variable);
 
     void CreateDataset(const std::string &varName, hid_t h5Type,
-                       hid_t filespaceID, std::vector<hid_t> &chain);
+                       hid_t filespaceID, std::vector<hid_t> &chain,
+                       hid_t autoChunkPID = -1);
     bool OpenDataset(const std::string &varName, std::vector<hid_t> &chain);
     void RemoveEmptyDataset(const std::string &varName);
     void StoreADIOSName(const std::string adiosName, hid_t dsetID);
@@ -234,6 +250,7 @@ public:
     {
         bool (*init)(helper::Comm const &comm, hid_t id, int *rank, int *size);
         herr_t (*set_dxpl_mpio)(hid_t dxpl_id, H5FD_mpio_xfer_t xfer_mode);
+        herr_t (*set_coll_metadata)(hid_t fapl_id, hbool_t collective);
     };
 
 private:
@@ -248,6 +265,16 @@ private:
     void WriteNonStringAttr(core::IO &io, core::Attribute<T> *adiosAttr,
                             hid_t parentID, const char *h5Name);
 
+    void SetFileAccessProperties(hid_t faplId);
+    hid_t CreateFileCreationProperties();
+
+    /*
+     * chunk dims derived from the global shape and the number of writers,
+     * identical on all ranks as H5Dcreate is collective, -1 if not applicable
+     */
+    hid_t CreateAutoChunkProperty(const std::vector<hsize_t> &dimsf,
+                                  size_t elementSize);
+
     template <class T>
     void GetHDF5SpaceSpec(const core::Variable<T> &variable,
                           std::vector<hsize_t> &, std::vector<hsize_t> &,
@@ -269,6 +296,18 @@ private:
     hid_t m_ChunkPID;
     int m_ChunkDim;
     std::set<std::string> m_ChunkVarNames;
+    bool m_AutoChunk = false;
+    size_t m_ChunkTargetSize = 1024 * 1024;
+
+    // file level tuning, 0 keeps the HDF5 default
+    size_t m_ChunkCacheSize = 0;
+    size_t m_ChunkCacheSlots = 0;
+    double m_ChunkCachePreemption = -1.0;
+    size_t m_Alignment = 0;
+    size_t m_AlignmentThreshold = 1;
+    bool m_CollectiveMetadata = false;
+    size_t m_PageSize = 0;
+    size_t m_PageBufferSize = 0;
     bool m_OrderByC = true; // C or fortran
 
     // Some write rank can be idle. This causes conflict with HDF5 collective
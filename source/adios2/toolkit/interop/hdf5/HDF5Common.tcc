@@ -46,9 +46,19 @@ void HDF5Common::DefineDataset(core::Variable<T> &variable)
     hid_t fileSpace = H5Screate_simple(dimSize, dimsf.data(), NULL);
     HDF5TypeGuard fs(fileSpace, E_H5_SPACE);
 
+    hid_t autoChunkPID = -1;
+    if (variable.m_ShapeID == ShapeID::GlobalArray)
+    {
+        autoChunkPID = CreateAutoChunkProperty(dimsf, sizeof(T));
+    }
+
     std::vector<hid_t> chain;
-    CreateDataset(variable.m_Name, h5Type, fileSpace, chain);
+    CreateDataset(variable.m_Name, h5Type, fileSpace, chain, autoChunkPID);
     HDF5DatasetGuard g(chain);
+    if (-1 != autoChunkPID)
+    {
+        H5Pclose(autoChunkPID);
+    }
 }
 
 template <>
@@ -180,10 +190,19 @@ void HDF5Common::Write(core::Variable<T> &variable, const T *values)
     hid_t fileSpace = H5Screate_simple(dimSize, dimsf.data(), NULL);
 #ifndef RELAY_DEFINE_TO_HDF5 // RELAY_DEFINE_TO_HDF5 = variables in io are
                              // created at begin_step
+    hid_t autoChunkPID = -1;
+    if (variable.m_ShapeID == ShapeID::GlobalArray)
+    {
+        autoChunkPID = CreateAutoChunkProperty(dimsf, sizeof(T));
+    }
     std::vector<hid_t> chain;
-    CreateDataset(variable.m_Name, h5Type, fileSpace, chain);
+    CreateDataset(variable.m_Name, h5Type, fileSpace, chain, autoChunkPID);
     hid_t dsetID = chain.back();
     HDF5DatasetGuard g(chain);
+    if (-1 != autoChunkPID)
+    {
+        H5Pclose(autoChunkPID);
+    }
 #else
     hid_t dsetID = H5Dopen(m_GroupId, variable.m_Name.c_str(), H5P_DEFAULT);
     HDF5TypeGuard k(dsetID, E_H5_DATASET);
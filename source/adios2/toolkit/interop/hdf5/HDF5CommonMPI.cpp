@@ -41,7 +41,18 @@ herr_t set_dxpl_mpio(hid_t dxpl_id, H5FD_mpio_xfer_t xfer_mode)
     return H5Pset_dxpl_mpio(dxpl_id, xfer_mode);
 }
 
-HDF5Common::MPI_API HDF5Common_MPI_API_Impl = {&init, &set_dxpl_mpio};
+herr_t set_coll_metadata(hid_t fapl_id, hbool_t collective)
+{
+    herr_t status = H5Pset_all_coll_metadata_ops(fapl_id, collective);
+    if (status < 0)
+    {
+        return status;
+    }
+    return H5Pset_coll_metadata_write(fapl_id, collective);
+}
+
+HDF5Common::MPI_API HDF5Common_MPI_API_Impl = {&init, &set_dxpl_mpio,
+                                               &set_coll_metadata};
 
 } // end anonymous namespace
 
@@ -11,6 +11,11 @@
 #include "IOChrono.h"
 #include "adios2/helper/adiosMemory.h"
 
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <numeric>
+
 namespace adios2
 {
 namespace profiling
@@ -45,16 +50,102 @@ JSONProfiler::JSONProfiler(helper::Comm const &comm) : m_Comm(comm)
     AddTimerWatch("meta_gather");
     AddTimerWatch("AWD");
     AddTimerWatch("WaitOnAsync");
+    AddTimerWatch("async_write", "async");
 
     m_Profiler.m_Bytes.emplace("buffering", 0);
 
     m_RankMPI = m_Comm.Rank();
 }
 
-void JSONProfiler::AddTimerWatch(const std::string &name)
+void JSONProfiler::AddTimerWatch(const std::string &name,
+                                 const std::string &lane)
 {
     const TimeUnit timerUnit = DefaultTimeUnitEnum;
     m_Profiler.m_Timers.emplace(name, profiling::Timer(name, timerUnit));
+
+    auto itLane = std::find_if(
+        m_TraceLanes.begin(), m_TraceLanes.end(),
+        [&lane](const TraceLane &traceLane) { return traceLane.Name == lane; });
+    if (itLane == m_TraceLanes.end())
+    {
+        m_TraceLanes.emplace_back();
+        m_TraceLanes.back().Name = lane;
+        itLane = m_TraceLanes.end() - 1;
+    }
+    m_TimerLanes[name] = itLane - m_TraceLanes.begin();
+}
+
+void JSONProfiler::EnableTrace(const size_t maxEvents)
+{
+    m_TraceMaxEvents = maxEvents;
+}
+
+void JSONProfiler::AddToMetrics(Metrics &metrics,
+                                const std::string &lane) const
+{
+    for (const auto &timerPair : m_Profiler.m_Timers)
+    {
+        const size_t l = m_TimerLanes.at(timerPair.first);
+        if (m_TraceLanes[l].Name != lane)
+        {
+            continue;
+        }
+        const Timer &timer = timerPair.second;
+        metrics[timer.m_Process + "_us"] =
+            static_cast<double>(timer.m_ProcessTime);
+        metrics[timer.m_Process + "_calls"] =
+            static_cast<double>(timer.m_nCalls);
+    }
+}
+
+namespace
+{
+int64_t TraceNow() noexcept
+{
+    // system clock, so events of different ranks share a time axis
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+}
+
+void JSONProfiler::Start(const std::string process)
+{
+    m_Profiler.Start(process);
+    if (m_TraceMaxEvents > 0)
+    {
+        const Timer &timer = m_Profiler.m_Timers.at(process);
+        TraceLane &lane = m_TraceLanes[m_TimerLanes.at(process)];
+        lane.Running[&timer.m_Process] = TraceNow();
+    }
+}
+
+void JSONProfiler::Stop(const std::string process)
+{
+    m_Profiler.Stop(process);
+    if (m_TraceMaxEvents > 0)
+    {
+        const Timer &timer = m_Profiler.m_Timers.at(process);
+        TraceLane &lane = m_TraceLanes[m_TimerLanes.at(process)];
+        auto itRunning = lane.Running.find(&timer.m_Process);
+        if (itRunning == lane.Running.end())
+        {
+            return;
+        }
+        const TraceEvent event{&timer.m_Process, itRunning->second,
+                               TraceNow() - itRunning->second};
+        lane.Running.erase(itRunning);
+
+        if (lane.Events.size() < m_TraceMaxEvents)
+        {
+            lane.Events.push_back(event);
+        }
+        else
+        {
+            lane.Events[lane.Recorded % m_TraceMaxEvents] = event;
+        }
+        ++lane.Recorded;
+    }
 }
 
 std::string JSONProfiler::GetRankProfilingJSON(
@@ -146,5 +237,97 @@ JSONProfiler::AggregateProfilingJSON(const std::string &rankLog) const
     return profilingJSON;
 }
 
+std::string JSONProfiler::GetRankTraceJSON(const int64_t timeBase) const
+{
+    const std::string pid(std::to_string(m_RankMPI));
+    std::string rankLog("{\"name\":\"process_name\", \"ph\":\"M\", \"pid\":" +
+                        pid + ", \"args\":{\"name\":\"rank " + pid + "\"}}");
+    rankLog += ",\n{\"name\":\"process_sort_index\", \"ph\":\"M\", \"pid\":" +
+               pid + ", \"args\":{\"sort_index\":" + pid + "}}";
+
+    for (size_t l = 0; l < m_TraceLanes.size(); ++l)
+    {
+        const TraceLane &lane = m_TraceLanes[l];
+        if (lane.Recorded == 0)
+        {
+            continue;
+        }
+        const std::string tid(std::to_string(l));
+        rankLog += ",\n{\"name\":\"thread_name\", \"ph\":\"M\", \"pid\":" +
+                   pid + ", \"tid\":" + tid + ", \"args\":{\"name\":\"" +
+                   lane.Name + "\", \"dropped_events\":" +
+                   std::to_string(lane.Recorded - lane.Events.size()) + "}}";
+
+        // oldest event first
+        const size_t first = lane.Events.size() < m_TraceMaxEvents
+                                 ? 0
+                                 : lane.Recorded % m_TraceMaxEvents;
+        for (size_t i = 0; i < lane.Events.size(); ++i)
+        {
+            const TraceEvent &event =
+                lane.Events[(first + i) % lane.Events.size()];
+            rankLog += ",\n{\"name\":\"" + *event.Name +
+                       "\", \"ph\":\"X\", \"pid\":" + pid +
+                       ", \"tid\":" + tid + ", \"ts\":" +
+                       std::to_string(event.Start - timeBase) +
+                       ", \"dur\":" + std::to_string(event.Duration) + "}";
+        }
+    }
+    return rankLog;
+}
+
+std::vector<char> JSONProfiler::AggregateTraceJSON() const
+{
+    // common time origin: the earliest event of all ranks
+    int64_t firstEvent = std::numeric_limits<int64_t>::max();
+    for (const auto &lane : m_TraceLanes)
+    {
+        for (const auto &event : lane.Events)
+        {
+            firstEvent = std::min(firstEvent, event.Start);
+        }
+    }
+    const int64_t timeBase = m_Comm.BroadcastValue(
+        m_Comm.ReduceValues(firstEvent, helper::Comm::Op::Min));
+
+    std::string rankLog(GetRankTraceJSON(timeBase));
+    if (m_RankMPI > 0)
+    {
+        rankLog.insert(0, ",\n");
+    }
+
+    const std::vector<size_t> rankLogsSizes =
+        m_Comm.GatherValues(rankLog.size());
+
+    const std::string header(
+        "{\"displayTimeUnit\":\"ms\", \"traceEvents\":[\n");
+    const std::string footer("\n]}\n");
+    std::vector<char> traceJSON;
+    size_t position = 0;
+    size_t gatheredSize = 0;
+
+    if (m_RankMPI == 0)
+    {
+        gatheredSize = std::accumulate(rankLogsSizes.begin(),
+                                       rankLogsSizes.end(), size_t(0));
+        traceJSON.resize(header.size() + gatheredSize + footer.size());
+        helper::CopyToBuffer(traceJSON, position, header.c_str(),
+                             header.size());
+    }
+
+    m_Comm.GathervArrays(rankLog.c_str(), rankLog.size(), rankLogsSizes.data(),
+                         rankLogsSizes.size(),
+                         traceJSON.empty() ? nullptr : &traceJSON[position]);
+
+    if (m_RankMPI == 0)
+    {
+        position += gatheredSize;
+        helper::CopyToBuffer(traceJSON, position, footer.c_str(),
+                             footer.size());
+    }
+
+    return traceJSON;
+}
+
 } // end namespace profiling
 } // end namespace adios2
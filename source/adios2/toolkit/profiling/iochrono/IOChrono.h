@@ -12,6 +12,7 @@
 #define ADIOS2_TOOLKIT_PROFILING_IOCHRONO_IOCHRONO_H_
 
 /// \cond EXCLUDE_FROM_DOXYGEN
+#include <string>
 #include <unordered_map>
 #include <vector>
 /// \endcond
@@ -64,10 +65,34 @@ class JSONProfiler
 public:
     JSONProfiler(helper::Comm const &comm);
     void Gather();
-    void AddTimerWatch(const std::string &);
 
-    void Start(const std::string process) { m_Profiler.Start(process); };
-    void Stop(const std::string process) { m_Profiler.Stop(process); };
+    /**
+     * Add a timer
+     * @param name process name used in Start/Stop
+     * @param lane timeline row of the timer's events in the trace, one per
+     * thread that runs timers (a timer is only used by one thread at a time)
+     */
+    void AddTimerWatch(const std::string &name,
+                       const std::string &lane = "main");
+
+    /**
+     * Record every Start/Stop pair as a timestamped event in addition to the
+     * cumulative timers. Each lane keeps the latest maxEvents events.
+     * @param maxEvents ring buffer capacity per lane, 0 disables tracing
+     */
+    void EnableTrace(const size_t maxEvents);
+
+    bool IsTraceEnabled() const noexcept { return m_TraceMaxEvents > 0; }
+
+    /**
+     * Add the total time (<timer>_us) and number of calls (<timer>_calls) of
+     * the timers of a lane to metrics. Only call it from the lane's thread.
+     */
+    void AddToMetrics(Metrics &metrics,
+                      const std::string &lane = "main") const;
+
+    void Start(const std::string process);
+    void Stop(const std::string process);
 
     std::string
     GetRankProfilingJSON(const std::vector<std::string> &transportsTypes,
@@ -76,10 +101,43 @@ public:
 
     std::vector<char> AggregateProfilingJSON(const std::string &rankLog) const;
 
+    /**
+     * Gather the trace events of all ranks into a Chrome trace-event JSON
+     * document (viewable in Perfetto or chrome://tracing), one process per
+     * rank and one thread per lane. Collective.
+     * @return JSON document on rank 0, empty on other ranks
+     */
+    std::vector<char> AggregateTraceJSON() const;
+
 private:
     IOChrono m_Profiler;
     int m_RankMPI = 0;
     helper::Comm const &m_Comm;
+
+    struct TraceEvent
+    {
+        const std::string *Name;
+        int64_t Start; // microseconds since epoch
+        int64_t Duration;
+    };
+
+    struct TraceLane
+    {
+        std::string Name;
+        /** ring buffer of the latest events */
+        std::vector<TraceEvent> Events;
+        /** number of events recorded, including overwritten ones */
+        size_t Recorded = 0;
+        /** start time of running timers */
+        std::unordered_map<const std::string *, int64_t> Running;
+    };
+
+    size_t m_TraceMaxEvents = 0;
+    std::vector<TraceLane> m_TraceLanes;
+    /** process name -> index in m_TraceLanes */
+    std::unordered_map<std::string, size_t> m_TimerLanes;
+
+    std::string GetRankTraceJSON(const int64_t timeBase) const;
 };
 
 } // end namespace profiling
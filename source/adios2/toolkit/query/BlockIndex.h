@@ -33,9 +33,77 @@ public:
     void Evaluate(const QueryVar &query,
                   std::vector<adios2::Box<adios2::Dims>> &resultSubBlocks)
     {
+        MinVarInfo *minBlocksInfo =
+            m_IdxReader.MinBlocksInfo(m_Var, m_IdxReader.CurrentStep());
+        if (minBlocksInfo)
+        {
+            RunMinBlocksStat(query, *minBlocksInfo, resultSubBlocks);
+            delete minBlocksInfo;
+            return;
+        }
         RunBP4Stat(query, resultSubBlocks);
     }
 
+    /*
+     * Engines answering MinBlocksInfo (BP5): uses the sub-block min/max
+     * when the writer recorded them (StatsBlockSize), the block min/max
+     * otherwise.  Hits are returned in global coordinates.
+     */
+    void RunMinBlocksStat(const QueryVar &query, const MinVarInfo &varInfo,
+                          std::vector<adios2::Box<adios2::Dims>> &hitBlocks)
+    {
+        adios2::Dims currShape = m_Var.Shape();
+        if (!query.IsSelectionValid(currShape))
+            return;
+        if (varInfo.IsValue || varInfo.WasLocalVar || !varInfo.Shape)
+            return;
+
+        const size_t ndim = static_cast<size_t>(varInfo.Dims);
+        for (const auto &blockInfo : varInfo.BlocksInfo)
+        {
+            adios2::Dims start(blockInfo.Start, blockInfo.Start + ndim);
+            adios2::Dims count(blockInfo.Count, blockInfo.Count + ndim);
+            if (!query.TouchSelection(start, count))
+                continue;
+
+            if (blockInfo.SubBlockCount > 0)
+            {
+                const T *minMaxs =
+                    static_cast<const T *>(blockInfo.SubBlockMinMax);
+                const adios2::helper::BlockDivisionInfo info =
+                    adios2::helper::DivideBlock(
+                        count, blockInfo.SubBlockSize,
+                        adios2::helper::BlockDivisionMethod::Contiguous);
+                for (unsigned int i = 0; i < blockInfo.SubBlockCount; i++)
+                {
+                    T subMin = minMaxs[2 * i];
+                    T subMax = minMaxs[2 * i + 1];
+                    if (!query.m_RangeTree.CheckInterval(subMin, subMax))
+                        continue;
+                    adios2::Box<adios2::Dims> currSubBlock =
+                        adios2::helper::GetSubBlock(count, info, i);
+                    for (size_t d = 0; d < ndim; d++)
+                    {
+                        currSubBlock.first[d] += start[d];
+                    }
+                    if (!query.TouchSelection(currSubBlock.first,
+                                              currSubBlock.second))
+                        continue;
+                    hitBlocks.push_back(currSubBlock);
+                }
+            }
+            else
+            {
+                T min = *(const T *)&blockInfo.MinMax.MinUnion;
+                T max = *(const T *)&blockInfo.MinMax.MaxUnion;
+                if (query.m_RangeTree.CheckInterval(min, max))
+                {
+                    hitBlocks.push_back({start, count});
+                }
+            }
+        }
+    }
+
     void RunBP4Stat(const QueryVar &query,
                     std::vector<adios2::Box<adios2::Dims>> &hitBlocks)
     {
@@ -121,7 +189,7 @@ public:
     */
 
     Tree m_Content;
-    adios2::core::Variable<T> m_Var;
+    adios2::core::Variable<T> &m_Var;
 
 private:
     //
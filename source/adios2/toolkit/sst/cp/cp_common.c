@@ -4,6 +4,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <sys/stat.h>
+#include <sys/time.h>
 
 #include "adios2/common/ADIOSConfig.h"
 #include <atl.h>
@@ -167,7 +168,7 @@ void CP_validateParams(SstStream Stream, SstParams Params, int Writer)
 
 static char *SstRegStr[] = {"File", "Screen", "Cloud"};
 static char *SstMarshalStr[] = {"FFS", "BP", "BP5"};
-static char *SstQueueFullStr[] = {"Block", "Discard"};
+static char *SstQueueFullStr[] = {"Block", "Discard", "Spill"};
 static char *SstCompressStr[] = {"None", "ZFP"};
 static char *SstCommPatternStr[] = {"Min", "Peer"};
 static char *SstPreloadModeStr[] = {"Off", "On", "Auto"};
@@ -190,8 +191,18 @@ extern void CP_dumpParams(SstStream Stream, struct _SstParams *Params,
                 (Params->QueueLimit == 0) ? "(unlimited)" : "");
         fprintf(stderr, "Param -   QueueFullPolicy=%s\n",
                 SstQueueFullStr[Params->QueueFullPolicy]);
+        if (Params->QueueFullPolicy == SstQueueFullSpill)
+        {
+            fprintf(stderr, "Param -   SpillDirectory=%s\n",
+                    Params->SpillDirectory ? Params->SpillDirectory
+                                           : "(default TMPDIR or /tmp)");
+            fprintf(stderr, "Param -   SpillLimit=%zu (bytes)\n",
+                    Params->SpillLimit);
+        }
         fprintf(stderr, "Param -   StepDistributionMode=%s\n",
                 SstStepDistributionModeStr[Params->StepDistributionMode]);
+        fprintf(stderr, "Param -   MetadataSendThreads=%d\n",
+                Params->MetadataSendThreads);
     }
     fprintf(stderr, "Param -   DataTransport=%s\n",
             Params->DataTransport ? Params->DataTransport : "");
@@ -415,6 +426,8 @@ static FMField TimestepMetadataList[] = {
      FMOffset(struct _TimestepMetadataMsg *, AttributeData)},
     {"TP_TimestepInfo", "(*DP_STRUCT)[cohort_size]", 0,
      FMOffset(struct _TimestepMetadataMsg *, DP_TimestepInfo)},
+    {"send_time", "float", sizeof(double),
+     FMOffset(struct _TimestepMetadataMsg *, SendTime)},
     {NULL, NULL, 0, 0}};
 
 static FMStructDescRec TimestepMetadataStructs[] = {
@@ -440,6 +453,8 @@ static FMField ReleaseRecList[] = {{"Timestep", "integer", sizeof(long),
 static FMField ReturnMetadataInfoList[] = {
     {"DiscardThisTimestep", "integer", sizeof(int),
      FMOffset(struct _ReturnMetadataInfo *, DiscardThisTimestep)},
+    {"SpillThisTimestep", "integer", sizeof(int),
+     FMOffset(struct _ReturnMetadataInfo *, SpillThisTimestep)},
     {"PendingReaderCount", "integer", sizeof(int),
      FMOffset(struct _ReturnMetadataInfo *, PendingReaderCount)},
     {"ReleaseCount", "integer", sizeof(int),
@@ -602,6 +617,7 @@ static void replaceFormatNameInFieldList(FMStructDescList l, const char *orig,
                     while (l[i].field_list[index].field_name != NULL)
                     {
                         l[i].field_list[index] = l[i].field_list[index + 1];
+                        index++;
                     }
                     j--; /* we've replaced this element, make sure we process
                             the one we replaced it with */
@@ -1054,6 +1070,22 @@ static void ReadableSizeString(size_t SizeInBytes, char *Output, size_t size)
     }
 };
 
+extern double CP_WallClockSecs()
+{
+    struct timeval Now;
+    gettimeofday(&Now, NULL);
+    return (double)Now.tv_sec + (double)Now.tv_usec / 1e6;
+}
+
+extern void SstGetStats(SstStream Stream, struct _SstStats *Stats,
+                        size_t *QueuedTimesteps)
+{
+    pthread_mutex_lock(&Stream->DataLock);
+    *Stats = Stream->Stats;
+    *QueuedTimesteps = Stream->QueuedTimestepCount;
+    pthread_mutex_unlock(&Stream->DataLock);
+}
+
 extern void DoStreamSummary(SstStream Stream)
 {
     SstStats AllStats = NULL;
@@ -1074,7 +1106,31 @@ extern void DoStreamSummary(SstStream Stream)
         AllStats[0].MetadataBytesReceived += AllStats[i].MetadataBytesReceived;
         AllStats[0].DataBytesReceived += AllStats[i].DataBytesReceived;
         AllStats[0].PreloadBytesReceived += AllStats[i].PreloadBytesReceived;
+        AllStats[0].SpilledBytes += AllStats[i].SpilledBytes;
+        AllStats[0].SpillServedBytes += AllStats[i].SpillServedBytes;
         AllStats[0].RunningFanIn += AllStats[i].RunningFanIn;
+        /* only the ranks that send or receive metadata count */
+        if (AllStats[i].MetadataSendSecs > AllStats[0].MetadataSendSecs)
+        {
+            AllStats[0].MetadataSends = AllStats[i].MetadataSends;
+            AllStats[0].MetadataSendSecs = AllStats[i].MetadataSendSecs;
+        }
+        if (AllStats[i].MetadataSendMaxSecs > AllStats[0].MetadataSendMaxSecs)
+        {
+            AllStats[0].MetadataSendMaxSecs = AllStats[i].MetadataSendMaxSecs;
+        }
+        if (AllStats[i].MetadataLatencySecs > AllStats[0].MetadataLatencySecs)
+        {
+            AllStats[0].TimestepMetadataReceived =
+                AllStats[i].TimestepMetadataReceived;
+            AllStats[0].MetadataLatencySecs = AllStats[i].MetadataLatencySecs;
+        }
+        if (AllStats[i].MetadataLatencyMaxSecs >
+            AllStats[0].MetadataLatencyMaxSecs)
+        {
+            AllStats[0].MetadataLatencyMaxSecs =
+                AllStats[i].MetadataLatencyMaxSecs;
+        }
     }
     AllStats[0].RunningFanIn /= Stream->CohortSize;
 
@@ -1088,6 +1144,30 @@ extern void DoStreamSummary(SstStream Stream)
                    Stream->Stats.TimestepsCreated);
         CP_verbose(Stream, SummaryVerbose, "\tTimesteps Delivered = %zu\n",
                    Stream->Stats.TimestepsDelivered);
+        if (AllStats[0].MetadataSends)
+        {
+            CP_verbose(Stream, SummaryVerbose,
+                       "\tMetadata fan-out per step (secs) = %g avg, %g max\n",
+                       AllStats[0].MetadataSendSecs /
+                           AllStats[0].MetadataSends,
+                       AllStats[0].MetadataSendMaxSecs);
+        }
+        if (Stream->QueueFullPolicy == SstQueueFullSpill)
+        {
+            char OutputString[256];
+            CP_verbose(Stream, SummaryVerbose,
+                       "\tTimesteps Spilled = %zu\n",
+                       Stream->Stats.SpilledTimesteps);
+            ReadableSizeString(AllStats[0].SpilledBytes, OutputString,
+                               sizeof(OutputString));
+            CP_verbose(Stream, SummaryVerbose, "\tSpilledBytes = %zu (%s)\n",
+                       AllStats[0].SpilledBytes, OutputString);
+            ReadableSizeString(AllStats[0].SpillServedBytes, OutputString,
+                               sizeof(OutputString));
+            CP_verbose(Stream, SummaryVerbose,
+                       "\tSpillServedBytes = %zu (%s)\n",
+                       AllStats[0].SpillServedBytes, OutputString);
+        }
     }
     else if (Stream->Role == ReaderRole)
     {
@@ -1115,6 +1195,15 @@ extern void DoStreamSummary(SstStream Stream)
                    Stream->Stats.PreloadTimestepsReceived);
         CP_verbose(Stream, SummaryVerbose, "\tAverageReadRankFanIn = %.1f\n",
                    AllStats[0].RunningFanIn);
+        if (AllStats[0].TimestepMetadataReceived)
+        {
+            /* across hosts this includes the clock offset of the writer */
+            CP_verbose(Stream, SummaryVerbose,
+                       "\tMetadata latency per step (secs) = %g avg, %g max\n",
+                       AllStats[0].MetadataLatencySecs /
+                           AllStats[0].TimestepMetadataReceived,
+                       AllStats[0].MetadataLatencyMaxSecs);
+        }
     }
     CP_verbose(Stream, SummaryVerbose, "\n");
     free(AllStats);
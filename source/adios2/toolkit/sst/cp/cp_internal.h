@@ -134,9 +134,23 @@ typedef struct _CPTimestepEntry
     DataFreeFunc FreeTimestep;
     void *FreeClientData;
     void *DataBlockToFree;
+    int Spilled; /* data handed to the spill thread */
     struct _CPTimestepEntry *Next;
 } * CPTimestepList;
 
+/*
+ * A timestep waiting for the spill thread to write its data to the spill
+ * file.  The queue entry holds a reference until the request is done.
+ */
+typedef struct _SpillRequest
+{
+    CPTimestepList Entry;
+    char *Block;
+    size_t Size;
+    size_t Offset;
+    struct _SpillRequest *Next;
+} * SpillRequest;
+
 typedef struct FFSFormatBlock *FFSFormatList;
 
 struct _SstStream
@@ -207,8 +221,31 @@ struct _SstStream
     enum StreamStatus Status;
     AssembleMetadataUpcallFunc AssembleMetadataUpcall;
     FreeMetadataUpcallFunc FreeMetadataUpcall;
+    ReleaseDataUpcallFunc ReleaseDataUpcall;
     void *UpcallWriter;
 
+    /* writer side spill state, QueueFullPolicy=spill */
+    int SpillFd;
+    size_t SpillFileSize;  /* end of the last reserved spill record */
+    int SpilledQueueCount; /* queued timesteps spilled or being spilled */
+    SpillRequest SpillQueue;
+    pthread_t SpillThread;
+    pthread_cond_t SpillCondition;
+    int SpillThreadRunning;
+    int SpillThreadExit;
+
+    /* writer side metadata send pool, MetadataSendThreads > 1 */
+    pthread_mutex_t SendPoolLock;
+    pthread_cond_t SendPoolWork;
+    pthread_cond_t SendPoolDone;
+    pthread_t *SendPoolThreads;
+    int SendPoolThreadCount;
+    struct _MetadataSend *SendPoolJobs;
+    int SendPoolJobCount;
+    int SendPoolNextJob;
+    int SendPoolDoneCount;
+    int SendPoolExit;
+
     /* READER-SIDE FIELDS */
     struct _TimestepMetadataList *Timesteps;
     int WriterCohortSize;
@@ -391,8 +428,22 @@ typedef struct _TimestepMetadataMsg
     SstData Metadata;
     SstData AttributeData;
     void **DP_TimestepInfo;
+    double SendTime; /* writer wall clock when the fan-out of the step began */
 } * TSMetadataMsg;
 
+/*
+ * One timestep metadata message to one reader rank, a job for the writer's
+ * metadata send pool (MetadataSendThreads > 1).  Each send has its own copy of
+ * the message because the reader-specific fields differ.
+ */
+typedef struct _MetadataSend
+{
+    WS_ReaderInfo Reader;
+    CMConnection Conn;
+    struct _TimestepMetadataMsg Msg;
+    int Failed;
+} * MetadataSend;
+
 /*
  * The timestepMetadataDistribution message carries the metadata from rank 0 to
  * all reader ranks in min ode.
@@ -419,6 +470,7 @@ typedef struct _ReleaseRec
 typedef struct _ReturnMetadataInfo
 {
     int DiscardThisTimestep;
+    int SpillThisTimestep;
     int PendingReaderCount;
     struct _TimestepMetadataMsg Msg;
     int ReleaseCount;
@@ -582,3 +634,4 @@ extern char *IPDiagString;
 extern CPNetworkInfoFunc globalNetinfoCallback;
 extern void SSTSetNetworkCallback(CPNetworkInfoFunc callback);
 extern void DoStreamSummary(SstStream Stream);
+extern double CP_WallClockSecs();
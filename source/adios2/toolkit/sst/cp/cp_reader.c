@@ -832,6 +832,15 @@ void queueTimestepMetadataMsgAndNotify(SstStream Stream,
         Stream->Stats.MetadataBytesReceived +=
             (tsm->Metadata->DataSize + tsm->AttributeData->DataSize);
     }
+    if (tsm->SendTime > 0.0)
+    {
+        double Latency = CP_WallClockSecs() - tsm->SendTime;
+        Stream->Stats.MetadataLatencySecs += Latency;
+        if (Latency > Stream->Stats.MetadataLatencyMaxSecs)
+        {
+            Stream->Stats.MetadataLatencyMaxSecs = Latency;
+        }
+    }
     CP_verbose(Stream, PerRankVerbose,
                "Received a Timestep metadata message for timestep %d, "
                "signaling condition\n",
@@ -1,4 +1,5 @@
 #include <assert.h>
+#include <fcntl.h>
 #include <limits.h>
 #include <signal.h>
 #include <stdarg.h>
@@ -277,6 +278,16 @@ static void RemoveQueueEntries(SstStream Stream)
             }
 
             Stream->QueuedTimestepCount--;
+            if (ItemToFree->Spilled && (--Stream->SpilledQueueCount == 0))
+            {
+                /* nothing left in the spill file, start over */
+                Stream->SpillFileSize = 0;
+                if (ftruncate(Stream->SpillFd, 0) != 0)
+                {
+                    CP_verbose(Stream, PerRankVerbose,
+                               "Failed to truncate the spill file\n");
+                }
+            }
             if (ItemToFree->MetaDataSendCount)
             {
                 Stream->Stats.TimestepsDelivered++;
@@ -770,6 +781,207 @@ static void SubRefTimestep(SstStream Stream, long Timestep, int SetLast)
     }
 }
 
+/*
+ * Spilling, QueueFullPolicy=spill.  The data block of a timestep that
+ * overflows QueueLimit is appended to a node-local spill file by a background
+ * thread.  Once the data plane has switched the timestep over to the file, the
+ * engine releases the block.  The metadata stays queued, and read requests
+ * for the timestep are served from the file.  The file is unlinked as soon as
+ * it is created and truncated whenever no spilled timestep is left queued.
+ */
+static int SpillAvailable(SstStream Stream)
+{
+    return (Stream->DP_Interface->spillTimestep != NULL) &&
+           (Stream->ReleaseDataUpcall != NULL);
+}
+
+static int SpillHasRoom(SstStream Stream, size_t Size)
+{
+    return Stream->SpillFileSize + Size <= Stream->ConfigParams->SpillLimit;
+}
+
+static int WriteSpillRecord(int Fd, SpillRequest Req)
+{
+    size_t Done = 0;
+    while (Done < Req->Size)
+    {
+        ssize_t Ret = pwrite(Fd, Req->Block + Done, Req->Size - Done,
+                             (off_t)(Req->Offset + Done));
+        if (Ret <= 0)
+        {
+            return 0;
+        }
+        Done += (size_t)Ret;
+    }
+    return 1;
+}
+
+static void *SpillThreadFunc(void *Stream_v)
+{
+    SstStream Stream = (SstStream)Stream_v;
+
+    STREAM_MUTEX_LOCK(Stream);
+    while (1)
+    {
+        SpillRequest Req;
+        long Timestep;
+        int Spilled;
+
+        while (!Stream->SpillQueue && !Stream->SpillThreadExit)
+        {
+            pthread_cond_wait(&Stream->SpillCondition, &Stream->DataLock);
+        }
+        Req = Stream->SpillQueue;
+        if (!Req)
+        {
+            break;
+        }
+        Stream->SpillQueue = Req->Next;
+        Timestep = Req->Entry->Timestep;
+        STREAM_MUTEX_UNLOCK(Stream);
+
+        Spilled = WriteSpillRecord(Stream->SpillFd, Req) &&
+                  Stream->DP_Interface->spillTimestep(&Svcs, Stream->DP_Stream,
+                                                      Timestep, Stream->SpillFd,
+                                                      Req->Offset);
+        if (Spilled)
+        {
+            Stream->ReleaseDataUpcall(Stream->UpcallWriter,
+                                      Req->Entry->FreeClientData);
+        }
+
+        STREAM_MUTEX_LOCK(Stream);
+        if (Spilled)
+        {
+            CP_verbose(Stream, PerStepVerbose,
+                       "Spilled %zu bytes of timestep %ld to disk\n",
+                       Req->Size, Timestep);
+            Stream->Stats.SpilledTimesteps++;
+            Stream->Stats.SpilledBytes += Req->Size;
+        }
+        else
+        {
+            CP_verbose(Stream, CriticalVerbose,
+                       "Failed to spill timestep %ld, keeping it in memory\n",
+                       Timestep);
+            Req->Entry->Spilled = 0;
+            Stream->SpilledQueueCount--;
+        }
+        SubRefTimestep(Stream, Timestep, 0);
+        QueueMaintenance(Stream);
+        free(Req);
+    }
+    STREAM_MUTEX_UNLOCK(Stream);
+    return NULL;
+}
+
+static int StartSpilling(SstStream Stream)
+{
+    const char *Dir = Stream->ConfigParams->SpillDirectory;
+    char *Filename;
+
+    if (!Dir || !Dir[0])
+    {
+        Dir = getenv("TMPDIR");
+    }
+    if (!Dir || !Dir[0])
+    {
+        Dir = "/tmp";
+    }
+    Filename = malloc(strlen(Dir) + 64);
+    sprintf(Filename, "%s/sst_spill_%ld_%d_XXXXXX", Dir, (long)getpid(),
+            Stream->Rank);
+    Stream->SpillFd = mkstemp(Filename);
+    if (Stream->SpillFd == -1)
+    {
+        CP_verbose(Stream, CriticalVerbose,
+                   "Failed to create the spill file %s, timesteps will stay "
+                   "in memory\n",
+                   Filename);
+        free(Filename);
+        return 0;
+    }
+    CP_verbose(Stream, PerRankVerbose, "Spilling timesteps to %s\n", Filename);
+    unlink(Filename);
+    free(Filename);
+
+    pthread_cond_init(&Stream->SpillCondition, NULL);
+    if (pthread_create(&Stream->SpillThread, NULL, SpillThreadFunc, Stream))
+    {
+        CP_verbose(Stream, CriticalVerbose,
+                   "Failed to start the spill thread, timesteps will stay in "
+                   "memory\n");
+        close(Stream->SpillFd);
+        Stream->SpillFd = -1;
+        return 0;
+    }
+    Stream->SpillThreadRunning = 1;
+    return 1;
+}
+
+static void StopSpilling(SstStream Stream)
+{
+    STREAM_MUTEX_LOCK(Stream);
+    if (!Stream->SpillThreadRunning)
+    {
+        STREAM_MUTEX_UNLOCK(Stream);
+        return;
+    }
+    Stream->SpillThreadExit = 1;
+    pthread_cond_signal(&Stream->SpillCondition);
+    STREAM_MUTEX_UNLOCK(Stream);
+    pthread_join(Stream->SpillThread, NULL);
+    Stream->SpillThreadRunning = 0;
+    pthread_cond_destroy(&Stream->SpillCondition);
+    close(Stream->SpillFd);
+    Stream->SpillFd = -1;
+}
+
+/*
+ * (ASSUME LOCKED) hand the data of Entry to the spill thread, the entry is
+ * referenced until it is done.  A rank that can't spill (no room left in its
+ * spill file, or marshaling without a release upcall) keeps the data in
+ * memory, the writer doesn't block either way.
+ */
+static void QueueSpill(SstStream Stream, CPTimestepList Entry, SstData Data)
+{
+    size_t Size = Data ? Data->DataSize : 0;
+    SpillRequest Req;
+    STREAM_ASSERT_LOCKED(Stream);
+
+    if (!SpillAvailable(Stream) || !SpillHasRoom(Stream, Size) ||
+        (!Stream->SpillThreadRunning && !StartSpilling(Stream)))
+    {
+        CP_verbose(Stream, PerStepVerbose,
+                   "Timestep %ld can't be spilled, keeping it in memory\n",
+                   Entry->Timestep);
+        return;
+    }
+    Req = calloc(1, sizeof(*Req));
+    Req->Entry = Entry;
+    Req->Block = Data ? Data->block : NULL;
+    Req->Size = Size;
+    Req->Offset = Stream->SpillFileSize;
+    Stream->SpillFileSize += Size;
+    Stream->SpilledQueueCount++;
+    Entry->Spilled = 1;
+    Entry->ReferenceCount++;
+    if (Stream->SpillQueue)
+    {
+        SpillRequest Last = Stream->SpillQueue;
+        while (Last->Next)
+        {
+            Last = Last->Next;
+        }
+        Last->Next = Req;
+    }
+    else
+    {
+        Stream->SpillQueue = Req;
+    }
+    pthread_cond_signal(&Stream->SpillCondition);
+}
+
 WS_ReaderInfo WriterParticipateInReaderOpen(SstStream Stream)
 {
     RegisterQueue Req;
@@ -1123,10 +1335,16 @@ static void DerefAllSentTimesteps(SstStream Stream, WS_ReaderInfo Reader)
 static FFSFormatList ReturnNthListEntry(FFSFormatList List, size_t Count);
 static size_t FormatListCount(FFSFormatList List);
 
-static void SendTimestepEntryToSingleReader(SstStream Stream,
-                                            CPTimestepList Entry,
-                                            WS_ReaderInfo CP_WSR_Stream,
-                                            int rank)
+/*
+ * (ASSUME LOCKED) do the bookkeeping for sending Entry to a reader and fill in
+ * Msg, the reader-specific copy of the timestep metadata message.  Returns 0
+ * if the reader is not established.  Drops the lock around the DP timestep
+ * registration.
+ */
+static int PrepareTimestepEntryForSingleReader(SstStream Stream,
+                                               CPTimestepList Entry,
+                                               WS_ReaderInfo CP_WSR_Stream,
+                                               int rank, TSMetadataMsg Msg)
 {
     STREAM_ASSERT_LOCKED(Stream);
     if (CP_WSR_Stream->ReaderStatus == Established)
@@ -1171,22 +1389,258 @@ static void SendTimestepEntryToSingleReader(SstStream Stream,
 
         Entry->Msg->PreloadMode = PMode;
         CP_WSR_Stream->FormatSentCount += FormatListCount(ToSend);
+        *Msg = *Entry->Msg;
         STREAM_MUTEX_LOCK(Stream);
-        if (CP_WSR_Stream->ReaderStatus == Established)
-            sendOneToWSRCohort(
-                CP_WSR_Stream,
-                Stream->CPInfo->SharedCM->DeliverTimestepMetadataFormat,
-                Entry->Msg, &Entry->Msg->RS_Stream);
+        return 1;
+    }
+    return 0;
+}
+
+static void SendTimestepEntryToSingleReader(SstStream Stream,
+                                            CPTimestepList Entry,
+                                            WS_ReaderInfo CP_WSR_Stream,
+                                            int rank)
+{
+    struct _TimestepMetadataMsg Msg;
+    if (PrepareTimestepEntryForSingleReader(Stream, Entry, CP_WSR_Stream, rank,
+                                            &Msg) &&
+        (CP_WSR_Stream->ReaderStatus == Established))
+    {
+        sendOneToWSRCohort(
+            CP_WSR_Stream,
+            Stream->CPInfo->SharedCM->DeliverTimestepMetadataFormat, &Msg,
+            &Msg.RS_Stream);
     }
 }
 
+/*
+ * The metadata send pool.  With MetadataSendThreads > 1 the timestep metadata
+ * messages of a step go out to the reader cohorts concurrently, so that a
+ * reader whose connection is backed up doesn't hold up the others.  The thread
+ * doing EndStep works on the sends too, the pool adds MetadataSendThreads - 1
+ * helpers.  Sends to the same reader rank are never concurrent, every step is
+ * complete before the next one starts.
+ */
+static int TakeMetadataSend(SstStream Stream)
+{
+    if (Stream->SendPoolNextJob < Stream->SendPoolJobCount)
+    {
+        return Stream->SendPoolNextJob++;
+    }
+    return -1;
+}
+
+static void DoMetadataSend(SstStream Stream, int Index)
+{
+    MetadataSend Send = &Stream->SendPoolJobs[Index];
+    CMFormat Format = Stream->CPInfo->SharedCM->DeliverTimestepMetadataFormat;
+    Send->Failed = (CMwrite(Send->Conn, Format, &Send->Msg) != 1);
+
+    pthread_mutex_lock(&Stream->SendPoolLock);
+    if (++Stream->SendPoolDoneCount == Stream->SendPoolJobCount)
+    {
+        pthread_cond_signal(&Stream->SendPoolDone);
+    }
+    pthread_mutex_unlock(&Stream->SendPoolLock);
+}
+
+static void *MetadataSendThreadFunc(void *Stream_v)
+{
+    SstStream Stream = (SstStream)Stream_v;
+
+    pthread_mutex_lock(&Stream->SendPoolLock);
+    while (1)
+    {
+        int Index;
+        while (((Index = TakeMetadataSend(Stream)) == -1) &&
+               !Stream->SendPoolExit)
+        {
+            pthread_cond_wait(&Stream->SendPoolWork, &Stream->SendPoolLock);
+        }
+        if (Index == -1)
+        {
+            break;
+        }
+        pthread_mutex_unlock(&Stream->SendPoolLock);
+        DoMetadataSend(Stream, Index);
+        pthread_mutex_lock(&Stream->SendPoolLock);
+    }
+    pthread_mutex_unlock(&Stream->SendPoolLock);
+    return NULL;
+}
+
+static void StartMetadataSendPool(SstStream Stream)
+{
+    int Count = Stream->ConfigParams->MetadataSendThreads - 1;
+
+    pthread_mutex_init(&Stream->SendPoolLock, NULL);
+    pthread_cond_init(&Stream->SendPoolWork, NULL);
+    pthread_cond_init(&Stream->SendPoolDone, NULL);
+    Stream->SendPoolThreads = malloc(Count * sizeof(pthread_t));
+    for (int i = 0; i < Count; i++)
+    {
+        if (pthread_create(&Stream->SendPoolThreads[i], NULL,
+                           MetadataSendThreadFunc, Stream))
+        {
+            CP_verbose(Stream, CriticalVerbose,
+                       "Failed to start a metadata send thread, using %d\n",
+                       i);
+            break;
+        }
+        Stream->SendPoolThreadCount++;
+    }
+}
+
+static void StopMetadataSendPool(SstStream Stream)
+{
+    if (!Stream->SendPoolThreads)
+    {
+        return;
+    }
+    pthread_mutex_lock(&Stream->SendPoolLock);
+    Stream->SendPoolExit = 1;
+    pthread_cond_broadcast(&Stream->SendPoolWork);
+    pthread_mutex_unlock(&Stream->SendPoolLock);
+    for (int i = 0; i < Stream->SendPoolThreadCount; i++)
+    {
+        pthread_join(Stream->SendPoolThreads[i], NULL);
+    }
+    free(Stream->SendPoolThreads);
+    Stream->SendPoolThreads = NULL;
+    Stream->SendPoolThreadCount = 0;
+    pthread_cond_destroy(&Stream->SendPoolDone);
+    pthread_cond_destroy(&Stream->SendPoolWork);
+    pthread_mutex_destroy(&Stream->SendPoolLock);
+}
+
+static void AddMetadataSend(MetadataSend *Sends, int *Count, int *Alloc,
+                            WS_ReaderInfo Reader, CMConnection Conn,
+                            TSMetadataMsg Msg, void *RS_Stream)
+{
+    if (*Count == *Alloc)
+    {
+        *Alloc = *Alloc ? *Alloc * 2 : 8;
+        *Sends = realloc(*Sends, *Alloc * sizeof(struct _MetadataSend));
+    }
+    (*Sends)[*Count].Reader = Reader;
+    (*Sends)[*Count].Conn = Conn;
+    (*Sends)[*Count].Msg = *Msg;
+    (*Sends)[*Count].Msg.RS_Stream = RS_Stream;
+    (*Sends)[*Count].Failed = 0;
+    (*Count)++;
+}
+
+/*
+ * (ASSUME LOCKED) StepsAllToAll distribution of Entry through the send pool.
+ * This rank sends to the same reader ranks as sendOneToWSRCohort() would.
+ */
+static void SendTimestepEntryToReadersParallel(SstStream Stream,
+                                               CPTimestepList Entry)
+{
+    MetadataSend Sends = NULL;
+    int SendCount = 0, SendAlloc = 0;
+    STREAM_ASSERT_LOCKED(Stream);
+
+    if (!Stream->SendPoolThreads)
+    {
+        StartMetadataSendPool(Stream);
+    }
+    for (int i = 0; i < Stream->ReaderCount; i++)
+    {
+        WS_ReaderInfo CP_WSR_Stream = Stream->Readers[i];
+        struct _TimestepMetadataMsg Msg;
+        if (!PrepareTimestepEntryForSingleReader(Stream, Entry, CP_WSR_Stream,
+                                                 i, &Msg) ||
+            (CP_WSR_Stream->ReaderStatus != Established))
+        {
+            continue;
+        }
+        if (Stream->ConfigParams->CPCommPattern == SstCPCommPeer)
+        {
+            for (int j = 0; CP_WSR_Stream->Peers[j] != -1; j++)
+            {
+                int peer = CP_WSR_Stream->Peers[j];
+                if (CP_WSR_Stream->Connections[peer].CMconn)
+                {
+                    AddMetadataSend(
+                        &Sends, &SendCount, &SendAlloc, CP_WSR_Stream,
+                        CP_WSR_Stream->Connections[peer].CMconn, &Msg,
+                        CP_WSR_Stream->Connections[peer].RemoteStreamID);
+                }
+            }
+        }
+        else if ((Stream->Rank == 0) && CP_WSR_Stream->Connections[0].CMconn)
+        {
+            AddMetadataSend(&Sends, &SendCount, &SendAlloc, CP_WSR_Stream,
+                            CP_WSR_Stream->Connections[0].CMconn, &Msg,
+                            CP_WSR_Stream->Connections[0].RemoteStreamID);
+        }
+    }
+    if (SendCount == 0)
+    {
+        free(Sends);
+        return;
+    }
+
+    CP_verbose(Stream, TraceVerbose,
+               "Sending timestep %ld to %d reader ranks with %d threads\n",
+               Entry->Timestep, SendCount, Stream->SendPoolThreadCount + 1);
+    STREAM_MUTEX_UNLOCK(Stream);
+    pthread_mutex_lock(&Stream->SendPoolLock);
+    Stream->SendPoolJobs = Sends;
+    Stream->SendPoolJobCount = SendCount;
+    Stream->SendPoolNextJob = 0;
+    Stream->SendPoolDoneCount = 0;
+    pthread_cond_broadcast(&Stream->SendPoolWork);
+    while (1)
+    {
+        int Index = TakeMetadataSend(Stream);
+        if (Index == -1)
+        {
+            break;
+        }
+        pthread_mutex_unlock(&Stream->SendPoolLock);
+        DoMetadataSend(Stream, Index);
+        pthread_mutex_lock(&Stream->SendPoolLock);
+    }
+    while (Stream->SendPoolDoneCount < Stream->SendPoolJobCount)
+    {
+        pthread_cond_wait(&Stream->SendPoolDone, &Stream->SendPoolLock);
+    }
+    Stream->SendPoolJobs = NULL;
+    Stream->SendPoolJobCount = 0;
+    pthread_mutex_unlock(&Stream->SendPoolLock);
+    STREAM_MUTEX_LOCK(Stream);
+
+    for (int i = 0; i < SendCount; i++)
+    {
+        if (Sends[i].Failed)
+        {
+            CP_verbose(Stream, PerStepVerbose,
+                       "Message failed to send to reader (%p)\n",
+                       Sends[i].Msg.RS_Stream);
+            CP_PeerFailCloseWSReader(Sends[i].Reader, PeerFailed);
+        }
+    }
+    free(Sends);
+}
+
 static void SendTimestepEntryToReaders(SstStream Stream, CPTimestepList Entry)
 {
+    double Start = CP_WallClockSecs(), Elapsed;
     STREAM_ASSERT_LOCKED(Stream);
+    Entry->Msg->SendTime = Start;
     switch (Stream->ConfigParams->StepDistributionMode)
     {
     case StepsAllToAll:
     {
+        if ((Stream->ConfigParams->MetadataSendThreads > 1) &&
+            (Stream->ReaderCount > 1 ||
+             Stream->ConfigParams->CPCommPattern == SstCPCommPeer))
+        {
+            SendTimestepEntryToReadersParallel(Stream, Entry);
+            break;
+        }
         for (int i = 0; i < Stream->ReaderCount; i++)
         {
             WS_ReaderInfo CP_WSR_Stream = Stream->Readers[i];
@@ -1236,6 +1690,16 @@ static void SendTimestepEntryToReaders(SstStream Stream, CPTimestepList Entry)
         }
     }
     }
+    if (Stream->ReaderCount > 0)
+    {
+        Elapsed = CP_WallClockSecs() - Start;
+        Stream->Stats.MetadataSends++;
+        Stream->Stats.MetadataSendSecs += Elapsed;
+        if (Elapsed > Stream->Stats.MetadataSendMaxSecs)
+        {
+            Stream->Stats.MetadataSendMaxSecs = Elapsed;
+        }
+    }
 }
 
 static void waitForReaderResponseAndSendQueued(WS_ReaderInfo Reader)
@@ -1314,6 +1778,7 @@ static void waitForReaderResponseAndSendQueued(WS_ReaderInfo Reader)
                         "reference count = %d\n",
                         TS, List->ReferenceCount);
 
+                    List->Msg->SendTime = CP_WallClockSecs();
                     SendTimestepEntryToSingleReader(Stream, List, Reader, -1);
                 }
                 List = List->Next;
@@ -1689,6 +2154,8 @@ void SstWriterClose(SstStream Stream)
         STREAM_MUTEX_LOCK(Stream);
     }
     STREAM_MUTEX_UNLOCK(Stream);
+    StopSpilling(Stream);
+    StopMetadataSendPool(Stream);
     gettimeofday(&CloseTime, NULL);
     timersub(&CloseTime, &Stream->ValidStartTime, &Diff);
     Stream->Stats.StreamValidTimeSecs =
@@ -2171,6 +2638,7 @@ extern void SstInternalProvideTimestep(
     if (Data)
     {
         PERFSTUBS_SAMPLE_COUNTER("Timestep local data size", Data->DataSize);
+        Stream->Stats.DataBytesProvided += Data->DataSize;
     }
     if (LocalMetadata)
     {
@@ -2211,6 +2679,7 @@ extern void SstInternalProvideTimestep(
     if (Stream->Rank == 0)
     {
         int DiscardThisTimestep = 0;
+        int SpillThisTimestep = 0;
         struct _ReturnMetadataInfo TimestepMetaData;
         RegisterQueue ArrivingReader;
         void *MetadataFreeValue;
@@ -2229,6 +2698,26 @@ extern void SstInternalProvideTimestep(
                 DiscardThisTimestep = 1;
             }
         }
+        else if ((Stream->QueueFullPolicy == SstQueueFullSpill) &&
+                 SpillAvailable(Stream))
+        {
+            /* spilled timesteps don't count against QueueLimit, block only
+             * when the spill file is full */
+            while ((Stream->QueueLimit > 0) &&
+                   (Stream->QueuedTimestepCount - Stream->SpilledQueueCount >
+                    Stream->QueueLimit))
+            {
+                if (SpillHasRoom(Stream, Data ? Data->DataSize : 0))
+                {
+                    SpillThisTimestep = 1;
+                    break;
+                }
+                CP_verbose(Stream, PerStepVerbose,
+                           "Spill limit reached, blocking on QueueFull "
+                           "condition\n");
+                STREAM_CONDITION_WAIT(Stream);
+            }
+        }
         else
         {
             while ((Stream->QueueLimit > 0) &&
@@ -2248,6 +2737,7 @@ extern void SstInternalProvideTimestep(
         }
 
         TimestepMetaData.DiscardThisTimestep = DiscardThisTimestep;
+        TimestepMetaData.SpillThisTimestep = SpillThisTimestep;
         TimestepMetaData.ReleaseCount = Stream->ReleaseCount;
         TimestepMetaData.ReleaseList = Stream->ReleaseList;
         TimestepMetaData.LockDefnsCount = Stream->LockDefnsCount;
@@ -2351,6 +2841,10 @@ extern void SstInternalProvideTimestep(
 
         STREAM_MUTEX_LOCK(Stream);
         SendTimestepEntryToReaders(Stream, Entry);
+        if (ReturnData->SpillThisTimestep)
+        {
+            QueueSpill(Stream, Entry, Data);
+        }
         SubRefTimestep(Stream, Entry->Timestep, 0);
         QueueMaintenance(Stream);
         STREAM_MUTEX_UNLOCK(Stream);
@@ -2639,6 +3133,7 @@ void CP_ReaderRequestStepHandler(CManager cm, CMConnection conn, void *Msg_v,
                        "reference count = %d\n",
                        NextTS, List->ReferenceCount);
 
+            List->Msg->SendTime = CP_WallClockSecs();
             SendTimestepEntryToSingleReader(Stream, List, CP_WSR_Stream,
                                             RequestingReader);
             STREAM_MUTEX_UNLOCK(CP_WSR_Stream->ParentStream);
@@ -2756,3 +3251,10 @@ void SstWriterInitMetadataCallback(SstStream Stream, void *Writer,
     Stream->FreeMetadataUpcall = FreeCallback;
     Stream->UpcallWriter = Writer;
 }
+
+void SstWriterInitReleaseDataCallback(SstStream Stream, void *Writer,
+                                      ReleaseDataUpcallFunc ReleaseCallback)
+{
+    Stream->ReleaseDataUpcall = ReleaseCallback;
+    Stream->UpcallWriter = Writer;
+}
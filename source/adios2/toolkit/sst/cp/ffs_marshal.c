@@ -1,3 +1,4 @@
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -199,6 +200,165 @@ static int TranslateFFSType2ADIOS(const char *Type, int size)
     return 0;
 }
 
+/*
+ * Small chained hash table used to find writer and reader variable records
+ * by Variable pointer or by name without scanning the record lists, which
+ * made Put/Get and metadata processing quadratic in the number of variables.
+ * Values are record indices (or pointers) stored as uintptr_t, since the
+ * writer's RecList is reallocated as it grows.
+ */
+typedef struct _FFSHashEntry
+{
+    const void *Key;
+    size_t Hash;
+    uintptr_t Value;
+    struct _FFSHashEntry *Next;
+} *FFSHashEntry;
+
+struct FFSHashTable
+{
+    int StringKeys;
+    size_t BucketCount;
+    size_t EntryCount;
+    FFSHashEntry *Buckets;
+};
+
+static size_t HashKey(const struct FFSHashTable *Table, const void *Key)
+{
+    size_t Hash;
+    if (Table->StringKeys)
+    {
+        /* FNV-1a */
+        const unsigned char *c = (const unsigned char *)Key;
+        Hash = 14695981039346656037ULL;
+        while (*c)
+        {
+            Hash ^= *c++;
+            Hash *= 1099511628211ULL;
+        }
+    }
+    else
+    {
+        Hash = (size_t)(uintptr_t)Key;
+        Hash ^= Hash >> 33;
+        Hash *= 0xff51afd7ed558ccdULL;
+        Hash ^= Hash >> 33;
+    }
+    return Hash;
+}
+
+static int HashKeysEqual(const struct FFSHashTable *Table, const void *A,
+                         const void *B)
+{
+    if (Table->StringKeys)
+        return (strcmp((const char *)A, (const char *)B) == 0);
+    return (A == B);
+}
+
+static struct FFSHashTable *HashCreate(int StringKeys)
+{
+    struct FFSHashTable *Table = malloc(sizeof(*Table));
+    Table->StringKeys = StringKeys;
+    Table->BucketCount = 64;
+    Table->EntryCount = 0;
+    Table->Buckets = calloc(Table->BucketCount, sizeof(Table->Buckets[0]));
+    return Table;
+}
+
+static void HashClear(struct FFSHashTable *Table)
+{
+    if (!Table)
+        return;
+    for (size_t i = 0; i < Table->BucketCount; i++)
+    {
+        FFSHashEntry Entry = Table->Buckets[i];
+        while (Entry)
+        {
+            FFSHashEntry Next = Entry->Next;
+            free(Entry);
+            Entry = Next;
+        }
+        Table->Buckets[i] = NULL;
+    }
+    Table->EntryCount = 0;
+}
+
+static void HashFree(struct FFSHashTable *Table)
+{
+    if (!Table)
+        return;
+    HashClear(Table);
+    free(Table->Buckets);
+    free(Table);
+}
+
+static void HashGrow(struct FFSHashTable *Table)
+{
+    size_t NewCount = Table->BucketCount * 2;
+    FFSHashEntry *NewBuckets = calloc(NewCount, sizeof(NewBuckets[0]));
+    for (size_t i = 0; i < Table->BucketCount; i++)
+    {
+        FFSHashEntry Entry = Table->Buckets[i];
+        while (Entry)
+        {
+            FFSHashEntry Next = Entry->Next;
+            size_t Bucket = Entry->Hash & (NewCount - 1);
+            Entry->Next = NewBuckets[Bucket];
+            NewBuckets[Bucket] = Entry;
+            Entry = Next;
+        }
+    }
+    free(Table->Buckets);
+    Table->Buckets = NewBuckets;
+    Table->BucketCount = NewCount;
+}
+
+/* Key must stay valid for as long as the entry is in the table */
+static void HashInsert(struct FFSHashTable *Table, const void *Key,
+                       uintptr_t Value)
+{
+    size_t Hash = HashKey(Table, Key);
+    FFSHashEntry Entry = Table->Buckets[Hash & (Table->BucketCount - 1)];
+    while (Entry)
+    {
+        if ((Entry->Hash == Hash) && HashKeysEqual(Table, Entry->Key, Key))
+        {
+            Entry->Value = Value;
+            return;
+        }
+        Entry = Entry->Next;
+    }
+    if (Table->EntryCount >= Table->BucketCount)
+        HashGrow(Table);
+    size_t Bucket = Hash & (Table->BucketCount - 1);
+    Entry = malloc(sizeof(*Entry));
+    Entry->Key = Key;
+    Entry->Hash = Hash;
+    Entry->Value = Value;
+    Entry->Next = Table->Buckets[Bucket];
+    Table->Buckets[Bucket] = Entry;
+    Table->EntryCount++;
+}
+
+static int HashLookup(const struct FFSHashTable *Table, const void *Key,
+                      uintptr_t *Value)
+{
+    if (!Table)
+        return 0;
+    size_t Hash = HashKey(Table, Key);
+    FFSHashEntry Entry = Table->Buckets[Hash & (Table->BucketCount - 1)];
+    while (Entry)
+    {
+        if ((Entry->Hash == Hash) && HashKeysEqual(Table, Entry->Key, Key))
+        {
+            *Value = Entry->Value;
+            return 1;
+        }
+        Entry = Entry->Next;
+    }
+    return 0;
+}
+
 static void RecalcMarshalStorageSize(SstStream Stream)
 {
     struct FFSWriterMarshalBase *Info = Stream->WriterMarshalData;
@@ -337,6 +497,7 @@ static void InitMarshalData(SstStream Stream)
     Stream->WriterMarshalData = Info;
     Info->RecCount = 0;
     Info->RecList = malloc(sizeof(Info->RecList[0]));
+    Info->RecsByKey = HashCreate(0);
     Info->MetaFieldCount = 0;
     Info->MetaFields = NULL;
     Info->DataFieldCount = 0;
@@ -371,6 +532,7 @@ extern void FFSFreeMarshalData(SstStream Stream)
         }
         if (Info->RecList)
             free(Info->RecList);
+        HashFree(Info->RecsByKey);
         if (Info->MetaFieldCount)
             free_FMfield_list(Info->MetaFields);
         if (Info->DataFieldCount)
@@ -422,6 +584,10 @@ extern void FFSFreeMarshalData(SstStream Stream)
             if (Info->VarList)
                 free(Info->VarList);
 
+            HashFree(Info->VarsByName);
+            HashFree(Info->VarsByKey);
+            HashFree(Info->ControlsByFormat);
+
             struct ControlInfo *tmp = Info->ControlBlocks;
             Info->ControlBlocks = NULL;
             while (tmp)
@@ -455,6 +621,7 @@ static FFSWriterRec CreateWriterRec(SstStream Stream, void *Variable,
     FFSWriterRec Rec = &Info->RecList[Info->RecCount];
     Rec->Key = Variable;
     Rec->FieldID = Info->RecCount;
+    HashInsert(Info->RecsByKey, Variable, (uintptr_t)Info->RecCount);
     Rec->DimCount = DimCount;
     Rec->Type = Type;
     if (DimCount == 0)
@@ -614,16 +781,14 @@ static size_t CalcSize(const size_t Count, const size_t *Vals)
 static FFSWriterRec LookupWriterRec(SstStream Stream, void *Key)
 {
     struct FFSWriterMarshalBase *Info = Stream->WriterMarshalData;
+    uintptr_t Index;
 
     if (!Stream->WriterMarshalData)
         return NULL;
 
-    for (int i = 0; i < Info->RecCount; i++)
+    if (HashLookup(Info->RecsByKey, Key, &Index))
     {
-        if (Info->RecList[i].Key == Key)
-        {
-            return &Info->RecList[i];
-        }
+        return &Info->RecList[Index];
     }
 
     return NULL;
@@ -632,13 +797,11 @@ static FFSWriterRec LookupWriterRec(SstStream Stream, void *Key)
 static FFSVarRec LookupVarByKey(SstStream Stream, void *Key)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    uintptr_t Index;
 
-    for (int i = 0; i < Info->VarCount; i++)
+    if (HashLookup(Info->VarsByKey, Key, &Index))
     {
-        if (Info->VarList[i]->Variable == Key)
-        {
-            return Info->VarList[i];
-        }
+        return Info->VarList[Index];
     }
 
     return NULL;
@@ -647,18 +810,29 @@ static FFSVarRec LookupVarByKey(SstStream Stream, void *Key)
 static FFSVarRec LookupVarByName(SstStream Stream, const char *Name)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    uintptr_t Index;
 
-    for (int i = 0; i < Info->VarCount; i++)
+    if (HashLookup(Info->VarsByName, Name, &Index))
     {
-        if (strcmp(Info->VarList[i]->VarName, Name) == 0)
-        {
-            return Info->VarList[i];
-        }
+        return Info->VarList[Index];
     }
 
     return NULL;
 }
 
+static void SetVarRecVariable(SstStream Stream, FFSVarRec VarRec,
+                              void *Variable)
+{
+    struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
+    uintptr_t Index;
+
+    VarRec->Variable = Variable;
+    if (Variable && HashLookup(Info->VarsByName, VarRec->VarName, &Index))
+    {
+        HashInsert(Info->VarsByKey, Variable, Index);
+    }
+}
+
 static FFSVarRec CreateVarRec(SstStream Stream, const char *ArrayName)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
@@ -678,6 +852,7 @@ static FFSVarRec CreateVarRec(SstStream Stream, const char *ArrayName)
         calloc(sizeof(void *), Stream->WriterCohortSize);
     Ret->PerWriterIncomingSize =
         calloc(sizeof(size_t), Stream->WriterCohortSize);
+    HashInsert(Info->VarsByName, Ret->VarName, (uintptr_t)Info->VarCount);
     Info->VarList[Info->VarCount++] = Ret;
     return Ret;
 }
@@ -1811,6 +1986,7 @@ extern void FFSClearTimestepData(SstStream Stream)
     {
         Info->VarList[i]->Variable = NULL;
     }
+    HashClear(Info->VarsByKey);
 }
 
 static struct ControlInfo *BuildControl(SstStream Stream, FMFormat Format)
@@ -1825,12 +2001,18 @@ static struct ControlInfo *BuildControl(SstStream Stream, FMFormat Format)
         FieldList++;
     int i = 0;
     int ControlCount = 0;
-    struct ControlInfo *ret = malloc(sizeof(*ret));
+    int ControlAlloc = 16;
+    struct ControlInfo *ret =
+        malloc(sizeof(*ret) + ControlAlloc * sizeof(struct ControlStruct));
     ret->Format = Format;
     while (FieldList[i].field_name)
     {
-        ret = realloc(ret,
-                      sizeof(*ret) + ControlCount * sizeof(struct ControlInfo));
+        if (ControlCount + 1 > ControlAlloc)
+        {
+            ControlAlloc *= 2;
+            ret = realloc(ret, sizeof(*ret) +
+                                   ControlAlloc * sizeof(struct ControlStruct));
+        }
         struct ControlStruct *C = &(ret->Controls[ControlCount]);
         ControlCount++;
 
@@ -1887,20 +2069,17 @@ static struct ControlInfo *BuildControl(SstStream Stream, FMFormat Format)
     ret->ControlCount = ControlCount;
     ret->Next = Info->ControlBlocks;
     Info->ControlBlocks = ret;
+    HashInsert(Info->ControlsByFormat, Format, (uintptr_t)ret);
     return ret;
 }
 
 static struct ControlInfo *GetPriorControl(SstStream Stream, FMFormat Format)
 {
     struct FFSReaderMarshalBase *Info = Stream->ReaderMarshalData;
-    struct ControlInfo *tmp = Info->ControlBlocks;
-    while (tmp)
+    uintptr_t Control;
+    if (HashLookup(Info->ControlsByFormat, Format, &Control))
     {
-        if (tmp->Format == Format)
-        {
-            return tmp;
-        }
-        tmp = tmp->Next;
+        return (struct ControlInfo *)Control;
     }
     return NULL;
 }
@@ -1946,6 +2125,9 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
             calloc(sizeof(Info->DataBaseAddrs[0]), Stream->WriterCohortSize);
         Info->DataFieldLists =
             calloc(sizeof(Info->DataFieldLists[0]), Stream->WriterCohortSize);
+        Info->VarsByName = HashCreate(1);
+        Info->VarsByKey = HashCreate(0);
+        Info->ControlsByFormat = HashCreate(0);
     }
 
     if (!MetaData->Metadata[WriterRank].block)
@@ -2033,10 +2215,12 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
             }
             if (!VarRec->Variable)
             {
-                VarRec->Variable = Stream->ArraySetupUpcall(
-                    Stream->SetupUpcallReader, VarRec->VarName, VarRec->Type,
-                    meta_base->Dims, meta_base->Shape, meta_base->Offsets,
-                    meta_base->Count);
+                SetVarRecVariable(
+                    Stream, VarRec,
+                    Stream->ArraySetupUpcall(
+                        Stream->SetupUpcallReader, VarRec->VarName,
+                        VarRec->Type, meta_base->Dims, meta_base->Shape,
+                        meta_base->Offsets, meta_base->Count));
             }
             VarRec->DimCount = meta_base->Dims;
             VarRec->PerWriterBlockCount[WriterRank] =
@@ -2085,9 +2269,11 @@ static void BuildVarList(SstStream Stream, TSMetadataMsg MetaData,
         {
             if (!VarRec->Variable)
             {
-                VarRec->Variable = Stream->VarSetupUpcall(
-                    Stream->SetupUpcallReader, VarRec->VarName, VarRec->Type,
-                    field_data);
+                SetVarRecVariable(Stream, VarRec,
+                                  Stream->VarSetupUpcall(
+                                      Stream->SetupUpcallReader,
+                                      VarRec->VarName, VarRec->Type,
+                                      field_data));
             }
         }
         VarRec->PerWriterMetaFieldOffset[WriterRank] = FieldOffset;
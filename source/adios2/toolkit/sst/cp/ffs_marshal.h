@@ -28,10 +28,13 @@ typedef struct _FFSWriterRec
     int Type;
 } * FFSWriterRec;
 
+struct FFSHashTable;
+
 struct FFSWriterMarshalBase
 {
     int RecCount;
     FFSWriterRec RecList;
+    struct FFSHashTable *RecsByKey;
     FMContext LocalFMContext;
     int MetaFieldCount;
     FMFieldList MetaFields;
@@ -130,6 +133,10 @@ struct FFSReaderMarshalBase
 
     FFSReaderPerWriterRec *WriterInfo;
     struct ControlInfo *ControlBlocks;
+
+    struct FFSHashTable *VarsByName;
+    struct FFSHashTable *VarsByKey;
+    struct FFSHashTable *ControlsByFormat;
 };
 
 extern char *FFS_ZFPCompress(SstStream Stream, const size_t DimCount, int Type,
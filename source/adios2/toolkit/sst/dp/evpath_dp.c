@@ -4,6 +4,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
 #include <atl.h>
 #include <evpath.h>
@@ -104,6 +105,10 @@ typedef struct _TimestepEntry
     struct _SstData Data;
     struct _EvpathPerTimestepInfo *DP_TimestepInfo;
     struct _ReaderRequestTrackRec *ReaderRequests;
+    int Spilled; /* Data.block released, data is in the spill file */
+    int SpillFd;
+    size_t SpillOffset;
+    int ReadsInFlight; /* replies being sent from Data.block */
     struct _TimestepEntry *Next;
 } * TimestepList;
 
@@ -130,6 +135,7 @@ typedef struct _Evpath_WS_Stream
     void *CP_Stream;
     int Rank;
     pthread_mutex_t DataLock;
+    pthread_cond_t SpillCondition; /* signalled when ReadsInFlight drops */
 
     TimestepList Timesteps;
     CMFormat ReadReplyFormat;
@@ -378,6 +384,34 @@ static void MarkReadRequest(TimestepList TS, DP_WSR_Stream WSR_Stream_v,
     TS->ReaderRequests = ReqTrk;
 }
 
+/*
+ * writer side routine, returns a malloc'd copy of the given range of a spilled
+ * timestep, or NULL if it can't be read back
+ */
+static char *ReadSpilledData(CP_Services Svcs, Evpath_WS_Stream WS_Stream,
+                             int SpillFd, size_t SpillOffset, size_t Offset,
+                             size_t Length)
+{
+    char *Buffer = malloc(Length ? Length : 1);
+    size_t Done = 0;
+    while (Done < Length)
+    {
+        ssize_t Ret = pread(SpillFd, Buffer + Done, Length - Done,
+                            (off_t)(SpillOffset + Offset + Done));
+        if (Ret <= 0)
+        {
+            Svcs->verbose(WS_Stream->CP_Stream, DPCriticalVerbose,
+                          "Failed to read %zu bytes back from the spill "
+                          "file\n",
+                          Length);
+            free(Buffer);
+            return NULL;
+        }
+        Done += (size_t)Ret;
+    }
+    return Buffer;
+}
+
 // writer side routine, called by the network handler thread
 static void EvpathReadRequestHandler(CManager cm, CMConnection incoming_conn,
                                      void *msg_v, void *client_Data,
@@ -411,7 +445,6 @@ static void EvpathReadRequestHandler(CManager cm, CMConnection incoming_conn,
             memset(&ReadReplyMsg, 0, sizeof(ReadReplyMsg));
             ReadReplyMsg.Timestep = ReadRequestMsg->Timestep;
             ReadReplyMsg.DataLength = ReadRequestMsg->Length;
-            ReadReplyMsg.Data = tmp->Data.block + ReadRequestMsg->Offset;
             ReadReplyMsg.RS_Stream = ReadRequestMsg->RS_Stream;
             ReadReplyMsg.NotifyCondition = ReadRequestMsg->NotifyCondition;
             Svcs->verbose(
@@ -438,8 +471,42 @@ static void EvpathReadRequestHandler(CManager cm, CMConnection incoming_conn,
                 WSR_Stream->ReaderContactInfo[RequestingRank].Conn = ReplyConn;
             }
             CMFormat Format = WS_Stream->ReadReplyFormat;
-            pthread_mutex_unlock(&WS_Stream->DataLock);
-            CMwrite(ReplyConn, Format, &ReadReplyMsg);
+            if (tmp->Spilled)
+            {
+                /* the spill thread released the block, read it back */
+                int SpillFd = tmp->SpillFd;
+                size_t SpillOffset = tmp->SpillOffset;
+                char *SpillBuffer;
+                pthread_mutex_unlock(&WS_Stream->DataLock);
+                SpillBuffer = ReadSpilledData(
+                    Svcs, WS_Stream, SpillFd, SpillOffset,
+                    ReadRequestMsg->Offset, ReadRequestMsg->Length);
+                if (!SpillBuffer)
+                {
+                    PERFSTUBS_TIMER_STOP_FUNC(timer);
+                    return;
+                }
+                ReadReplyMsg.Data = SpillBuffer;
+                CMwrite(ReplyConn, Format, &ReadReplyMsg);
+                free(SpillBuffer);
+                pthread_mutex_lock(&WS_Stream->DataLock);
+                WS_Stream->Stats->SpillServedBytes += ReadRequestMsg->Length;
+                pthread_mutex_unlock(&WS_Stream->DataLock);
+            }
+            else
+            {
+                /* keep the block from being spilled until the reply is out */
+                ReadReplyMsg.Data = tmp->Data.block + ReadRequestMsg->Offset;
+                tmp->ReadsInFlight++;
+                pthread_mutex_unlock(&WS_Stream->DataLock);
+                CMwrite(ReplyConn, Format, &ReadReplyMsg);
+                pthread_mutex_lock(&WS_Stream->DataLock);
+                if (--tmp->ReadsInFlight == 0)
+                {
+                    pthread_cond_broadcast(&WS_Stream->SpillCondition);
+                }
+                pthread_mutex_unlock(&WS_Stream->DataLock);
+            }
 
             PERFSTUBS_TIMER_STOP_FUNC(timer);
             return;
@@ -702,6 +769,7 @@ static DP_WS_Stream EvpathInitWriter(CP_Services Svcs, void *CP_Stream,
     memset(Stream, 0, sizeof(struct _Evpath_WS_Stream));
 
     pthread_mutex_init(&Stream->DataLock, NULL);
+    pthread_cond_init(&Stream->SpillCondition, NULL);
 
     SMPI_Comm_rank(comm, &Stream->Rank);
 
@@ -1198,7 +1266,9 @@ static void EvpathWSReaderRegisterTimestep(CP_Services Svcs,
                 "Sending Learned Preload messages, reader %p, timestep %ld, "
                 "fprint %lx\n",
                 WSR_Stream, Timestep,
-                writeBlockFingerprint(Entry->Data.block, Entry->Data.DataSize));
+                Entry->Spilled ? 0
+                               : writeBlockFingerprint(Entry->Data.block,
+                                                       Entry->Data.DataSize));
             SendPreloadMsgs(Svcs, WSR_Stream, Entry);
         }
     }
@@ -1231,6 +1301,28 @@ static void EvpathRSTimestepArrived(CP_Services Svcs, DP_RS_Stream RS_Stream_v,
     }
 }
 
+/*
+ * writer-side routine, called with DataLock held.  Preloads are sent while
+ * the lock is held, so the in-memory block can be used directly unless it
+ * was spilled, in which case the caller frees the copy read back.
+ */
+static char *GetPreloadData(CP_Services Svcs, Evpath_WS_Stream WS_Stream,
+                            TimestepList TS)
+{
+    char *Data;
+    if (!TS->Spilled)
+    {
+        return TS->Data.block;
+    }
+    Data = ReadSpilledData(Svcs, WS_Stream, TS->SpillFd, TS->SpillOffset, 0,
+                           TS->Data.DataSize);
+    if (Data)
+    {
+        WS_Stream->Stats->SpillServedBytes += TS->Data.DataSize;
+    }
+    return Data;
+}
+
 // reader-side routine, called from either thread
 static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
                             TimestepList TS)
@@ -1244,8 +1336,12 @@ static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
     memset(&PreloadMsg, 0, sizeof(PreloadMsg));
     PreloadMsg.Timestep = TS->Timestep;
     PreloadMsg.DataLength = TS->Data.DataSize;
-    PreloadMsg.Data = TS->Data.block;
+    PreloadMsg.Data = GetPreloadData(Svcs, WS_Stream, TS);
     PreloadMsg.WriterRank = WS_Stream->Rank;
+    if (!PreloadMsg.Data && TS->Data.DataSize)
+    {
+        return;
+    }
 
     for (int i = 0; i < WSR_Stream->ReaderCohortSize; i++)
     {
@@ -1260,6 +1356,10 @@ static void SendPreloadMsgs(CP_Services Svcs, Evpath_WSR_Stream WSR_Stream,
                     WS_Stream->PreloadFormat, &PreloadMsg);
         }
     }
+    if (TS->Spilled)
+    {
+        free(PreloadMsg.Data);
+    }
 }
 
 static void SendSpeculativePreloadMsgs(CP_Services Svcs,
@@ -1273,8 +1373,12 @@ static void SendSpeculativePreloadMsgs(CP_Services Svcs,
     memset(&PreloadMsg, 0, sizeof(PreloadMsg));
     PreloadMsg.Timestep = TS->Timestep;
     PreloadMsg.DataLength = TS->Data.DataSize;
-    PreloadMsg.Data = TS->Data.block;
+    PreloadMsg.Data = GetPreloadData(Svcs, WS_Stream, TS);
     PreloadMsg.WriterRank = WS_Stream->Rank;
+    if (!PreloadMsg.Data && TS->Data.DataSize)
+    {
+        return;
+    }
 
     for (int i = 0; i < WSR_Stream->ReaderCohortSize; i++)
     {
@@ -1291,7 +1395,7 @@ static void SendSpeculativePreloadMsgs(CP_Services Svcs,
                     "Failed to connect to reader rank %d for response to "
                     "remote read, assume failure, no response sent\n",
                     i);
-                return;
+                break;
             }
             WSR_Stream->ReaderContactInfo[i].Conn = Conn;
         }
@@ -1299,6 +1403,10 @@ static void SendSpeculativePreloadMsgs(CP_Services Svcs,
         CMwrite(WSR_Stream->ReaderContactInfo[i].Conn, WS_Stream->PreloadFormat,
                 &PreloadMsg);
     }
+    if (TS->Spilled)
+    {
+        free(PreloadMsg.Data);
+    }
 }
 
 static void EvpathReaderReleaseTimestep(CP_Services Svcs,
@@ -1401,6 +1509,40 @@ static void EvpathProvideTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
     *TimestepInfoPtr = NULL;
 }
 
+// writer-side routine, called from the control plane's spill thread
+static int EvpathSpillTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
+                               long Timestep, int SpillFd, size_t SpillOffset)
+{
+    Evpath_WS_Stream WS_Stream = (Evpath_WS_Stream)Stream_v;
+    TimestepList Entry;
+
+    pthread_mutex_lock(&WS_Stream->DataLock);
+    Entry = WS_Stream->Timesteps;
+    while (Entry && (Entry->Timestep != Timestep))
+    {
+        Entry = Entry->Next;
+    }
+    if (!Entry)
+    {
+        pthread_mutex_unlock(&WS_Stream->DataLock);
+        return 0;
+    }
+    Entry->SpillFd = SpillFd;
+    Entry->SpillOffset = SpillOffset;
+    Entry->Spilled = 1;
+    /* new requests go to the file, wait for replies still using the block */
+    while (Entry->ReadsInFlight > 0)
+    {
+        pthread_cond_wait(&WS_Stream->SpillCondition, &WS_Stream->DataLock);
+    }
+    Entry->Data.block = NULL;
+    Svcs->verbose(WS_Stream->CP_Stream, DPPerRankVerbose,
+                  "Timestep %ld is now served from the spill file\n",
+                  Timestep);
+    pthread_mutex_unlock(&WS_Stream->DataLock);
+    return 1;
+}
+
 static void EvpathReleaseTimestep(CP_Services Svcs, DP_WS_Stream Stream_v,
                                   long Timestep)
 {
@@ -1515,7 +1657,7 @@ static FMStructDescRec EvpathWriterContactStructs[] = {
 
 static struct _CP_DP_Interface evpathDPInterface = {
     NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
-    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
+    NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL};
 
 static int EvpathGetPriority(CP_Services Svcs, void *CP_Stream,
                              struct _SstParams *Params)
@@ -1552,5 +1694,6 @@ extern NO_SANITIZE_THREAD CP_DP_Interface LoadEVpathDP()
     evpathDPInterface.destroyWriterPerReader = EvpathDestroyWriterPerReader;
     evpathDPInterface.getPriority = EvpathGetPriority;
     evpathDPInterface.unGetPriority = NULL;
+    evpathDPInterface.spillTimestep = EvpathSpillTimestep;
     return &evpathDPInterface;
 }
@@ -291,6 +291,19 @@ typedef void (*CP_DP_RS_ReadPatternLockedFunc)(CP_Services Svcs,
 typedef void (*CP_DP_ReleaseTimestepFunc)(CP_Services Svcs, DP_WS_Stream Stream,
                                           long Timestep);
 
+/*!
+ * CP_DP_SpillTimestepFunc is the type of an optional writer-side dataplane
+ * function that informs the dataplane that the data of timestep `Timestep`
+ * has been written to the file descriptor `SpillFd` at `SpillOffset`.
+ * Later read requests for that timestep must be served from the file.  It
+ * returns 1 once no read is still in progress from the in-memory block, so
+ * that the control plane can release it, or 0 if the dataplane cannot serve
+ * the timestep from the file and the block must stay in memory.
+ */
+typedef int (*CP_DP_SpillTimestepFunc)(CP_Services Svcs, DP_WS_Stream Stream,
+                                       long Timestep, int SpillFd,
+                                       size_t SpillOffset);
+
 /*!
  * CP_DP_PerReaderReleaseTimestepFunc is the type of a dataplane function
  * that informs the dataplane that a particular reader is finished with a
@@ -383,6 +396,10 @@ struct _CP_DP_Interface
     CP_DP_GetPriorityFunc
         getPriority; // both sides, part of DP selection process.
     CP_DP_UnGetPriorityFunc unGetPriority;
+
+    CP_DP_SpillTimestepFunc
+        spillTimestep; // writer-side call, optional, from the spill thread
+                       // once a timestep's data is on disk
 };
 #define DPTraceVerbose 5
 #define DPPerRankVerbose 4
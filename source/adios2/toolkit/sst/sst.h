@@ -67,7 +67,8 @@ typedef enum
 typedef enum
 {
     SstQueueFullBlock = 0,
-    SstQueueFullDiscard = 1
+    SstQueueFullDiscard = 1,
+    SstQueueFullSpill = 2
 } SstQueueFullPolicy;
 
 typedef enum
@@ -124,6 +125,15 @@ extern long SstCurrentStep(SstStream s);
  * locked definitions */
 extern void SstReaderDefinitionLock(SstStream stream, long EffectiveTimestep);
 
+/*
+ *  Common operations
+ */
+struct _SstStats;
+/*  SstGetStats copies the stream's statistics, and the number of timesteps
+ * queued on a writer, under the stream lock */
+extern void SstGetStats(SstStream Stream, struct _SstStats *Stats,
+                        size_t *QueuedTimesteps);
+
 /*
  *  Calls that support FFS-based marshaling, source code in cp/ffs_marshal.c
  */
@@ -163,6 +173,16 @@ SstWriterInitMetadataCallback(SstStream stream, void *Writer,
                               AssembleMetadataUpcallFunc AssembleCallback,
                               FreeMetadataUpcallFunc FreeCallback);
 
+/*
+ *  Called (from a background thread) once the data of a timestep has been
+ *  spilled to disk, with the FreeClientData given to SstProvideTimestep.  The
+ *  writer may release the data block, but not the metadata, at that point.
+ */
+typedef void (*ReleaseDataUpcallFunc)(void *Writer, void *FreeClientData);
+extern void
+SstWriterInitReleaseDataCallback(SstStream stream, void *Writer,
+                                 ReleaseDataUpcallFunc ReleaseCallback);
+
 extern void SstFFSMarshal(SstStream Stream, void *Variable, const char *Name,
                           const int Type, size_t ElemSize, size_t DimCount,
                           const size_t *Shape, const size_t *Count,
@@ -42,6 +42,7 @@ typedef struct _SstStats
     size_t BytesTransferred;
     size_t TimestepsCreated;
     size_t TimestepsDelivered;
+    size_t DataBytesProvided; /* writer, local data of all timesteps */
 
     size_t TimestepMetadataReceived;
     size_t TimestepsConsumed;
@@ -50,6 +51,14 @@ typedef struct _SstStats
     size_t PreloadBytesReceived;
     size_t PreloadTimestepsReceived;
     size_t BytesRead;
+    size_t SpilledTimesteps;
+    size_t SpilledBytes;
+    size_t SpillServedBytes;
+    size_t MetadataSends;         /* steps fanned out to the readers */
+    double MetadataSendSecs;      /* total time of the metadata fan-outs */
+    double MetadataSendMaxSecs;   /* slowest fan-out of a step */
+    double MetadataLatencySecs;   /* total send to arrival time, readers */
+    double MetadataLatencyMaxSecs;
     double RunningFanIn;
 } * SstStats;
 
@@ -77,7 +86,10 @@ typedef struct _SstStats
     MACRO(SpeculativePreloadMode, SpecPreloadMode, int, SpecPreloadAuto)       \
     MACRO(SpecAutoNodeThreshold, Int, int, 1)                                  \
     MACRO(ReaderShortCircuitReads, Bool, int, 0)                               \
-    MACRO(ControlModule, String, char *, NULL)
+    MACRO(ControlModule, String, char *, NULL)                                 \
+    MACRO(SpillDirectory, String, char *, NULL)                                \
+    MACRO(SpillLimit, SizeBytes, size_t, 1073741824)                           \
+    MACRO(MetadataSendThreads, Int, int, 1)
 
 typedef enum
 {
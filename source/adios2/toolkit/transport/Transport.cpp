@@ -107,6 +107,15 @@ void Transport::Flush()
 
 size_t Transport::GetSize() { return 0; }
 
+const char *Transport::Map(const size_t /*start*/, const size_t /*size*/)
+{
+    return nullptr;
+}
+
+void Transport::AdviseWillNeed(const size_t /*start*/, const size_t /*size*/)
+{
+}
+
 void Transport::ProfilerStart(const std::string process) noexcept
 {
     if (m_Profiler.m_IsActive)
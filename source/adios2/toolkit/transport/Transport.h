@@ -135,6 +135,20 @@ public:
      */
     virtual size_t GetSize();
 
+    /**
+     * Returns the address of bytes [start, start + size) of the file in
+     * memory, for transports that map files. Addresses stay valid until
+     * Close, also when the file grows and the mapping is extended.
+     * @return nullptr if the transport does not map files (default)
+     */
+    virtual const char *Map(const size_t start, const size_t size);
+
+    /**
+     * Hints that bytes [start, start + size) are about to be read
+     * Default does nothing
+     */
+    virtual void AdviseWillNeed(const size_t start, const size_t size);
+
     /** flushes current contents to physical medium without closing */
     virtual void Flush();
 
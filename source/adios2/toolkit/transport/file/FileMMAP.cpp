@@ -0,0 +1,277 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMMAP.cpp read-only file transport using memory mapping
+ */
+#include "FileMMAP.h"
+#include "adios2/helper/adiosLog.h"
+
+#include <algorithm>   // std::max
+#include <cstdio>      // remove
+#include <cstring>     // memcpy, strerror
+#include <errno.h>     // errno
+#include <fcntl.h>     // open
+#include <sys/mman.h>  // mmap, madvise
+#include <sys/stat.h>  // fstat
+#include <sys/types.h> // open
+#include <unistd.h>    // pread, close, sysconf
+
+/// \cond EXCLUDE_FROM_DOXYGEN
+#include <ios> //std::ios_base::failure
+/// \endcond
+
+namespace adios2
+{
+namespace transport
+{
+
+FileMMAP::FileMMAP(helper::Comm const &comm)
+: Transport("File", "mmap", comm)
+{
+}
+
+FileMMAP::~FileMMAP()
+{
+    if (m_IsOpen)
+    {
+        Unmap();
+        close(m_FileDescriptor);
+    }
+}
+
+void FileMMAP::Open(const std::string &name, const Mode openMode,
+                    const bool /*async*/, const bool /*directio*/)
+{
+    m_Name = name;
+    CheckName();
+    m_OpenMode = openMode;
+    if (m_OpenMode != Mode::Read && m_OpenMode != Mode::ReadRandomAccess)
+    {
+        ThrowReadOnly("Open");
+    }
+
+    ProfilerStart("open");
+    errno = 0;
+    m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+    m_Errno = errno;
+    ProfilerStop("open");
+    if (m_FileDescriptor == -1)
+    {
+        helper::Throw<std::ios_base::failure>(
+            "Toolkit", "transport::file::FileMMAP", "Open",
+            "couldn't open file " + m_Name + ", in call to mmap open" +
+                SysErrMsg());
+    }
+    m_IsOpen = true;
+    m_Position = 0;
+    EnsureMapped(0, GetSize());
+}
+
+bool FileMMAP::EnsureMapped(const size_t start, const size_t size)
+{
+    const size_t end = start + size;
+    if (end > m_FileSize)
+    {
+        GetSize();
+        if (end > m_FileSize)
+        {
+            return false;
+        }
+    }
+    if (end <= m_MappedSize)
+    {
+        return true;
+    }
+
+    // map twice the old size, pages past the end of file become readable
+    // once the writer has extended the file
+    const size_t newSize = std::max(m_FileSize, 2 * m_MappedSize);
+    errno = 0;
+    void *p =
+        mmap(nullptr, newSize, PROT_READ, MAP_SHARED, m_FileDescriptor, 0);
+    m_Errno = errno;
+    if (p == MAP_FAILED)
+    {
+        helper::Throw<std::ios_base::failure>(
+            "Toolkit", "transport::file::FileMMAP", "Map",
+            "couldn't map " + std::to_string(newSize) + " bytes of file " +
+                m_Name + SysErrMsg());
+    }
+    if (m_Mapping)
+    {
+        m_OldMappings.emplace_back(m_Mapping, m_MappedSize);
+    }
+    m_Mapping = static_cast<char *>(p);
+    m_MappedSize = newSize;
+    return true;
+}
+
+const char *FileMMAP::Map(const size_t start, const size_t size)
+{
+    if (!EnsureMapped(start, size))
+    {
+        return nullptr;
+    }
+    return m_Mapping + start;
+}
+
+void FileMMAP::AdviseWillNeed(const size_t start, const size_t size)
+{
+    if (size == 0 || !EnsureMapped(start, size))
+    {
+        return;
+    }
+    static const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t alignedStart = start - start % pageSize;
+    madvise(m_Mapping + alignedStart, start + size - alignedStart,
+            MADV_WILLNEED);
+}
+
+void FileMMAP::Read(char *buffer, size_t size, size_t start)
+{
+    if (start == MaxSizeT)
+    {
+        start = m_Position;
+    }
+
+    ProfilerStart("read");
+    if (EnsureMapped(start, size))
+    {
+        std::memcpy(buffer, m_Mapping + start, size);
+        ProfilerStop("read");
+        m_Position = start + size;
+        return;
+    }
+
+    // past the end of file as seen now, read what is there or fail
+    size_t position = start;
+    while (size > 0)
+    {
+        errno = 0;
+        const auto readSize = pread(m_FileDescriptor, buffer, size,
+                                    static_cast<off_t>(position));
+        m_Errno = errno;
+        if (readSize == -1 && errno == EINTR)
+        {
+            continue;
+        }
+        if (readSize <= 0)
+        {
+            ProfilerStop("read");
+            helper::Throw<std::ios_base::failure>(
+                "Toolkit", "transport::file::FileMMAP", "Read",
+                "couldn't read " + std::to_string(size) + " bytes at " +
+                    std::to_string(position) + " from file " + m_Name +
+                    SysErrMsg());
+        }
+        buffer += readSize;
+        size -= readSize;
+        position += readSize;
+    }
+    ProfilerStop("read");
+    m_Position = position;
+}
+
+size_t FileMMAP::GetSize()
+{
+    struct stat fileStat;
+    errno = 0;
+    if (fstat(m_FileDescriptor, &fileStat) == -1)
+    {
+        m_Errno = errno;
+        helper::Throw<std::ios_base::failure>(
+            "Toolkit", "transport::file::FileMMAP", "GetSize",
+            "couldn't get size of file " + m_Name + SysErrMsg());
+    }
+    m_FileSize = static_cast<size_t>(fileStat.st_size);
+    return m_FileSize;
+}
+
+void FileMMAP::Unmap()
+{
+    for (auto &old : m_OldMappings)
+    {
+        munmap(old.first, old.second);
+    }
+    m_OldMappings.clear();
+    if (m_Mapping)
+    {
+        munmap(m_Mapping, m_MappedSize);
+        m_Mapping = nullptr;
+    }
+    m_MappedSize = 0;
+    m_FileSize = 0;
+}
+
+void FileMMAP::Flush() {}
+
+void FileMMAP::Close()
+{
+    ProfilerStart("close");
+    Unmap();
+    errno = 0;
+    const int status = close(m_FileDescriptor);
+    m_Errno = errno;
+    ProfilerStop("close");
+
+    if (status == -1)
+    {
+        helper::Throw<std::ios_base::failure>(
+            "Toolkit", "transport::file::FileMMAP", "Close",
+            "couldn't close file " + m_Name + " " + SysErrMsg());
+    }
+
+    m_IsOpen = false;
+}
+
+void FileMMAP::Delete()
+{
+    if (m_IsOpen)
+    {
+        Close();
+    }
+    std::remove(m_Name.c_str());
+}
+
+void FileMMAP::SeekToEnd() { m_Position = GetSize(); }
+
+void FileMMAP::SeekToBegin() { m_Position = 0; }
+
+void FileMMAP::Seek(const size_t start)
+{
+    if (start != MaxSizeT)
+    {
+        m_Position = start;
+    }
+    else
+    {
+        SeekToEnd();
+    }
+}
+
+void FileMMAP::Write(const char * /*buffer*/, size_t /*size*/,
+                     size_t /*start*/)
+{
+    ThrowReadOnly("Write");
+}
+
+void FileMMAP::Truncate(const size_t /*length*/) { ThrowReadOnly("Truncate"); }
+
+void FileMMAP::MkDir(const std::string & /*fileName*/) {}
+
+void FileMMAP::ThrowReadOnly(const std::string &function) const
+{
+    helper::Throw<std::invalid_argument>(
+        "Toolkit", "transport::file::FileMMAP", function,
+        "the mmap file transport only supports reading, file " + m_Name);
+}
+
+std::string FileMMAP::SysErrMsg() const
+{
+    return std::string(": errno = " + std::to_string(m_Errno) + ": " +
+                       strerror(m_Errno));
+}
+
+} // end namespace transport
+} // end namespace adios2
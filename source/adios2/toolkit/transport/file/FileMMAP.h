@@ -0,0 +1,91 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * FileMMAP.h read-only file transport using memory mapping
+ */
+
+#ifndef ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+#define ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_
+
+#include "adios2/common/ADIOSConfig.h"
+#include "adios2/toolkit/transport/Transport.h"
+
+#include <vector>
+
+namespace adios2
+{
+namespace helper
+{
+class Comm;
+}
+namespace transport
+{
+
+/**
+ * Read-only file transport that maps the file into memory. Reads copy from
+ * the page cache and Map returns addresses into it, so readers can use the
+ * data without a staging buffer. When a file that is still being written
+ * grows past the mapping, a mapping twice as large replaces it; the old one
+ * is kept until Close so that addresses handed out by Map stay valid.
+ */
+class FileMMAP : public Transport
+{
+
+public:
+    FileMMAP(helper::Comm const &comm);
+
+    ~FileMMAP();
+
+    void Open(const std::string &name, const Mode openMode,
+              const bool async = false, const bool directio = false) final;
+
+    void Write(const char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    void Read(char *buffer, size_t size, size_t start = MaxSizeT) final;
+
+    size_t GetSize() final;
+
+    const char *Map(const size_t start, const size_t size) final;
+
+    void AdviseWillNeed(const size_t start, const size_t size) final;
+
+    void Flush() final;
+
+    void Close() final;
+
+    void Delete() final;
+
+    void SeekToEnd() final;
+
+    void SeekToBegin() final;
+
+    void Seek(const size_t start = MaxSizeT) final;
+
+    void Truncate(const size_t length) final;
+
+    void MkDir(const std::string &fileName) final;
+
+private:
+    int m_FileDescriptor = -1;
+    int m_Errno = 0;
+    char *m_Mapping = nullptr;
+    size_t m_MappedSize = 0;
+    /** file size seen at the last fstat, may be less than m_MappedSize */
+    size_t m_FileSize = 0;
+    /** position for reads without a start */
+    size_t m_Position = 0;
+    /** mappings replaced by a larger one, released at Close */
+    std::vector<std::pair<char *, size_t>> m_OldMappings;
+
+    /** true if [start, start + size) is in the file and mapped */
+    bool EnsureMapped(const size_t start, const size_t size);
+    void Unmap();
+    void ThrowReadOnly(const std::string &function) const;
+    std::string SysErrMsg() const;
+};
+
+} // end namespace transport
+} // end namespace adios2
+
+#endif /* ADIOS2_TOOLKIT_TRANSPORT_FILE_FILEMMAP_H_ */
@@ -132,7 +132,16 @@ void FilePOSIX::Open(const std::string &name, const Mode openMode,
     case (Mode::Read):
         ProfilerStart("open");
         errno = 0;
-        m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+        m_FileDescriptor =
+            open(m_Name.c_str(), __GetOpenFlag(O_RDONLY, directio));
+        if (m_FileDescriptor == -1 && directio && errno == EINVAL)
+        {
+            // file system without O_DIRECT (e.g. tmpfs), read through the
+            // page cache
+            errno = 0;
+            m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+            m_DirectIO = false;
+        }
         m_Errno = errno;
         ProfilerStop("open");
         break;
@@ -232,7 +241,16 @@ void FilePOSIX::OpenChain(const std::string &name, Mode openMode,
     case (Mode::Read):
         ProfilerStart("open");
         errno = 0;
-        m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+        m_FileDescriptor =
+            open(m_Name.c_str(), __GetOpenFlag(O_RDONLY, directio));
+        if (m_FileDescriptor == -1 && directio && errno == EINVAL)
+        {
+            // file system without O_DIRECT (e.g. tmpfs), read through the
+            // page cache
+            errno = 0;
+            m_FileDescriptor = open(m_Name.c_str(), O_RDONLY);
+            m_DirectIO = false;
+        }
         m_Errno = errno;
         ProfilerStop("open");
         break;
@@ -455,6 +473,19 @@ void FilePOSIX::Read(char *buffer, size_t size, size_t start)
                     "Toolkit", "transport::file::FilePOSIX", "Read",
                     "couldn't read from file " + m_Name + " " + SysErrMsg());
             }
+            if (readSize == 0)
+            {
+                if (m_DirectIO)
+                {
+                    // aligned direct reads may reach beyond the end of file
+                    break;
+                }
+                helper::Throw<std::ios_base::failure>(
+                    "Toolkit", "transport::file::FilePOSIX", "Read",
+                    "couldn't read " + std::to_string(size) +
+                        " bytes from file " + m_Name +
+                        ", reached end of file");
+            }
 
             buffer += readSize;
             size -= readSize;
@@ -18,6 +18,7 @@
 
 /// transports
 #ifndef _WIN32
+#include "adios2/toolkit/transport/file/FileMMAP.h"
 #include "adios2/toolkit/transport/file/FilePOSIX.h"
 #endif
 #ifdef ADIOS2_HAVE_DAOS
@@ -416,6 +417,24 @@ void TransportMan::ReadFile(char *buffer, const size_t size, const size_t start,
     itTransport->second->Read(buffer, size, start);
 }
 
+const char *TransportMan::MapFile(const size_t start, const size_t size,
+                                  const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to MapFile with index " +
+                               std::to_string(transportIndex));
+    return itTransport->second->Map(start, size);
+}
+
+void TransportMan::AdviseFile(const size_t start, const size_t size,
+                              const size_t transportIndex)
+{
+    auto itTransport = m_Transports.find(transportIndex);
+    CheckFile(itTransport, ", in call to AdviseFile with index " +
+                               std::to_string(transportIndex));
+    itTransport->second->AdviseWillNeed(start, size);
+}
+
 void TransportMan::FlushFiles(const int transportIndex)
 {
     if (transportIndex == -1)
@@ -571,6 +590,16 @@ std::shared_ptr<Transport> TransportMan::OpenFileTransport(
                     library + " transport does not support buffered I/O.");
             }
         }
+        else if (library == "mmap" || library == "MMAP")
+        {
+            transport = std::make_shared<transport::FileMMAP>(m_Comm);
+            if (lf_GetBuffered("false"))
+            {
+                helper::Throw<std::invalid_argument>(
+                    "Toolkit", "TransportMan", "OpenFileTransport",
+                    library + " transport does not support buffered I/O.");
+            }
+        }
 #endif
 #ifdef ADIOS2_HAVE_DAOS
         else if (library == "Daos" || library == "daos")
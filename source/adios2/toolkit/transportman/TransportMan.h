@@ -174,6 +174,17 @@ public:
     void ReadFile(char *buffer, const size_t size, const size_t start = 0,
                   const size_t transportIndex = 0);
 
+    /**
+     * Address of a range of a single file in memory, see Transport::Map
+     * @return nullptr if the file's transport does not map files
+     */
+    const char *MapFile(const size_t start, const size_t size,
+                        const size_t transportIndex = 0);
+
+    /** Hints a single file's transport that a range will be read soon */
+    void AdviseFile(const size_t start, const size_t size,
+                    const size_t transportIndex = 0);
+
     /**
      * Flush file or files depending on transport index. Throws an exception
      * if transport is not a file when transportIndex > -1.
@@ -6,6 +6,7 @@
  */
 
 #include "adiosStream.h"
+#include "readPattern.h"
 
 #include <cstdlib>
 #include <iostream>
@@ -129,7 +130,31 @@ void adiosStream::putADIOSArray(const std::shared_ptr<VariableInfo> ov)
     }
 }
 
-void adiosStream::getADIOSArray(std::shared_ptr<VariableInfo> ov)
+namespace
+{
+template <class T>
+bool getADIOSSelections(adios2::IO &io, adios2::Engine &engine,
+                        const std::string &name,
+                        const std::vector<adios2::Box<adios2::Dims>> &boxes,
+                        char *buffer)
+{
+    adios2::Variable<T> v = io.InquireVariable<T>(name);
+    if (!v)
+    {
+        return false;
+    }
+    T *a = reinterpret_cast<T *>(buffer);
+    for (const auto &box : boxes)
+    {
+        v.SetSelection(box);
+        engine.Get<T>(v, a);
+        a += selectionsSize({box});
+    }
+    return true;
+}
+} // end anonymous namespace
+
+size_t adiosStream::getADIOSArray(std::shared_ptr<VariableInfo> ov)
 {
     // Allocate memory on first access
     if (!ov->data.size())
@@ -142,7 +167,7 @@ void adiosStream::getADIOSArray(std::shared_ptr<VariableInfo> ov)
         if (!v)
         {
             ov->readFromInput = false;
-            return;
+            return 0;
         }
         v.SetSelection({ov->start, ov->count});
         double *a = reinterpret_cast<double *>(ov->data.data());
@@ -155,7 +180,7 @@ void adiosStream::getADIOSArray(std::shared_ptr<VariableInfo> ov)
         if (!v)
         {
             ov->readFromInput = false;
-            return;
+            return 0;
         }
         v.SetSelection({ov->start, ov->count});
         float *a = reinterpret_cast<float *>(ov->data.data());
@@ -168,13 +193,50 @@ void adiosStream::getADIOSArray(std::shared_ptr<VariableInfo> ov)
         if (!v)
         {
             ov->readFromInput = false;
-            return;
+            return 0;
         }
         v.SetSelection({ov->start, ov->count});
         int *a = reinterpret_cast<int *>(ov->data.data());
         engine.Get<int>(v, a);
         ov->readFromInput = true;
     }
+    return ov->readFromInput ? ov->datasize : 0;
+}
+
+size_t adiosStream::getADIOSPattern(const CommandRead &cmdR,
+                                    std::shared_ptr<VariableInfo> ov,
+                                    const Settings &settings, size_t step)
+{
+    // data read with a pattern does not match the decomposed block
+    ov->readFromInput = false;
+    const auto boxes = readPatternSelections(cmdR, *ov, settings, step);
+    const size_t nbytes = selectionsSize(boxes) * ov->elemsize;
+    if (!nbytes)
+    {
+        return 0;
+    }
+    std::vector<char> &buffer = patternBuffers[ov->name];
+    if (buffer.size() < nbytes)
+    {
+        buffer.resize(nbytes);
+    }
+    bool found = false;
+    if (ov->type == "double")
+    {
+        found = getADIOSSelections<double>(io, engine, ov->name, boxes,
+                                           buffer.data());
+    }
+    else if (ov->type == "float")
+    {
+        found = getADIOSSelections<float>(io, engine, ov->name, boxes,
+                                          buffer.data());
+    }
+    else if (ov->type == "int")
+    {
+        found = getADIOSSelections<int>(io, engine, ov->name, boxes,
+                                        buffer.data());
+    }
+    return found ? nbytes : 0;
 }
 
 /* return true if read-in completed */
@@ -223,9 +285,17 @@ adios2::StepStatus adiosStream::readADIOS(CommandRead *cmdR, Config &cfg,
         std::cout << "    Read data " << std::endl;
     }
 
+    ioBytes = 0;
     for (auto ov : cmdR->variables)
     {
-        getADIOSArray(ov);
+        if (cmdR->pattern == ReadPattern::Full)
+        {
+            ioBytes += getADIOSArray(ov);
+        }
+        else
+        {
+            ioBytes += getADIOSPattern(*cmdR, ov, settings, step);
+        }
     }
 
     if (step == 1 && settings.fixedPattern)
@@ -242,6 +312,7 @@ adios2::StepStatus adiosStream::readADIOS(CommandRead *cmdR, Config &cfg,
 
     engine.EndStep();
     timeEnd = MPI_Wtime();
+    ioTime = timeEnd - timeStart;
     int myRank, totalRanks;
     MPI_Comm_rank(comm, &myRank);
     MPI_Comm_size(comm, &totalRanks);
@@ -367,9 +438,11 @@ void adiosStream::writeADIOS(CommandWrite *cmdW, Config &cfg,
     MPI_Barrier(comm);
     timeStart = MPI_Wtime();
     engine.BeginStep();
+    ioBytes = 0;
     for (const auto &ov : cmdW->variables)
     {
         putADIOSArray(ov);
+        ioBytes += ov->datasize;
     }
 
     if (step == 1 && settings.fixedPattern)
@@ -386,6 +459,7 @@ void adiosStream::writeADIOS(CommandWrite *cmdW, Config &cfg,
 
     engine.EndStep();
     timeEnd = MPI_Wtime();
+    ioTime = timeEnd - timeStart;
     int myRank, totalRanks;
     MPI_Comm_rank(comm, &myRank);
     MPI_Comm_size(comm, &totalRanks);
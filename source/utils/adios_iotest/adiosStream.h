@@ -9,6 +9,8 @@
 #define ADIOSSTREAM_H
 
 #include <cstdio>
+#include <map>
+#include <vector>
 
 #include "adios2.h"
 #include "stream.h"
@@ -37,7 +39,12 @@ private:
     double openTime;
     void defineADIOSArray(const std::shared_ptr<VariableInfo> ov);
     void putADIOSArray(const std::shared_ptr<VariableInfo> ov);
-    void getADIOSArray(std::shared_ptr<VariableInfo> ov);
+    /* buffers for reads with a read pattern, one per variable */
+    std::map<std::string, std::vector<char>> patternBuffers;
+    size_t getADIOSArray(std::shared_ptr<VariableInfo> ov);
+    size_t getADIOSPattern(const CommandRead &cmdR,
+                           std::shared_ptr<VariableInfo> ov,
+                           const Settings &settings, size_t step);
     adios2::StepStatus readADIOS(CommandRead *cmdR, Config &cfg,
                                  const Settings &settings, size_t step);
     void writeADIOS(CommandWrite *cmdW, Config &cfg, const Settings &settings,
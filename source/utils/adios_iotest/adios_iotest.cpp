@@ -12,6 +12,7 @@
 #include "mpi.h"
 
 #include "decomp.h"
+#include "perfReport.h"
 #include "processConfig.h"
 #include "settings.h"
 #include "stream.h"
@@ -76,6 +77,8 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    PerfReport perfReport(cfg);
+
     double timeStart, timeEnd;
     MPI_Barrier(settings.appComm);
     timeStart = MPI_Wtime();
@@ -200,8 +203,9 @@ int main(int argc, char *argv[])
                 std::cout << "App " + std::to_string(settings.appId) + " Step "
                           << step << ": " << std::endl;
             }
-            for (const auto &cmd : cfg.commands)
+            for (size_t cmdIdx = 0; cmdIdx < cfg.commands.size(); ++cmdIdx)
             {
+                const auto &cmd = cfg.commands[cmdIdx];
                 if (!cmd->conditionalStream.empty() &&
                     cfg.condMap.at(cmd->conditionalStream) !=
                         adios2::StepStatus::OK)
@@ -232,12 +236,13 @@ int main(int argc, char *argv[])
                     std::this_thread::sleep_for(
                         std::chrono::microseconds(cmdS->sleepTime_us));
                     adios.ExitComputationBlock();
+                    std::chrono::high_resolution_clock::time_point end =
+                        std::chrono::high_resolution_clock::now();
+                    double t = static_cast<double>((end - start).count()) /
+                               1000000000.0;
+                    perfReport.Record(cmdIdx, t, 0);
                     if (!settings.myRank && settings.verbose)
                     {
-                        std::chrono::high_resolution_clock::time_point end =
-                            std::chrono::high_resolution_clock::now();
-                        double t = static_cast<double>((end - start).count()) /
-                                   1000000000.0;
                         std::cout << " -> Slept for " << t << "  seconds "
                                   << std::endl;
                     }
@@ -286,6 +291,11 @@ int main(int argc, char *argv[])
                     std::chrono::high_resolution_clock::time_point end =
                         std::chrono::high_resolution_clock::now();
                     actualBusyTime_usec += (end - start).count() / 1000;
+                    perfReport.Record(
+                        cmdIdx,
+                        static_cast<double>((end - start).count()) /
+                            1000000000.0,
+                        0);
                     if (!settings.myRank && settings.verbose)
                     {
                         double t = static_cast<double>((end - start).count()) /
@@ -301,6 +311,7 @@ int main(int argc, char *argv[])
                     auto stream = writeStreamMap[cmdW->streamName];
                     // auto io = ioMap[cmdW->groupName];
                     stream->Write(cmdW, cfg, settings, step);
+                    perfReport.Record(cmdIdx, stream->ioTime, stream->ioBytes);
                     break;
                 }
                 case Operation::Read:
@@ -315,6 +326,11 @@ int main(int argc, char *argv[])
                         adios2::StepStatus status =
                             stream->Read(cmdR, cfg, settings, step);
                         statusIt->second = status;
+                        if (status == adios2::StepStatus::OK)
+                        {
+                            perfReport.Record(cmdIdx, stream->ioTime,
+                                              stream->ioBytes);
+                        }
                         switch (status)
                         {
                         case adios2::StepStatus::OK:
@@ -354,6 +370,11 @@ int main(int argc, char *argv[])
             ++step;
         }
 
+        if (!settings.perfReportFileName.empty())
+        {
+            perfReport.Write(settings.perfReportFileName, settings);
+        }
+
         /* Close all streams in order of opening */
         for (const auto &st : streamsInOrder)
         {
@@ -220,11 +220,14 @@ void hdf5Stream::Write(CommandWrite *cmdW, Config &cfg,
     double maxWriteTime, minWriteTime;
     MPI_Barrier(comm);
     timeStart = MPI_Wtime();
+    ioBytes = 0;
     for (const auto &ov : cmdW->variables)
     {
         putHDF5Array(ov, step);
+        ioBytes += ov->datasize;
     }
     timeEnd = MPI_Wtime();
+    ioTime = timeEnd - timeStart;
     if (settings.ioTimer)
     {
         writeTime = timeEnd - timeStart;
@@ -368,11 +371,17 @@ adios2::StepStatus hdf5Stream::Read(CommandRead *cmdR, Config &cfg,
         std::cout << "    Read data " << std::endl;
     }
 
+    ioBytes = 0;
     for (auto ov : cmdR->variables)
     {
         getHDF5Array(ov, step);
+        if (ov->readFromInput)
+        {
+            ioBytes += ov->datasize;
+        }
     }
     timeEnd = MPI_Wtime();
+    ioTime = timeEnd - timeStart;
     if (settings.ioTimer)
     {
         readTime = timeEnd - timeStart;
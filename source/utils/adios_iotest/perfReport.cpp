@@ -0,0 +1,160 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * perfReport.cpp
+ */
+
+#include "perfReport.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <numeric>
+#include <sstream>
+
+namespace
+{
+
+constexpr double MB = 1048576.0;
+
+/* min/avg/max and nearest-rank percentiles of a list of values */
+std::string statsToJSON(std::vector<double> values)
+{
+    std::ostringstream ss;
+    ss << std::setprecision(9);
+    if (values.empty())
+    {
+        ss << "{}";
+        return ss.str();
+    }
+    std::sort(values.begin(), values.end());
+    auto percentile = [&values](double p) {
+        size_t idx = static_cast<size_t>(
+            std::ceil(p / 100.0 * static_cast<double>(values.size())));
+        idx = (idx > 0 ? idx - 1 : 0);
+        return values[std::min(idx, values.size() - 1)];
+    };
+    const double sum = std::accumulate(values.begin(), values.end(), 0.0);
+    ss << "{\"min\": " << values.front()
+       << ", \"avg\": " << sum / static_cast<double>(values.size())
+       << ", \"max\": " << values.back() << ", \"p50\": " << percentile(50.0)
+       << ", \"p90\": " << percentile(90.0)
+       << ", \"p99\": " << percentile(99.0) << "}";
+    return ss.str();
+}
+
+double bandwidthMBs(double bytes, double seconds)
+{
+    return (seconds > 0.0 ? bytes / MB / seconds : 0.0);
+}
+
+} // end anonymous namespace
+
+PerfReport::PerfReport(const Config &cfg)
+: m_Config(cfg), m_Times(cfg.commands.size()), m_Bytes(cfg.commands.size())
+{
+}
+
+void PerfReport::Record(size_t cmdIdx, double seconds, size_t bytes)
+{
+    m_Times[cmdIdx].push_back(seconds);
+    m_Bytes[cmdIdx].push_back(static_cast<double>(bytes));
+}
+
+void PerfReport::Write(const std::string &fileName,
+                       const Settings &settings) const
+{
+    const int nproc = static_cast<int>(settings.nProc);
+    const bool isRoot = (settings.myRank == 0);
+    std::ofstream out;
+    if (isRoot)
+    {
+        out.open(fileName);
+        out << std::setprecision(9);
+        out << "{\n  \"app\": " << settings.appId
+            << ",\n  \"nprocs\": " << settings.nProc
+            << ",\n  \"commands\": [";
+    }
+
+    for (size_t c = 0; c < m_Times.size(); ++c)
+    {
+        int n = static_cast<int>(m_Times[c].size());
+        std::vector<int> counts(isRoot ? nproc : 0);
+        MPI_Gather(&n, 1, MPI_INT, counts.data(), 1, MPI_INT, 0,
+                   settings.appComm);
+        std::vector<int> displs(counts.size(), 0);
+        int total = 0;
+        for (size_t r = 0; r < counts.size(); ++r)
+        {
+            displs[r] = total;
+            total += counts[r];
+        }
+        std::vector<double> times(total), bytes(total);
+        MPI_Gatherv(m_Times[c].data(), n, MPI_DOUBLE, times.data(),
+                    counts.data(), displs.data(), MPI_DOUBLE, 0,
+                    settings.appComm);
+        MPI_Gatherv(m_Bytes[c].data(), n, MPI_DOUBLE, bytes.data(),
+                    counts.data(), displs.data(), MPI_DOUBLE, 0,
+                    settings.appComm);
+        if (!isRoot)
+        {
+            continue;
+        }
+
+        std::vector<double> bandwidths(total);
+        for (int i = 0; i < total; ++i)
+        {
+            bandwidths[i] = bandwidthMBs(bytes[i], times[i]);
+        }
+
+        // aggregated bandwidth of the k-th execution: bytes of all ranks
+        // over the time of the slowest rank
+        const int nExec = *std::min_element(counts.begin(), counts.end());
+        std::vector<double> aggBandwidths(nExec);
+        double totalBytes = std::accumulate(bytes.begin(), bytes.end(), 0.0);
+        for (int k = 0; k < nExec; ++k)
+        {
+            double sumBytes = 0.0, maxTime = 0.0;
+            for (int r = 0; r < nproc; ++r)
+            {
+                sumBytes += bytes[displs[r] + k];
+                maxTime = std::max(maxTime, times[displs[r] + k]);
+            }
+            aggBandwidths[k] = bandwidthMBs(sumBytes, maxTime);
+        }
+
+        out << (c ? "," : "") << "\n    {\n      \"id\": " << c
+            << ",\n      \"command\": \""
+            << CommandName(*m_Config.commands[c]) << "\""
+            << ",\n      \"executions\": " << nExec
+            << ",\n      \"bytes_total\": " << totalBytes
+            << ",\n      \"latency_sec\": " << statsToJSON(times)
+            << ",\n      \"bandwidth_MBps\": " << statsToJSON(bandwidths)
+            << ",\n      \"aggregate_bandwidth_MBps\": "
+            << statsToJSON(aggBandwidths) << ",\n      \"ranks\": [";
+        for (int r = 0; r < nproc; ++r)
+        {
+            auto tBegin = times.begin() + displs[r];
+            auto bBegin = bandwidths.begin() + displs[r];
+            double rankBytes = std::accumulate(bytes.begin() + displs[r],
+                                               bytes.begin() + displs[r] +
+                                                   counts[r],
+                                               0.0);
+            out << (r ? "," : "") << "\n        {\"rank\": " << r
+                << ", \"bytes\": " << rankBytes << ", \"latency_sec\": "
+                << statsToJSON(std::vector<double>(tBegin, tBegin + counts[r]))
+                << ", \"bandwidth_MBps\": "
+                << statsToJSON(std::vector<double>(bBegin, bBegin + counts[r]))
+                << "}";
+        }
+        out << "\n      ]\n    }";
+    }
+
+    if (isRoot)
+    {
+        out << "\n  ]\n}\n";
+        out.close();
+    }
+}
@@ -0,0 +1,43 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * perfReport.h
+ */
+
+#ifndef PERFREPORT_H
+#define PERFREPORT_H
+
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include "processConfig.h"
+#include "settings.h"
+
+/** Collects the latency and the amount of data of every executed command on
+ * a rank and writes a JSON report with per rank and aggregated statistics
+ * (min/avg/max and percentiles) of latency and bandwidth.
+ */
+class PerfReport
+{
+public:
+    PerfReport(const Config &cfg);
+    ~PerfReport() = default;
+
+    /** Record one execution of command cmdIdx (index in cfg.commands) */
+    void Record(size_t cmdIdx, double seconds, size_t bytes);
+
+    /** Collective over settings.appComm. Rank 0 writes the report to
+     * fileName. */
+    void Write(const std::string &fileName, const Settings &settings) const;
+
+private:
+    const Config &m_Config;
+    // per command, per execution
+    std::vector<std::vector<double>> m_Times;
+    std::vector<std::vector<double>> m_Bytes;
+};
+
+#endif /* PERFREPORT_H */
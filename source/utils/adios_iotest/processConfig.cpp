@@ -128,6 +128,34 @@ double stringToDouble(std::vector<std::string> &words, size_t pos,
     return d;
 }
 
+adios2::Dims stringToDims(std::vector<std::string> &words, size_t pos,
+                          std::string lineID)
+{
+    if (words.size() < pos + 1)
+    {
+        adios2::helper::Throw<std::invalid_argument>(
+            "Utils::adios_iotest", "processConfig", "stringToDims",
+            "Line for " + lineID +
+                " is invalid. Missing comma separated list at word position " +
+                std::to_string(pos + 1));
+    }
+
+    adios2::Dims dims;
+    std::istringstream iss(words[pos]);
+    for (std::string item; std::getline(iss, item, ',');)
+    {
+        std::vector<std::string> w = {item};
+        dims.push_back(stringToSizet(w, 0, lineID));
+    }
+    if (dims.empty())
+    {
+        adios2::helper::Throw<std::invalid_argument>(
+            "Utils::adios_iotest", "processConfig", "stringToDims",
+            "Invalid list given for " + lineID + ": " + words[pos]);
+    }
+    return dims;
+}
+
 void processSteps(std::vector<std::string> &words, Config &cfg)
 {
     if (words.size() >= 3)
@@ -375,6 +403,11 @@ void printConfig(const Config &cfg)
 
             std::cout << cmdR->streamName << " using the group "
                       << cmdR->groupName;
+            if (cmdR->pattern != ReadPattern::Full)
+            {
+                std::cout << " with " << ReadPatternName(cmdR->pattern)
+                          << " pattern";
+            }
             if (!cmdR->variables.empty())
             {
                 std::cout << " with selected variables:  ";
@@ -406,6 +439,127 @@ void printVarMaps(Config &cfg, std::string &groupName)
     }
 }
 
+std::string ReadPatternName(const ReadPattern pattern)
+{
+    switch (pattern)
+    {
+    case ReadPattern::Full:
+        return "full";
+    case ReadPattern::Strided:
+        return "strided";
+    case ReadPattern::Hyperslab:
+        return "hyperslab";
+    case ReadPattern::RandomBlock:
+        return "randomblock";
+    case ReadPattern::StepSubset:
+        return "stepsubset";
+    }
+    return "unknown";
+}
+
+std::string CommandName(const Command &cmd)
+{
+    switch (cmd.op)
+    {
+    case Operation::Sleep:
+        return "sleep";
+    case Operation::Busy:
+        return "busy";
+    case Operation::Write:
+    {
+        auto cmdW = dynamic_cast<const CommandWrite *>(&cmd);
+        return "write " + cmdW->streamName;
+    }
+    case Operation::Read:
+    {
+        auto cmdR = dynamic_cast<const CommandRead *>(&cmd);
+        return "read " + cmdR->streamName + " " +
+               ReadPatternName(cmdR->pattern);
+    }
+    }
+    return "unknown";
+}
+
+void checkReadPattern(const CommandRead &cmd, const Settings &settings)
+{
+    if (cmd.pattern == ReadPattern::Full)
+    {
+        return;
+    }
+#ifdef ADIOS2_HAVE_HDF5_PARALLEL
+    if (settings.iolib == IOLib::HDF5)
+    {
+        adios2::helper::Throw<std::invalid_argument>(
+            "Utils::adios_iotest", "processConfig", "checkReadPattern",
+            "Read pattern '" + ReadPatternName(cmd.pattern) +
+                "' is only supported with ADIOS, use 'read' with --hdf5");
+    }
+#endif
+    for (const auto s : cmd.stride)
+    {
+        if (!s)
+        {
+            adios2::helper::Throw<std::invalid_argument>(
+                "Utils::adios_iotest", "processConfig", "checkReadPattern",
+                "Stride values must be greater than zero");
+        }
+    }
+    if (cmd.pattern == ReadPattern::StepSubset && !cmd.stepInterval)
+    {
+        adios2::helper::Throw<std::invalid_argument>(
+            "Utils::adios_iotest", "processConfig", "checkReadPattern",
+            "Step interval must be greater than zero");
+    }
+    if (cmd.pattern == ReadPattern::Hyperslab &&
+        cmd.slabStart.size() != cmd.slabCount.size())
+    {
+        adios2::helper::Throw<std::invalid_argument>(
+            "Utils::adios_iotest", "processConfig", "checkReadPattern",
+            "Hyperslab start " + DimsToString(cmd.slabStart) + " and count " +
+                DimsToString(cmd.slabCount) +
+                " must have the same number of dimensions");
+    }
+    for (const auto &ov : cmd.variables)
+    {
+        if (cmd.pattern == ReadPattern::Hyperslab)
+        {
+            if (cmd.slabStart.size() != ov->ndim)
+            {
+                adios2::helper::Throw<std::invalid_argument>(
+                    "Utils::adios_iotest", "processConfig", "checkReadPattern",
+                    "Hyperslab " + DimsToString(cmd.slabStart) +
+                        " does not match the number of dimensions of "
+                        "variable '" +
+                        ov->name + "'");
+            }
+            for (size_t i = 0; i < ov->ndim; ++i)
+            {
+                if (cmd.slabStart[i] + cmd.slabCount[i] > ov->shape[i])
+                {
+                    adios2::helper::Throw<std::invalid_argument>(
+                        "Utils::adios_iotest", "processConfig",
+                        "checkReadPattern",
+                        "Hyperslab is out of the bounds of variable '" +
+                            ov->name + "' with shape " +
+                            DimsToString(ov->shape));
+                }
+            }
+        }
+        else if (cmd.pattern == ReadPattern::RandomBlock)
+        {
+            if (cmd.blockCount.size() != ov->ndim)
+            {
+                adios2::helper::Throw<std::invalid_argument>(
+                    "Utils::adios_iotest", "processConfig", "checkReadPattern",
+                    "Block size " + DimsToString(cmd.blockCount) +
+                        " does not match the number of dimensions of "
+                        "variable '" +
+                        ov->name + "'");
+            }
+        }
+    }
+}
+
 void globalChecks(const Config &cfg, const Settings &settings)
 {
     for (const auto &cmd : cfg.commands)
@@ -664,7 +818,9 @@ Config processConfig(const Settings &settings, size_t *currentConfigLineNumber)
                     }
                 }
             }
-            else if (key == "read")
+            else if (key == "read" || key == "readstride" ||
+                     key == "readslab" || key == "readrandom" ||
+                     key == "readsteps")
             {
                 if (currentAppId == static_cast<int>(settings.appId))
                 {
@@ -673,8 +829,9 @@ Config processConfig(const Settings &settings, size_t *currentConfigLineNumber)
                         adios2::helper::Throw<std::invalid_argument>(
                             "Utils::adios_iotest", "processConfig",
                             "processConfig",
-                            "Line for 'read' is invalid. Need at least 3 "
-                            "arguments: mode, output name, group name ");
+                            "Line for '" + key +
+                                "' is invalid. Need at least 3 "
+                                "arguments: mode, output name, group name ");
                     }
                     std::string mode(words[1]);
                     std::transform(mode.begin(), mode.end(), mode.begin(),
@@ -691,16 +848,17 @@ Config processConfig(const Settings &settings, size_t *currentConfigLineNumber)
                         adios2::helper::Throw<std::invalid_argument>(
                             "Utils::adios_iotest", "processConfig",
                             "processConfig",
-                            "Group '" + groupName +
-                                "' used in 'read' command is undefined. ");
+                            "Group '" + groupName + "' used in '" + key +
+                                "' command is undefined. ");
                     }
                     if (mode != "next" && mode != "latest")
                     {
                         adios2::helper::Throw<std::invalid_argument>(
                             "Utils::adios_iotest", "processConfig",
                             "processConfig",
-                            "Mode (1st argument) for 'read' is invalid. It "
-                            "must be either 'next' or 'latest'");
+                            "Mode (1st argument) for '" + key +
+                                "' is invalid. It "
+                                "must be either 'next' or 'latest'");
                     }
 
                     double d = -1.0;
@@ -732,11 +890,50 @@ Config processConfig(const Settings &settings, size_t *currentConfigLineNumber)
                     auto cmd = std::make_shared<CommandRead>(
                         streamName, groupName, static_cast<float>(d));
                     cmd->conditionalStream = conditionalStream;
+
+                    // parse the arguments of the read pattern
+                    size_t widx = 5;
+                    if (key == "readstride")
+                    {
+                        cmd->pattern = ReadPattern::Strided;
+                        cmd->stride = stringToDims(words, widx, "stride");
+                        ++widx;
+                    }
+                    else if (key == "readslab")
+                    {
+                        cmd->pattern = ReadPattern::Hyperslab;
+                        cmd->slabStart =
+                            stringToDims(words, widx, "hyperslab start");
+                        cmd->slabCount =
+                            stringToDims(words, widx + 1, "hyperslab count");
+                        widx += 2;
+                    }
+                    else if (key == "readrandom")
+                    {
+                        cmd->pattern = ReadPattern::RandomBlock;
+                        cmd->nBlocks =
+                            stringToSizet(words, widx, "number of blocks");
+                        cmd->blockCount =
+                            stringToDims(words, widx + 1, "block size");
+                        widx += 2;
+                    }
+                    else if (key == "readsteps")
+                    {
+                        cmd->pattern = ReadPattern::StepSubset;
+                        cmd->stepInterval =
+                            stringToSizet(words, widx, "step interval");
+                        ++widx;
+                    }
+                    if (verbose0 && cmd->pattern != ReadPattern::Full)
+                    {
+                        std::cout << "    read pattern = "
+                                  << ReadPatternName(cmd->pattern) << std::endl;
+                    }
+
                     cfg.commands.push_back(cmd);
                     cfg.condMap[streamName] = adios2::StepStatus::OK;
 
                     // parse the optional variable list
-                    size_t widx = 5;
                     while (words.size() > widx && !isComment(words[widx]))
                     {
                         auto vIt = grpIt->second.find(words[widx]);
@@ -776,6 +973,7 @@ Config processConfig(const Settings &settings, size_t *currentConfigLineNumber)
                             cmd->variables.push_back(v);
                         }
                     }
+                    checkReadPattern(*cmd, settings);
                 }
             }
             else if (key == "array")
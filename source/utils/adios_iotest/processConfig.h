@@ -40,6 +40,18 @@ enum Operation
     Read
 };
 
+/* Access pattern of a read command. Full is the default 'read' command,
+ * the others are set by 'readstride', 'readslab', 'readrandom' and
+ * 'readsteps' */
+enum class ReadPattern
+{
+    Full,        // read the decomposed block of the rank
+    Strided,     // read every k-th index of the block in each dimension
+    Hyperslab,   // read the rank's part of a box of the global array
+    RandomBlock, // read fixed size blocks at random positions
+    StepSubset   // read the decomposed block only in every k-th step
+};
+
 class Command
 {
 public:
@@ -84,6 +96,13 @@ public:
     const std::string groupName;
     const float timeout_sec;
     std::vector<std::shared_ptr<VariableInfo>> variables;
+    ReadPattern pattern = ReadPattern::Full;
+    adios2::Dims stride;     // Strided: stride in each dimension
+    adios2::Dims slabStart;  // Hyperslab: global offset of the box
+    adios2::Dims slabCount;  // Hyperslab: global size of the box
+    size_t nBlocks = 0;      // RandomBlock: number of blocks per rank
+    adios2::Dims blockCount; // RandomBlock: size of one block
+    size_t stepInterval = 1; // StepSubset: read in every k-th step
     CommandRead(std::string stream, std::string group,
                 const float timeoutSec = -1.0);
     ~CommandRead();
@@ -112,4 +131,8 @@ const std::vector<std::pair<std::string, size_t>> supportedTypes = {
 
 Config processConfig(const Settings &settings, size_t *currentConfigLineNumber);
 
+/* Name of a command used in verbose output and in the performance report */
+std::string CommandName(const Command &cmd);
+std::string ReadPatternName(const ReadPattern pattern);
+
 #endif /* PROCESS_CONFIG_H */
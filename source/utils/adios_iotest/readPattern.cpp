@@ -0,0 +1,184 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * readPattern.cpp
+ */
+
+#include "readPattern.h"
+
+#include <algorithm>
+#include <random>
+
+#include "decomp.h"
+
+namespace
+{
+
+/* Every k-th index in each dimension of the rank's own block. Dimensions up to
+ * the last strided one are read one index at a time, the dimensions after it
+ * are read in full so that every selection is one contiguous run. */
+std::vector<adios2::Box<adios2::Dims>> stridedSelections(const CommandRead &cmdR,
+                                                         const VariableInfo &ov)
+{
+    std::vector<adios2::Box<adios2::Dims>> boxes;
+    adios2::Dims stride(ov.ndim, 1);
+    size_t lastStrided = 0;
+    bool isStrided = false;
+    for (size_t i = 0; i < ov.ndim && i < cmdR.stride.size(); ++i)
+    {
+        stride[i] = cmdR.stride[i];
+        if (stride[i] > 1)
+        {
+            lastStrided = i;
+            isStrided = true;
+        }
+    }
+    for (size_t i = 0; i < ov.ndim; ++i)
+    {
+        if (!ov.count[i])
+        {
+            return boxes;
+        }
+    }
+    if (!isStrided)
+    {
+        boxes.push_back({ov.start, ov.count});
+        return boxes;
+    }
+
+    adios2::Dims count(ov.count);
+    for (size_t i = 0; i <= lastStrided; ++i)
+    {
+        count[i] = 1;
+    }
+    adios2::Dims pos(lastStrided + 1, 0);
+    while (true)
+    {
+        adios2::Dims start(ov.start);
+        for (size_t i = 0; i <= lastStrided; ++i)
+        {
+            start[i] += pos[i];
+        }
+        boxes.push_back({start, count});
+
+        // advance to the next index, the fastest dimension first
+        size_t d = lastStrided + 1;
+        while (d > 0)
+        {
+            --d;
+            pos[d] += stride[d];
+            if (pos[d] < ov.count[d])
+            {
+                break;
+            }
+            pos[d] = 0;
+            if (d == 0)
+            {
+                return boxes;
+            }
+        }
+    }
+}
+
+/* The rank's part of a box in the global array, decomposed the same way as the
+ * variable itself */
+std::vector<adios2::Box<adios2::Dims>>
+hyperslabSelections(const CommandRead &cmdR, const VariableInfo &ov,
+                    const Settings &settings)
+{
+    std::vector<adios2::Box<adios2::Dims>> boxes;
+    std::vector<size_t> pos(ov.ndim);
+    decompRowMajor(ov.ndim, settings.myRank, ov.decomp.data(), pos.data());
+    adios2::Dims start(ov.ndim), count(ov.ndim);
+    for (size_t i = 0; i < ov.ndim; ++i)
+    {
+        count[i] = cmdR.slabCount[i] / ov.decomp[i];
+        size_t offs = count[i] * pos[i];
+        if (pos[i] == ov.decomp[i] - 1)
+        {
+            count[i] = cmdR.slabCount[i] - offs;
+        }
+        if (!count[i])
+        {
+            return boxes;
+        }
+        start[i] = cmdR.slabStart[i] + offs;
+    }
+    boxes.push_back({start, count});
+    return boxes;
+}
+
+/* Fixed size blocks at random positions of the global array. The generator is
+ * seeded with the rank and step so that runs are reproducible. */
+std::vector<adios2::Box<adios2::Dims>>
+randomBlockSelections(const CommandRead &cmdR, const VariableInfo &ov,
+                      const Settings &settings, size_t step)
+{
+    std::vector<adios2::Box<adios2::Dims>> boxes;
+    std::seed_seq seed{static_cast<unsigned int>(settings.myRank),
+                       static_cast<unsigned int>(step)};
+    std::mt19937_64 generator(seed);
+    adios2::Dims count(ov.ndim);
+    for (size_t i = 0; i < ov.ndim; ++i)
+    {
+        count[i] = std::min(cmdR.blockCount[i], ov.shape[i]);
+        if (!count[i])
+        {
+            return boxes;
+        }
+    }
+    for (size_t b = 0; b < cmdR.nBlocks; ++b)
+    {
+        adios2::Dims start(ov.ndim);
+        for (size_t i = 0; i < ov.ndim; ++i)
+        {
+            std::uniform_int_distribution<size_t> dist(0,
+                                                       ov.shape[i] - count[i]);
+            start[i] = dist(generator);
+        }
+        boxes.push_back({start, count});
+    }
+    return boxes;
+}
+
+} // end anonymous namespace
+
+std::vector<adios2::Box<adios2::Dims>>
+readPatternSelections(const CommandRead &cmdR, const VariableInfo &ov,
+                      const Settings &settings, size_t step)
+{
+    switch (cmdR.pattern)
+    {
+    case ReadPattern::Strided:
+        return stridedSelections(cmdR, ov);
+    case ReadPattern::Hyperslab:
+        return hyperslabSelections(cmdR, ov, settings);
+    case ReadPattern::RandomBlock:
+        return randomBlockSelections(cmdR, ov, settings, step);
+    case ReadPattern::StepSubset:
+        if ((step - 1) % cmdR.stepInterval)
+        {
+            return {};
+        }
+        return {{ov.start, ov.count}};
+    case ReadPattern::Full:
+        break;
+    }
+    return {{ov.start, ov.count}};
+}
+
+size_t selectionsSize(const std::vector<adios2::Box<adios2::Dims>> &boxes)
+{
+    size_t n = 0;
+    for (const auto &box : boxes)
+    {
+        size_t nelems = 1;
+        for (const auto c : box.second)
+        {
+            nelems *= c;
+        }
+        n += nelems;
+    }
+    return n;
+}
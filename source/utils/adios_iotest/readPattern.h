@@ -0,0 +1,33 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * readPattern.h
+ */
+
+#ifndef READPATTERN_H
+#define READPATTERN_H
+
+#include <vector>
+
+#include "adios2.h"
+#include "processConfig.h"
+#include "settings.h"
+
+/** Calculate the selections a rank reads from a variable in a step
+ * according to the read pattern of the read command.
+ * INPUT: cmdR the read command with the pattern definition
+ *        ov the variable as defined in the group of the command
+ *        settings for the rank and the process decomposition
+ *        step the current step (seeds the random block pattern)
+ * OUTPUT: list of boxes in global coordinates. The list is empty if the
+ *         rank reads nothing in this step
+ */
+std::vector<adios2::Box<adios2::Dims>>
+readPatternSelections(const CommandRead &cmdR, const VariableInfo &ov,
+                      const Settings &settings, size_t step);
+
+/** Number of elements in a list of selections */
+size_t selectionsSize(const std::vector<adios2::Box<adios2::Dims>> &boxes);
+
+#endif /* READPATTERN_H */
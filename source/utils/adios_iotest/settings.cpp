@@ -31,12 +31,13 @@ struct option options[] = {{"help", no_argument, NULL, 'h'},
                            {"weak-scaling", no_argument, NULL, 'w'},
                            {"timer", no_argument, NULL, 't'},
                            {"fixed", no_argument, NULL, 'F'},
+                           {"report", required_argument, NULL, 'r'},
 #ifdef ADIOS2_HAVE_HDF5_PARALLEL
                            {"hdf5", no_argument, NULL, 'H'},
 #endif
                            {NULL, 0, NULL, 0}};
 
-static const char *optstring = "-hvswtFHa:c:d:D:x:p:";
+static const char *optstring = "-hvswtFHa:c:d:D:x:p:r:";
 
 size_t Settings::ndigits(size_t n) const
 {
@@ -76,7 +77,9 @@ void Settings::displayHelp()
         << "  -F         turn on fixed I/O pattern explicitly\n"
         << "  -p         specify the path of the output explicitly\n"
         << "  -t         print and dump the timing measured by the I/O "
-           "timer\n\n";
+           "timer\n"
+        << "  -r file    write per command latency and bandwidth statistics "
+           "in JSON format\n\n";
 }
 
 size_t Settings::stringToNumber(const std::string &varName,
@@ -249,6 +252,9 @@ int Settings::processArgs(int argc, char *argv[])
         case 'p':
             outputPath = optarg;
             break;
+        case 'r':
+            perfReportFileName = optarg;
+            break;
         case 1:
             /* This means a field is unknown, or could be multiple arg or bad
              * arg*/
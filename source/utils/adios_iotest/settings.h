@@ -36,6 +36,7 @@ public:
     std::string configFileName;
     std::string adiosConfigFileName;
     std::string outputPath;
+    std::string perfReportFileName; // JSON report of command performance
     unsigned int verbose = 0;
     size_t appId = 0;
     bool isStrongScaling = true; // strong or weak scaling
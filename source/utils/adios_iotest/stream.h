@@ -20,6 +20,9 @@ class Stream
 public:
     const std::string streamName;
     adios2::Mode mode;
+    /* bytes moved and time spent in the last Read or Write call */
+    size_t ioBytes = 0;
+    double ioTime = 0.0;
     Stream(const std::string &streamName, const adios2::Mode mode);
     virtual ~Stream() = 0;
     virtual void Write(CommandWrite *cmdW, Config &cfg,
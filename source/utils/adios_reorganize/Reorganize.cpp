@@ -20,6 +20,8 @@
 #include "Reorganize.h"
 
 #include <assert.h>
+#include <chrono>
+#include <future>
 #include <iomanip>
 #include <string>
 
@@ -78,8 +80,22 @@ Reorganize::Reorganize(int argc, char *argv[])
     int nd = 0;
     int j = 7;
     char *end;
-    while (argc > j && j < 13)
-    { // get max 6 dimensions
+    while (argc > j)
+    {
+        const std::string arg(argv[j]);
+        if (arg.compare(0, 2, "--") == 0)
+        {
+            ParseOption(arg);
+            j++;
+            continue;
+        }
+        if (nd == 6)
+        {
+            helper::Throw<std::invalid_argument>(
+                "Utils", "AdiosReorganize", "Reorganize",
+                "Up to 6 decomposition arguments are supported");
+        }
+        // get max 6 dimensions
         errno = 0;
         decomp_values[nd] = std::strtol(argv[j], &end, 10);
         if (errno || (end != 0 && *end != '\0'))
@@ -95,13 +111,6 @@ Reorganize::Reorganize(int argc, char *argv[])
         j++;
     }
 
-    if (argc > j)
-    {
-        helper::Throw<std::invalid_argument>(
-            "Utils", "AdiosReorganize", "Reorganize",
-            "Up to 6 decomposition arguments are supported");
-    }
-
     int prod = 1;
     for (int i = 0; i < nd; i++)
     {
@@ -134,9 +143,43 @@ void Reorganize::Run()
     print0("Read method parameters  = ", rmethodparam_str);
     print0("Write method            = ", wmethodname);
     print0("Write method parameters = ", wmethodparam_str);
+    switch (m_DecompMode)
+    {
+    case DecompositionMode::Block:
+        print0("Decomposition           = block");
+        break;
+    case DecompositionMode::Slab:
+        print0("Decomposition           = slab along dimension ",
+               m_DecompDim);
+        break;
+    case DecompositionMode::BlockCyclic:
+        print0("Decomposition           = block-cyclic along dimension ",
+               m_DecompDim, " with block size ", m_CyclicBlockSize);
+        break;
+    }
+    print0("Output operator         = ",
+           (m_OperatorType.empty() ? "none" : m_OperatorType));
+
+#if ADIOS2_USE_MPI
+    if (m_Pipeline)
+    {
+        int provided;
+        MPI_Query_thread(&provided);
+        if (provided != MPI_THREAD_MULTIPLE)
+        {
+            print0("WARNING: MPI does not provide MPI_THREAD_MULTIPLE, "
+                   "reading and writing will not be pipelined");
+            m_Pipeline = false;
+        }
+    }
+#endif
+    print0("Pipelined read/write    = ", (m_Pipeline ? "yes" : "no"));
 
     core::ADIOS adios(m_Comm.Duplicate(), "C++");
     core::IO &io = adios.DeclareIO("group");
+    // Output has its own IO so that writing a step can proceed while the
+    // next step is being read into the input IO
+    core::IO &outIO = adios.DeclareIO("output");
 
     print0("Waiting to open stream ", infilename, "...");
 
@@ -145,10 +188,16 @@ void Reorganize::Run()
     core::Engine &rStream = io.Open(infilename, adios2::Mode::Read);
     // rStream.FixedSchedule();
 
-    io.ClearParameters();
-    io.SetEngine(wmethodname);
-    io.SetParameters(wmethodparams);
-    core::Engine &wStream = io.Open(outfilename, adios2::Mode::Write);
+    outIO.SetEngine(wmethodname);
+    outIO.SetParameters(wmethodparams);
+    core::Engine &wStream = outIO.Open(outfilename, adios2::Mode::Write);
+
+    // step being read and step being written
+    std::vector<VarInfo> varinfo;
+    std::vector<VarInfo> writeVarinfo;
+    std::future<StepTiming> writeFuture;
+    StepTiming writeReadTiming;
+    int writeStep = 0;
 
     int steps = 0;
     int curr_step = -1;
@@ -206,16 +255,48 @@ void Reorganize::Run()
         print0("  # of variables: ", variables.size());
         print0("  # of attributes: ", attributes.size());
 
-        retval = ProcessMetadata(rStream, io, variables, attributes, steps);
+        retval = ProcessMetadata(rStream, io, variables, attributes, steps,
+                                 varinfo);
         if (retval)
             break;
 
-        retval = ReadWrite(rStream, wStream, io, variables, steps);
-        if (retval)
-            break;
+        // In pipelined mode this read overlaps with writing the previous step
+        StepTiming readTiming = Read(rStream, io, varinfo);
+
+        // The output IO can only be modified when no write is in progress
+        if (writeFuture.valid())
+        {
+            ReportStep(writeStep, writeReadTiming, writeFuture.get());
+            CleanUpStep(writeVarinfo);
+        }
+
+        DefineOutput(io, outIO, varinfo);
+        writeVarinfo = std::move(varinfo);
+        varinfo.clear();
+        writeReadTiming = readTiming;
+        writeStep = steps;
+
+        if (m_Pipeline)
+        {
+            writeFuture =
+                std::async(std::launch::async, &Reorganize::Write, this,
+                           std::ref(wStream), std::ref(outIO),
+                           std::cref(writeVarinfo));
+        }
+        else
+        {
+            ReportStep(writeStep, writeReadTiming,
+                       Write(wStream, outIO, writeVarinfo));
+            CleanUpStep(writeVarinfo);
+        }
+    }
 
-        CleanUpStep(io);
+    if (writeFuture.valid())
+    {
+        ReportStep(writeStep, writeReadTiming, writeFuture.get());
+        CleanUpStep(writeVarinfo);
     }
+    CleanUpStep(varinfo);
 
     rStream.Close();
     wStream.Close();
@@ -261,6 +342,75 @@ Params Reorganize::parseParams(const std::string &param_str)
     return helper::BuildParametersMap(kvs, '=');
 }
 
+void Reorganize::ParseOption(const std::string &arg)
+{
+    const size_t eq = arg.find('=');
+    const std::string key = arg.substr(0, eq);
+    const std::string value =
+        (eq == std::string::npos ? std::string() : arg.substr(eq + 1));
+
+    if (key == "--pipeline")
+    {
+        m_Pipeline = true;
+    }
+    else if (key == "--decomp")
+    {
+        // block | slab:<dim> | cyclic:<dim>:<blocksize>
+        std::vector<std::string> fields;
+        std::istringstream ss(value);
+        for (std::string f; std::getline(ss, f, ':');)
+        {
+            fields.push_back(f);
+        }
+        std::string mode = (fields.empty() ? std::string() : fields[0]);
+        std::transform(mode.begin(), mode.end(), mode.begin(), ::tolower);
+        if (mode == "block" && fields.size() == 1)
+        {
+            m_DecompMode = DecompositionMode::Block;
+        }
+        else if (mode == "slab" && fields.size() == 2)
+        {
+            m_DecompMode = DecompositionMode::Slab;
+            m_DecompDim = helper::StringToSizeT(fields[1], arg);
+        }
+        else if (mode == "cyclic" && fields.size() == 3)
+        {
+            m_DecompMode = DecompositionMode::BlockCyclic;
+            m_DecompDim = helper::StringToSizeT(fields[1], arg);
+            m_CyclicBlockSize = helper::StringToSizeT(fields[2], arg);
+            if (!m_CyclicBlockSize)
+            {
+                helper::Throw<std::invalid_argument>(
+                    "Utils", "AdiosReorganize", "ParseOption",
+                    "Block size must be greater than zero in " + arg);
+            }
+        }
+        else
+        {
+            PrintUsage();
+            helper::Throw<std::invalid_argument>(
+                "Utils", "AdiosReorganize", "ParseOption",
+                "Invalid decomposition " + arg +
+                    ", use block, slab:<dim> or cyclic:<dim>:<blocksize>");
+        }
+    }
+    else if (key == "--operator")
+    {
+        m_OperatorType = value;
+    }
+    else if (key == "--operator-params")
+    {
+        m_OperatorParams = parseParams(value);
+    }
+    else
+    {
+        PrintUsage();
+        helper::Throw<std::invalid_argument>("Utils", "AdiosReorganize",
+                                             "ParseOption",
+                                             "Unknown option " + arg);
+    }
+}
+
 void Reorganize::ParseArguments()
 {
     rmethodparams = parseParams(rmethodparam_str);
@@ -312,7 +462,26 @@ void Reorganize::PrintUsage() const noexcept
            "values,\n"
            "            will be decomposed with using the appropriate number "
            "of\n"
-           "            values."
+           "            values.\n"
+           "Options (after the write method parameters):\n"
+           "    --decomp=block          N-dim blocks given by <decomposition> "
+           "(default)\n"
+           "    --decomp=slab:D         one slab per process along dimension "
+           "D\n"
+           "    --decomp=cyclic:D:B     blocks of B elements along dimension "
+           "D,\n"
+           "                            assigned to processes round-robin\n"
+           "    --pipeline              read the next step while writing the "
+           "current one\n"
+           "                            (MPI must provide "
+           "MPI_THREAD_MULTIPLE)\n"
+           "    --operator=TYPE         compress output arrays with operator "
+           "TYPE,\n"
+           "                            e.g. zfp, sz, blosc, bzip2. By "
+           "default\n"
+           "                            the output is not compressed\n"
+           "    --operator-params=\"P\"  operator parameters (comma-separated "
+           "list)"
         << std::endl;
 }
 
@@ -320,17 +489,15 @@ void Reorganize::PrintExamples() const noexcept {}
 
 void Reorganize::SetParameters(const std::string argument, const bool isLong) {}
 
-std::vector<VarInfo> varinfo;
-
 // cleanup all info from previous step except
 // do
-//   remove all variable and attribute definitions from output group
 //   free all varinfo (will be inquired again at next step)
 //   free read buffer (required size may change at next step)
 // do NOT
+//   remove variable and attribute definitions from output group
 //   destroy group
 //
-void Reorganize::CleanUpStep(core::IO &io)
+void Reorganize::CleanUpStep(std::vector<VarInfo> &varinfo)
 {
     for (auto &vi : varinfo)
     {
@@ -340,8 +507,6 @@ void Reorganize::CleanUpStep(core::IO &io)
         }
     }
     varinfo.clear();
-    // io.RemoveAllVariables();
-    // io.RemoveAllAttributes();
 }
 
 template <typename T>
@@ -369,17 +534,20 @@ Reorganize::Decompose(int numproc, int rank, VarInfo &vi,
     }
 
     /* Handle local array: only one block for now */
-    if (vi.v->m_ShapeID == adios2::ShapeID::LocalArray)
+    if (vi.shapeID == adios2::ShapeID::LocalArray)
     {
         if (rank == 0)
         {
+            VarBlock block;
             writesize = 1;
             for (size_t i = 0; i < vi.v->m_Count.size(); i++)
             {
                 writesize *= vi.v->m_Count[i];
-                // vi.start.push_back(0);
-                vi.count.push_back(vi.v->m_Count[i]);
+                // block.start.push_back(0);
+                block.count.push_back(vi.v->m_Count[i]);
             }
+            block.nelems = writesize;
+            vi.blocks.push_back(block);
         }
         else
         {
@@ -388,19 +556,38 @@ Reorganize::Decompose(int numproc, int rank, VarInfo &vi,
         return writesize;
     }
 
-    size_t ndim = vi.v->Shape().size();
+    size_t ndim = vi.shape.size();
 
     /* Scalars */
     if (ndim == 0)
     {
         // scalars -> rank 0 writes them
         if (rank == 0)
+        {
             writesize = 1;
+            VarBlock block;
+            block.nelems = 1;
+            vi.blocks.push_back(block);
+        }
         else
             writesize = 0;
         return writesize;
     }
 
+    if (m_DecompMode == DecompositionMode::BlockCyclic)
+    {
+        return DecomposeBlockCyclic(numproc, rank, vi);
+    }
+
+    /* Slabs: all processes along one dimension */
+    std::vector<int> slabnp;
+    if (m_DecompMode == DecompositionMode::Slab)
+    {
+        slabnp.assign(ndim, 1);
+        slabnp[std::min(m_DecompDim, ndim - 1)] = numproc;
+        np = slabnp.data();
+    }
+
     /* Global Arrays */
     /* calculate this process' position in the n-dim space
     0 1 2
@@ -425,8 +612,9 @@ Reorganize::Decompose(int numproc, int rank, VarInfo &vi,
     */
     int nps = 1;
     std::vector<int> pos(ndim); // rank's position in each dimensions
-    vi.start.reserve(ndim);
-    vi.count.reserve(ndim);
+    VarBlock block;
+    block.start.reserve(ndim);
+    block.count.reserve(ndim);
 
     size_t i = 0;
     for (i = 0; i < ndim - 1; i++)
@@ -462,30 +650,65 @@ Reorganize::Decompose(int numproc, int rank, VarInfo &vi,
         }
         else
         {
-            count = vi.v->Shape()[i] / np[i];
+            count = vi.shape[i] / np[i];
             start = count * pos[i];
             if (pos[i] == np[i] - 1)
             {
                 // last one in the dimension may need to read more than the rest
-                count = vi.v->Shape()[i] - count * (np[i] - 1);
+                count = vi.shape[i] - count * (np[i] - 1);
             }
         }
-        vi.start.push_back(start);
-        vi.count.push_back(count);
+        block.start.push_back(start);
+        block.count.push_back(count);
         writesize *= count;
     }
-    ints = VectorToString(vi.count);
+    ints = VectorToString(block.count);
     std::cout << "rank " << rank << ": ldims in " << ndim << "-D space = {"
               << ints << "}" << std::endl;
-    ints = VectorToString(vi.start);
+    ints = VectorToString(block.start);
     std::cout << "rank " << rank << ": offsets in " << ndim << "-D space = {"
               << ints << "}" << std::endl;
+    if (writesize)
+    {
+        block.nelems = writesize;
+        vi.blocks.push_back(block);
+    }
+    return writesize;
+}
+
+size_t Reorganize::DecomposeBlockCyclic(int numproc, int rank, VarInfo &vi)
+{
+    const size_t ndim = vi.shape.size();
+    const size_t d = std::min(m_DecompDim, ndim - 1);
+    const size_t nblocks =
+        (vi.shape[d] + m_CyclicBlockSize - 1) / m_CyclicBlockSize;
+
+    size_t writesize = 0;
+    for (size_t b = static_cast<size_t>(rank); b < nblocks;
+         b += static_cast<size_t>(numproc))
+    {
+        VarBlock block;
+        block.start.assign(ndim, 0);
+        block.count = vi.shape;
+        block.start[d] = b * m_CyclicBlockSize;
+        block.count[d] =
+            std::min(m_CyclicBlockSize, vi.shape[d] - block.start[d]);
+        block.nelems = helper::GetTotalSize(block.count);
+        if (block.nelems)
+        {
+            writesize += block.nelems;
+            vi.blocks.push_back(block);
+        }
+    }
+    std::cout << "rank " << rank << ": " << vi.blocks.size() << " blocks of "
+              << m_CyclicBlockSize << " along dimension " << d << std::endl;
     return writesize;
 }
 
 int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io,
                                 const core::VarMap &variables,
-                                const core::AttrMap &attributes, int step)
+                                const core::AttrMap &attributes, int step,
+                                std::vector<VarInfo> &varinfo)
 {
     int retval = 0;
 
@@ -526,6 +749,13 @@ int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io,
 
         if (variable != nullptr)
         {
+            varinfo[varidx].name = name;
+            varinfo[varidx].type = type;
+            varinfo[varidx].shapeID = variable->m_ShapeID;
+            if (variable->m_ShapeID == adios2::ShapeID::GlobalArray)
+            {
+                varinfo[varidx].shape = variable->Shape();
+            }
 
             // print variable type and dimensions
             if (!m_Rank)
@@ -614,38 +844,27 @@ int Reorganize::ProcessMetadata(core::Engine &rStream, core::IO &io,
     return retval;
 }
 
-int Reorganize::ReadWrite(core::Engine &rStream, core::Engine &wStream,
-                          core::IO &io, const core::VarMap &variables, int step)
+StepTiming Reorganize::Read(core::Engine &rStream, core::IO &io,
+                            std::vector<VarInfo> &varinfo)
 {
-    int retval = 0;
-
-    size_t nvars = variables.size();
-    if (nvars != varinfo.size())
-    {
-        helper::Log(
-            "Util", "Reorganize", "ReadWrite",
-            "Invalid program state, number of variables (" +
-                std::to_string(nvars) +
-                ") to read does not match the number of processed variables (" +
-                std::to_string(varinfo.size()) + ")",
-            m_Rank, m_Rank, 0, 0, helper::FATALERROR);
-    }
+    StepTiming timing;
+    auto tStart = std::chrono::steady_clock::now();
 
     /*
      * Read all variables into memory
      */
-    for (size_t varidx = 0; varidx < nvars; ++varidx)
+    for (auto &vi : varinfo)
     {
-        if (varinfo[varidx].v != nullptr)
+        if (vi.v != nullptr)
         {
-            const std::string &name = varinfo[varidx].v->m_Name;
-            assert(varinfo[varidx].readbuf == nullptr);
-            if (varinfo[varidx].writesize != 0)
+            const std::string &name = vi.name;
+            assert(vi.readbuf == nullptr);
+            if (vi.writesize != 0)
             {
                 // read variable subset
                 std::cout << "rank " << m_Rank << ": Read variable " << name
                           << std::endl;
-                const DataType type = variables.at(name)->m_Type;
+                const DataType type = vi.type;
                 if (type == DataType::Struct)
                 {
                     // not supported
@@ -653,43 +872,143 @@ int Reorganize::ReadWrite(core::Engine &rStream, core::Engine &wStream,
 #define declare_template_instantiation(T)                                      \
     else if (type == helper::GetDataType<T>())                                 \
     {                                                                          \
-        varinfo[varidx].readbuf = calloc(1, varinfo[varidx].writesize);        \
-        if (varinfo[varidx].count.size() == 0)                                 \
+        vi.readbuf = calloc(1, vi.writesize);                                  \
+        T *data = reinterpret_cast<T *>(vi.readbuf);                           \
+        for (const auto &block : vi.blocks)                                    \
         {                                                                      \
-            rStream.Get<T>(name,                                               \
-                           reinterpret_cast<T *>(varinfo[varidx].readbuf),     \
-                           adios2::Mode::Sync);                                \
-        }                                                                      \
-        else                                                                   \
-        {                                                                      \
-            varinfo[varidx].v->SetSelection(                                   \
-                {varinfo[varidx].start, varinfo[varidx].count});               \
-            rStream.Get<T>(name,                                               \
-                           reinterpret_cast<T *>(varinfo[varidx].readbuf));    \
+            if (block.count.size() == 0)                                       \
+            {                                                                  \
+                rStream.Get<T>(name, data, adios2::Mode::Sync);                \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                vi.v->SetSelection({block.start, block.count});                \
+                rStream.Get<T>(name, data);                                    \
+            }                                                                  \
+            data += block.nelems;                                              \
         }                                                                      \
     }
                 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
+                timing.bytes += vi.writesize;
             }
         }
     }
     rStream.EndStep(); // read in data into allocated pointers
 
+    timing.seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - tStart)
+                         .count();
+    return timing;
+}
+
+void Reorganize::DefineOutput(core::IO &inIO, core::IO &outIO,
+                              const std::vector<VarInfo> &varinfo)
+{
+    /*
+     * Copy new attributes
+     */
+    for (const auto &attributePair : inIO.GetAttributes())
+    {
+        const std::string &name = attributePair.first;
+        const DataType type = attributePair.second->m_Type;
+        if (outIO.InquireAttributeType(name) != DataType::None)
+        {
+            continue;
+        }
+        if (type == DataType::Struct)
+        {
+            // not supported
+        }
+#define declare_template_instantiation(T)                                      \
+    else if (type == helper::GetDataType<T>())                                 \
+    {                                                                          \
+        core::Attribute<T> *a = inIO.InquireAttribute<T>(name);                \
+        if (a->m_IsSingleValue)                                                \
+        {                                                                      \
+            outIO.DefineAttribute<T>(name, a->m_DataSingleValue);              \
+        }                                                                      \
+        else                                                                   \
+        {                                                                      \
+            outIO.DefineAttribute<T>(name, a->m_DataArray.data(),              \
+                                     a->m_DataArray.size());                   \
+        }                                                                      \
+    }
+        ADIOS2_FOREACH_ATTRIBUTE_STDTYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+    }
+
+    /*
+     * Define new variables, update the shape of existing ones
+     */
+    for (const auto &vi : varinfo)
+    {
+        if (vi.v == nullptr)
+        {
+            continue;
+        }
+        if (vi.type == DataType::Struct)
+        {
+            // not supported
+        }
+#define declare_template_instantiation(T)                                      \
+    else if (vi.type == helper::GetDataType<T>())                              \
+    {                                                                          \
+        core::Variable<T> *v = outIO.InquireVariable<T>(vi.name);              \
+        if (v == nullptr)                                                      \
+        {                                                                      \
+            if (vi.shapeID == adios2::ShapeID::GlobalArray)                    \
+            {                                                                  \
+                v = &outIO.DefineVariable<T>(vi.name, vi.shape,                \
+                                             Dims(vi.shape.size(), 0),         \
+                                             vi.shape);                        \
+            }                                                                  \
+            else if (vi.shapeID == adios2::ShapeID::LocalArray)                \
+            {                                                                  \
+                v = &outIO.DefineVariable<T>(vi.name, {}, {}, vi.v->m_Count);  \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                v = &outIO.DefineVariable<T>(vi.name);                         \
+            }                                                                  \
+            if (!m_OperatorType.empty() &&                                     \
+                vi.shapeID != adios2::ShapeID::GlobalValue)                    \
+            {                                                                  \
+                v->AddOperation(m_OperatorType, m_OperatorParams);             \
+            }                                                                  \
+        }                                                                      \
+        else if (vi.shapeID == adios2::ShapeID::GlobalArray &&                 \
+                 v->Shape() != vi.shape)                                       \
+        {                                                                      \
+            v->SetShape(vi.shape);                                             \
+        }                                                                      \
+    }
+        ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
+#undef declare_template_instantiation
+    }
+}
+
+StepTiming Reorganize::Write(core::Engine &wStream, core::IO &outIO,
+                             const std::vector<VarInfo> &varinfo)
+{
+    StepTiming timing;
+    auto tStart = std::chrono::steady_clock::now();
+
     /*
      * Write all variables
      */
     wStream.BeginStep();
-    for (size_t varidx = 0; varidx < nvars; ++varidx)
+    for (const auto &vi : varinfo)
     {
-        if (varinfo[varidx].v != nullptr)
+        if (vi.v != nullptr)
         {
-            const std::string &name = varinfo[varidx].v->m_Name;
-            if (varinfo[varidx].writesize != 0)
+            const std::string &name = vi.name;
+            if (vi.writesize != 0)
             {
                 // Write variable subset
                 std::cout << "rank " << m_Rank << ": Write variable " << name
                           << std::endl;
-                const DataType type = variables.at(name)->m_Type;
+                const DataType type = vi.type;
                 if (type == DataType::Struct)
                 {
                     // not supported
@@ -697,33 +1016,64 @@ int Reorganize::ReadWrite(core::Engine &rStream, core::Engine &wStream,
 #define declare_template_instantiation(T)                                      \
     else if (type == helper::GetDataType<T>())                                 \
     {                                                                          \
-        if (varinfo[varidx].count.size() == 0)                                 \
-        {                                                                      \
-            wStream.Put<T>(name,                                               \
-                           reinterpret_cast<T *>(varinfo[varidx].readbuf),     \
-                           adios2::Mode::Sync);                                \
-        }                                                                      \
-        else if (varinfo[varidx].v->m_ShapeID == adios2::ShapeID::LocalArray)  \
+        core::Variable<T> *v = outIO.InquireVariable<T>(name);                 \
+        T *data = reinterpret_cast<T *>(vi.readbuf);                           \
+        for (const auto &block : vi.blocks)                                    \
         {                                                                      \
-            wStream.Put<T>(name,                                               \
-                           reinterpret_cast<T *>(varinfo[varidx].readbuf),     \
-                           adios2::Mode::Sync);                                \
-        }                                                                      \
-        else                                                                   \
-        {                                                                      \
-            varinfo[varidx].v->SetSelection(                                   \
-                {varinfo[varidx].start, varinfo[varidx].count});               \
-            wStream.Put<T>(name,                                               \
-                           reinterpret_cast<T *>(varinfo[varidx].readbuf));    \
+            if (block.count.size() == 0)                                       \
+            {                                                                  \
+                wStream.Put<T>(*v, data, adios2::Mode::Sync);                  \
+            }                                                                  \
+            else if (vi.shapeID == adios2::ShapeID::LocalArray)                \
+            {                                                                  \
+                v->SetSelection({{}, block.count});                            \
+                wStream.Put<T>(*v, data, adios2::Mode::Sync);                  \
+            }                                                                  \
+            else                                                               \
+            {                                                                  \
+                v->SetSelection({block.start, block.count});                   \
+                wStream.Put<T>(*v, data);                                      \
+            }                                                                  \
+            data += block.nelems;                                              \
         }                                                                      \
     }
                 ADIOS2_FOREACH_STDTYPE_1ARG(declare_template_instantiation)
 #undef declare_template_instantiation
+                timing.bytes += vi.writesize;
             }
         }
     }
     wStream.EndStep(); // write output buffer to file
-    return retval;
+
+    timing.seconds = std::chrono::duration<double>(
+                         std::chrono::steady_clock::now() - tStart)
+                         .count();
+    return timing;
+}
+
+void Reorganize::ReportStep(int step, const StepTiming &readTiming,
+                            const StepTiming &writeTiming)
+{
+    // total bytes over all processes, time of the slowest process
+    uint64_t bytes[2] = {readTiming.bytes, writeTiming.bytes};
+    double seconds[2] = {readTiming.seconds, writeTiming.seconds};
+    m_Comm.ReduceInPlace(bytes, 2, helper::Comm::Op::Sum, 0);
+    m_Comm.ReduceInPlace(seconds, 2, helper::Comm::Op::Max, 0);
+    const double MB = 1048576.0;
+    auto rate = [MB](uint64_t b, double s) {
+        return (s > 0.0 ? static_cast<double>(b) / MB / s : 0.0);
+    };
+    if (!m_Rank)
+    {
+        std::cout << std::fixed << std::setprecision(3) << "Step " << step
+                  << " throughput: read "
+                  << static_cast<double>(bytes[0]) / MB << " MB in "
+                  << seconds[0] << " s (" << rate(bytes[0], seconds[0])
+                  << " MB/s), write " << static_cast<double>(bytes[1]) / MB
+                  << " MB in " << seconds[1] << " s ("
+                  << rate(bytes[1], seconds[1]) << " MB/s)" << std::endl;
+        std::cout.unsetf(std::ios::floatfield);
+    }
 }
 
 } // end namespace utils
@@ -20,14 +20,38 @@ namespace adios2
 namespace utils
 {
 
-struct VarInfo
+struct VarBlock
 {
-    core::VariableBase *v = nullptr;
-    std::string type;
     Dims start;
     Dims count;
+    size_t nelems = 0; // number of elements in block
+};
+
+struct VarInfo
+{
+    core::VariableBase *v = nullptr; // variable in the input IO
+    std::string name;
+    DataType type = DataType::None;
+    ShapeID shapeID = ShapeID::Unknown;
+    Dims shape;
+    std::vector<VarBlock> blocks; // subsets this process reads and writes
     size_t writesize = 0; // size of subset this process writes, 0: do not write
-    void *readbuf = nullptr; // read in buffer
+    void *readbuf = nullptr; // read in buffer, all blocks one after the other
+};
+
+/** Decomposition of global arrays in the output */
+enum class DecompositionMode
+{
+    Block,      // N-dim blocks given by the decomposition values
+    Slab,       // slabs along one dimension, one per process
+    BlockCyclic // fixed size blocks along one dimension, round-robin
+};
+
+/** Timing of reading or writing one step on this process */
+struct StepTiming
+{
+    double seconds = 0.0;
+    uint64_t bytes = 0;
 };
 
 class Reorganize : public Utils
@@ -52,7 +76,9 @@ private:
     void PrintExamples() const noexcept final;
     void SetParameters(const std::string argument, const bool isLong) final;
 
-    void CleanUpStep(core::IO &io);
+    void ParseOption(const std::string &arg);
+
+    void CleanUpStep(std::vector<VarInfo> &varinfo);
 
     template <typename T>
     std::string VectorToString(const T &v);
@@ -60,11 +86,19 @@ private:
     size_t Decompose(int numproc, int rank, VarInfo &vi,
                      const int *np // number of processes in each dimension
     );
+    size_t DecomposeBlockCyclic(int numproc, int rank, VarInfo &vi);
     int ProcessMetadata(core::Engine &rStream, core::IO &io,
                         const core::VarMap &variables,
-                        const core::AttrMap &attributes, int step);
-    int ReadWrite(core::Engine &rStream, core::Engine &wStream, core::IO &io,
-                  const core::VarMap &variables, int step);
+                        const core::AttrMap &attributes, int step,
+                        std::vector<VarInfo> &varinfo);
+    StepTiming Read(core::Engine &rStream, core::IO &io,
+                    std::vector<VarInfo> &varinfo);
+    void DefineOutput(core::IO &inIO, core::IO &outIO,
+                      const std::vector<VarInfo> &varinfo);
+    StepTiming Write(core::Engine &wStream, core::IO &outIO,
+                     const std::vector<VarInfo> &varinfo);
+    void ReportStep(int step, const StepTiming &readTiming,
+                    const StepTiming &writeTiming);
     Params parseParams(const std::string &param_str);
 
     // Input arguments
@@ -101,6 +135,18 @@ private:
 
     int decomp_values[10] = {1, 1, 1, 1, 1, 1, 1, 1, 1, 1};
 
+    // Output decomposition (--decomp)
+    DecompositionMode m_DecompMode = DecompositionMode::Block;
+    size_t m_DecompDim = 0;        // dimension for Slab and BlockCyclic
+    size_t m_CyclicBlockSize = 1;  // block size for BlockCyclic
+
+    // Overlap reading the next step with writing the current one (--pipeline)
+    bool m_Pipeline = false;
+
+    // Operator applied to output arrays (--operator), empty: strip operators
+    std::string m_OperatorType;
+    Params m_OperatorParams;
+
     template <typename Arg, typename... Args>
     void print0(Arg &&arg, Args &&... args);
 
@@ -20,7 +20,9 @@
 int main(int argc, char *argv[])
 {
 #if ADIOS2_USE_MPI
-    MPI_Init(&argc, &argv);
+    // --pipeline writes from a separate thread
+    int provided;
+    MPI_Init_thread(&argc, &argv, MPI_THREAD_MULTIPLE, &provided);
 #endif
 
     try
@@ -46,21 +46,26 @@ def ReadIndex(f, fileSize):
                                offset=pos)
         pos = pos + 8
         print("Record '{0}', length = {1}".format(record, reclen))
-        if record == 's':
+        if record == 's' or record == 'c':
             # print("Step record, length = {0}".format(reclen))
-            data = np.frombuffer(table, dtype=np.uint64, count=3,
+            # 'c': compressed metadata, uncompressed size after the size
+            nfields = 4 if record == 'c' else 3
+            data = np.frombuffer(table, dtype=np.uint64, count=nfields,
                                  offset=pos)
             stepstr = str(step).ljust(6)
             mdatapos = str(data[0]).ljust(10)
             mdatasize = str(data[1]).ljust(10)
-            flushcount = str(data[2]).ljust(3)
-            FlushCount = data[2]
+            flushcount = str(data[nfields - 1]).ljust(3)
+            FlushCount = data[nfields - 1]
 
             print("|   Step = " + stepstr + "| MetadataPos = " + mdatapos +
                   " |  MetadataSize = " + mdatasize + "   | FlushCount = " +
                   flushcount + "|")
+            if record == 'c':
+                print("|   Metadata is compressed, uncompressed size = " +
+                      str(data[2]))
 
-            pos = pos + 3 * 8
+            pos = pos + nfields * 8
 
             for Writer in range(0, WriterCount):
                 start = " Writer " + str(Writer) + " data "
@@ -0,0 +1,140 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+
+#include <adios2_c.h>
+
+#if ADIOS2_USE_MPI
+#include <mpi.h>
+#endif
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+class EngineMetricsTests_C_API : public ::testing::Test
+{
+public:
+    EngineMetricsTests_C_API() = default;
+};
+
+namespace
+{
+std::map<std::string, double> ToMap(const adios2_metrics *metrics)
+{
+    std::map<std::string, double> result;
+    for (size_t i = 0; i < metrics->nmetrics; ++i)
+    {
+        result[metrics->names[i]] = metrics->values[i];
+    }
+    return result;
+}
+}
+
+TEST_F(EngineMetricsTests_C_API, BP5WriteRead)
+{
+    const std::string fname("EngineMetrics_c.bp");
+    int mpiRank = 0, mpiSize = 1;
+    const size_t Nx = 8;
+    const size_t NSteps = 3;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2_adios *adios = adios2_init(MPI_COMM_WORLD, adios2_debug_mode_on);
+#else
+    adios2_adios *adios = adios2_init(adios2_debug_mode_on);
+#endif
+    {
+        adios2_io *io = adios2_declare_io(adios, "Write");
+        adios2_set_engine(io, "BP5");
+        const std::vector<std::size_t> shape{static_cast<size_t>(Nx * mpiSize)};
+        const std::vector<std::size_t> start{static_cast<size_t>(Nx * mpiRank)};
+        const std::vector<std::size_t> count{Nx};
+        std::vector<double> data(Nx, 1.0);
+
+        adios2_variable *var = adios2_define_variable(
+            io, "r64", adios2_type_double, 1, shape.data(), start.data(),
+            count.data(), adios2_constant_dims_true);
+
+        adios2_engine *writer =
+            adios2_open(io, fname.data(), adios2_mode_write);
+        adios2_step_status status;
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            adios2_begin_step(writer, adios2_step_mode_append, -1., &status);
+            adios2_put(writer, var, data.data(), adios2_mode_deferred);
+            adios2_end_step(writer);
+        }
+
+        adios2_metrics *metrics = adios2_engine_get_metrics(writer);
+        ASSERT_NE(metrics, nullptr);
+        std::map<std::string, double> values = ToMap(metrics);
+        adios2_free_metrics(metrics);
+        EXPECT_EQ(values.at("steps"), static_cast<double>(NSteps));
+        EXPECT_GE(values.at("data_bytes"),
+                  static_cast<double>(NSteps * Nx * sizeof(double)));
+        EXPECT_EQ(values.at("endstep_calls"), static_cast<double>(NSteps));
+
+        adios2_close(writer);
+    }
+    {
+        adios2_io *io = adios2_declare_io(adios, "Read");
+        adios2_set_engine(io, "BP5");
+        adios2_engine *reader = adios2_open(io, fname.data(), adios2_mode_read);
+        adios2_step_status status;
+        adios2_begin_step(reader, adios2_step_mode_read, -1., &status);
+        ASSERT_EQ(status, adios2_step_status_ok);
+        adios2_end_step(reader);
+
+        adios2_metrics *metrics = adios2_engine_get_metrics(reader);
+        ASSERT_NE(metrics, nullptr);
+        std::map<std::string, double> values = ToMap(metrics);
+        adios2_free_metrics(metrics);
+        // steps available to the reader
+        EXPECT_EQ(values.at("steps"), static_cast<double>(NSteps));
+
+        adios2_close(reader);
+    }
+    {
+        // engines without metrics return an empty set
+        adios2_io *io = adios2_declare_io(adios, "Null");
+        adios2_set_engine(io, "NULL");
+        adios2_engine *nullWriter =
+            adios2_open(io, fname.data(), adios2_mode_write);
+        adios2_metrics *metrics = adios2_engine_get_metrics(nullWriter);
+        ASSERT_NE(metrics, nullptr);
+        EXPECT_EQ(metrics->nmetrics, 0);
+        adios2_free_metrics(metrics);
+        adios2_close(nullWriter);
+    }
+    // invalid handle
+    EXPECT_EQ(adios2_engine_get_metrics(nullptr), nullptr);
+
+    adios2_finalize(adios);
+}
+
+//******************************************************************************
+// main
+//******************************************************************************
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,51 @@
+#
+# Distributed under the OSI-approved Apache License, Version 2.0.  See
+# accompanying file Copyright.txt for details.
+#
+# TestBPEngineMetrics_nompi.py
+#
+
+import numpy as np
+import adios2
+
+Nx = 10
+NSteps = 4
+data = np.arange(Nx, dtype=np.float64)
+
+adios = adios2.ADIOS()
+
+# ADIOS write
+ioWrite = adios.DeclareIO("ioWriter")
+ioWrite.SetEngine("BP5")
+var = ioWrite.DefineVariable("r64", data, [Nx], [0], [Nx],
+                             adios2.ConstantDims)
+writer = ioWrite.Open("EngineMetrics_py.bp", adios2.Mode.Write)
+for step in range(NSteps):
+    writer.BeginStep()
+    writer.Put(var, data)
+    writer.EndStep()
+
+metrics = writer.GetMetrics()
+assert isinstance(metrics, dict)
+assert metrics["steps"] == NSteps
+assert metrics["data_bytes"] >= NSteps * data.nbytes
+assert metrics["endstep_calls"] == NSteps
+writer.Close()
+
+# ADIOS read
+ioRead = adios.DeclareIO("ioReader")
+ioRead.SetEngine("BP5")
+reader = ioRead.Open("EngineMetrics_py.bp", adios2.Mode.Read)
+while reader.BeginStep() == adios2.StepStatus.OK:
+    reader.EndStep()
+
+metrics = reader.GetMetrics()
+assert metrics["steps"] == NSteps
+reader.Close()
+
+# engines without metrics return an empty dictionary
+ioNull = adios.DeclareIO("ioNull")
+ioNull.SetEngine("NULL")
+nullWriter = ioNull.Open("EngineMetrics_py.bp", adios2.Mode.Write)
+assert nullWriter.GetMetrics() == {}
+nullWriter.Close()
@@ -0,0 +1,81 @@
+#!/usr/bin/env python
+#
+# Distributed under the OSI-approved Apache License, Version 2.0.  See
+# accompanying file Copyright.txt for details.
+#
+# TestBPZeroCopyGet_nompi.py: test Get returning ADIOS-owned NumPy arrays,
+# Get into buffer protocol objects and multi-variable Get
+import unittest
+import shutil
+import numpy as np
+import adios2
+
+TESTDATA_FILENAME = "zero_copy_get.bp"
+NX = 10
+
+
+class TestAdiosZeroCopyGet(unittest.TestCase):
+
+    def setUp(self):
+        adios = adios2.ADIOS()
+        io = adios.DeclareIO("writer")
+        varR64 = io.DefineVariable("r64", np.zeros(NX), [NX], [0], [NX])
+        varI32 = io.DefineVariable("i32", np.zeros(NX, dtype=np.int32),
+                                   [NX], [0], [NX])
+        varStr = io.DefineVariable("str")
+        fh = io.Open(TESTDATA_FILENAME, adios2.Mode.Write)
+        fh.BeginStep()
+        fh.Put(varR64, np.arange(NX, dtype=np.float64), adios2.Mode.Sync)
+        fh.Put(varI32, np.arange(NX, dtype=np.int32) * 2, adios2.Mode.Sync)
+        fh.Put(varStr, "hello")
+        fh.EndStep()
+        fh.Close()
+
+    def tearDown(self):
+        shutil.rmtree(TESTDATA_FILENAME)
+
+    def open_reader(self):
+        adios = adios2.ADIOS()
+        io = adios.DeclareIO("reader")
+        fh = io.Open(TESTDATA_FILENAME, adios2.Mode.Read)
+        fh.BeginStep()
+        return adios, io, fh
+
+    def test_get_owned_array(self):
+        adios, io, fh = self.open_reader()
+        data = fh.Get(io.InquireVariable("r64"))
+        fh.PerformGets()
+        self.assertEqual(data.shape, (NX,))
+        self.assertEqual(data.dtype, np.float64)
+        self.assertTrue(np.array_equal(data, np.arange(NX)))
+        self.assertEqual(fh.Get(io.InquireVariable("str")), "hello")
+        fh.EndStep()
+        fh.Close()
+
+    def test_get_memoryview(self):
+        adios, io, fh = self.open_reader()
+        storage = bytearray(NX * 4)
+        fh.Get(io.InquireVariable("i32"), memoryview(storage).cast("i"),
+               adios2.Mode.Sync)
+        data = np.frombuffer(storage, dtype=np.int32)
+        self.assertTrue(np.array_equal(data, np.arange(NX) * 2))
+        with self.assertRaises(ValueError):
+            fh.Get(io.InquireVariable("i32"), memoryview(bytearray(4)).cast(
+                "i"), adios2.Mode.Sync)
+        fh.EndStep()
+        fh.Close()
+
+    def test_get_variables(self):
+        adios, io, fh = self.open_reader()
+        r64, i32, text = fh.Get([io.InquireVariable("r64"),
+                                 io.InquireVariable("i32"),
+                                 io.InquireVariable("str")])
+        self.assertTrue(np.array_equal(r64, np.arange(NX)))
+        self.assertTrue(np.array_equal(i32, np.arange(NX) * 2))
+        self.assertEqual(text, "hello")
+        fh.EndStep()
+        fh.Close()
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -0,0 +1,198 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+
+const size_t Nx = 16;
+const size_t NVars = 50;
+const size_t NSteps = 10;
+
+double Value(size_t step, size_t var, int rank, size_t i)
+{
+    return static_cast<double>(step * 100000 + var * 1000 + rank * 100 + i);
+}
+
+void Write(adios2::ADIOS &adios, const std::string &fname,
+           const std::string &compression, const adios2::Mode mode,
+           const size_t firstStep, const size_t nSteps)
+{
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+    adios2::IO io =
+        adios.DeclareIO("Write" + fname + std::to_string(firstStep));
+    io.SetEngine(engineName);
+    io.SetParameter("MetadataCompression", compression);
+
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize)};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank)};
+    const adios2::Dims count{Nx};
+    std::vector<adios2::Variable<double>> vars;
+    for (size_t v = 0; v < NVars; ++v)
+    {
+        vars.push_back(io.DefineVariable<double>(
+            "var" + std::to_string(v), shape, start, count));
+    }
+
+    adios2::Engine writer = io.Open(fname, mode);
+    std::vector<double> data(Nx);
+    for (size_t step = firstStep; step < firstStep + nSteps; ++step)
+    {
+        writer.BeginStep();
+        for (size_t v = 0; v < NVars; ++v)
+        {
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                data[i] = Value(step, v, mpiRank, i);
+            }
+            writer.Put(vars[v], data.data(), adios2::Mode::Sync);
+        }
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+void CheckStep(adios2::Engine &reader, adios2::IO &io, size_t step,
+               bool randomAccess)
+{
+    int mpiRank = 0;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+#endif
+    std::vector<std::vector<double>> data(NVars);
+    for (size_t v = 0; v < NVars; ++v)
+    {
+        auto var = io.InquireVariable<double>("var" + std::to_string(v));
+        ASSERT_TRUE(var);
+        var.SetSelection({{Nx * mpiRank}, {Nx}});
+        if (randomAccess)
+        {
+            var.SetStepSelection({step, 1});
+        }
+        reader.Get(var, data[v]);
+    }
+    reader.PerformGets();
+    for (size_t v = 0; v < NVars; ++v)
+    {
+        ASSERT_EQ(data[v].size(), Nx);
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            ASSERT_EQ(data[v][i], Value(step, v, mpiRank, i))
+                << "step=" << step << " var=" << v << " i=" << i;
+        }
+    }
+}
+
+size_t FileSize(const std::string &name)
+{
+    std::ifstream f(name, std::ios::binary | std::ios::ate);
+    return static_cast<size_t>(f.tellg());
+}
+
+} // end anonymous namespace
+
+class BPCompressedMetadata : public ::testing::TestWithParam<std::string>
+{
+public:
+    BPCompressedMetadata() = default;
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(BPCompressedMetadata, WriteRead)
+{
+    const std::string compression = GetParam();
+    const std::string fname("BPCompressedMetadata_" + compression + ".bp");
+    const std::string rawname("BPCompressedMetadata_none.bp");
+    int mpiRank = 0;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    Write(adios, rawname, "none", adios2::Mode::Write, 0, NSteps);
+    Write(adios, fname, compression, adios2::Mode::Write, 0, NSteps - 2);
+    // appending parses the compressed step records
+    Write(adios, fname, compression, adios2::Mode::Append, NSteps - 2, 2);
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (!mpiRank)
+    {
+        // the metadata of the writers is very repetitive
+        EXPECT_LT(FileSize(fname + "/md.0"), FileSize(rawname + "/md.0") / 2);
+    }
+
+    {
+        adios2::IO io = adios.DeclareIO("ReadStream");
+        io.SetEngine(engineName);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            CheckStep(reader, io, step, false);
+            reader.EndStep();
+            ++step;
+        }
+        EXPECT_EQ(step, NSteps);
+        reader.Close();
+    }
+    {
+        adios2::IO io = adios.DeclareIO("ReadRandomAccess");
+        io.SetEngine(engineName);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+        EXPECT_EQ(reader.Steps(), NSteps);
+        for (size_t step = NSteps; step-- > 0;)
+        {
+            CheckStep(reader, io, step, true);
+        }
+        reader.Close();
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(MetadataCompression, BPCompressedMetadata,
+                         ::testing::Values(
+#ifdef ADIOS2_HAVE_BLOSC
+                             "blosc",
+#endif
+                             "bzip2"));
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
@@ -0,0 +1,195 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <fstream>
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+const size_t Nx = 4096;
+const size_t NSteps = 6;
+
+// the mesh never changes, the field changes every step and the parameters
+// change only on step 3
+double Mesh(size_t b, size_t x) { return static_cast<double>(b * Nx + x); }
+double Field(size_t step, size_t x) { return static_cast<double>(step + x); }
+int64_t Param(size_t step, size_t x)
+{
+    return static_cast<int64_t>((step >= 3 ? 1000 : 0) + x);
+}
+
+void WriteFile(const std::string &fname, const std::string &dedup,
+               bool flush)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIOWrite");
+    io.SetEngine(engineName);
+    io.SetParameter("DeduplicateBlocks", dedup);
+    auto mesh = io.DefineVariable<double>("mesh", {2 * Nx}, {0}, {Nx});
+    auto field = io.DefineVariable<double>("field", {Nx}, {0}, {Nx});
+    auto param = io.DefineVariable<int64_t>("param", {}, {}, {16});
+
+    std::vector<double> m0(Nx), m1(Nx), f(Nx);
+    std::vector<int64_t> p(16);
+    for (size_t x = 0; x < Nx; ++x)
+    {
+        m0[x] = Mesh(0, x);
+        m1[x] = Mesh(1, x);
+    }
+
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        for (size_t x = 0; x < Nx; ++x)
+        {
+            f[x] = Field(step, x);
+        }
+        for (size_t x = 0; x < p.size(); ++x)
+        {
+            p[x] = Param(step, x);
+        }
+        writer.BeginStep();
+        mesh.SetSelection({{0}, {Nx}});
+        writer.Put(mesh, m0.data());
+        writer.Put(field, f.data());
+        if (flush)
+        {
+            writer.PerformDataWrite();
+        }
+        mesh.SetSelection({{Nx}, {Nx}});
+        writer.Put(mesh, m1.data(), adios2::Mode::Sync);
+        writer.Put(param, p.data());
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+void CheckStep(adios2::Engine &reader, adios2::IO &io, size_t step)
+{
+    auto mesh = io.InquireVariable<double>("mesh");
+    auto field = io.InquireVariable<double>("field");
+    auto param = io.InquireVariable<int64_t>("param");
+    ASSERT_TRUE(mesh);
+    ASSERT_TRUE(field);
+    ASSERT_TRUE(param);
+
+    std::vector<double> m(2 * Nx), f(Nx), part(100);
+    std::vector<int64_t> p(16);
+    reader.Get(mesh, m.data());
+    reader.Get(field, f.data());
+    param.SetBlockSelection(0);
+    reader.Get(param, p.data());
+    reader.PerformGets();
+    // a selection inside a deduplicated block
+    mesh.SetSelection({{Nx + 50}, {100}});
+    reader.Get(mesh, part.data(), adios2::Mode::Sync);
+    mesh.SetSelection({{0}, {2 * Nx}});
+
+    for (size_t x = 0; x < Nx; ++x)
+    {
+        ASSERT_EQ(m[x], Mesh(0, x)) << "step " << step;
+        ASSERT_EQ(m[Nx + x], Mesh(1, x)) << "step " << step;
+        ASSERT_EQ(f[x], Field(step, x)) << "step " << step;
+    }
+    for (size_t x = 0; x < p.size(); ++x)
+    {
+        ASSERT_EQ(p[x], Param(step, x)) << "step " << step;
+    }
+    for (size_t x = 0; x < part.size(); ++x)
+    {
+        ASSERT_EQ(part[x], Mesh(1, 50 + x)) << "step " << step;
+    }
+}
+
+void ReadFile(const std::string &fname)
+{
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIOStream");
+        io.SetEngine(engineName);
+        adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+        size_t step = 0;
+        while (reader.BeginStep() == adios2::StepStatus::OK)
+        {
+            CheckStep(reader, io, step);
+            reader.EndStep();
+            ++step;
+        }
+        EXPECT_EQ(step, NSteps);
+        reader.Close();
+    }
+
+    adios2::IO io = adios.DeclareIO("TestIORandomAccess");
+    io.SetEngine(engineName);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    auto mesh = io.InquireVariable<double>("mesh");
+    ASSERT_TRUE(mesh);
+    std::vector<double> m(2 * Nx);
+    for (size_t step = NSteps; step-- > 0;)
+    {
+        mesh.SetStepSelection({step, 1});
+        reader.Get(mesh, m.data(), adios2::Mode::Sync);
+        for (size_t x = 0; x < Nx; ++x)
+        {
+            ASSERT_EQ(m[Nx + x], Mesh(1, x)) << "step " << step;
+        }
+    }
+    reader.Close();
+}
+
+size_t DataSize(const std::string &fname)
+{
+    std::ifstream f(fname + "/data.0", std::ios::binary | std::ios::ate);
+    return static_cast<size_t>(f.tellg());
+}
+}
+
+class BPDeduplicateBlocksTest : public ::testing::Test
+{
+public:
+    BPDeduplicateBlocksTest() = default;
+};
+
+TEST_F(BPDeduplicateBlocksTest, UnchangedBlocks)
+{
+    const std::string plain("BPDeduplicateBlocksOff.bp");
+    const std::string dedup("BPDeduplicateBlocksOn.bp");
+    WriteFile(plain, "false", false);
+    WriteFile(dedup, "true", false);
+    ReadFile(plain);
+    ReadFile(dedup);
+
+    // the mesh is written once instead of every step
+    const size_t meshBytes = 2 * Nx * sizeof(double);
+    EXPECT_LE(DataSize(dedup) + (NSteps - 1) * meshBytes, DataSize(plain));
+}
+
+TEST_F(BPDeduplicateBlocksTest, WithDataFlush)
+{
+    const std::string fname("BPDeduplicateBlocksFlush.bp");
+    WriteFile(fname, "true", true);
+    ReadFile(fname);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    return RUN_ALL_TESTS();
+}
@@ -119,6 +119,113 @@ TEST_F(ADIOSReadDirectIOTest, BufferResize)
     }
 }
 
+TEST_F(ADIOSReadDirectIOTest, ReadUnaligned)
+{
+    /* Read a file written without DirectIO through the DirectIO read path.
+       The blocks are not aligned in the file, some selections are not
+       aligned in memory, and the last block ends at the end of file.
+    */
+    std::string filename = "ADIOSReadDirectIO.bp";
+
+    int mpiRank = 0, mpiSize = 1;
+
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    // Number of elements per process, not a multiple of any alignment
+    const std::size_t Nx = 10007;
+    adios2::Dims shape{static_cast<unsigned int>(mpiSize * Nx)};
+    adios2::Dims start{static_cast<unsigned int>(mpiRank * Nx)};
+    adios2::Dims count{static_cast<unsigned int>(Nx)};
+    const size_t NSteps = 3;
+
+    auto lf_Value = [](size_t step, size_t var, size_t i) -> int32_t {
+        return static_cast<int32_t>(step * 1000000 + var * 100000 + i);
+    };
+
+    {
+        adios2::IO ioWrite = adios.DeclareIO("TestIOWrite");
+        ioWrite.SetEngine(engineName);
+        auto var0 =
+            ioWrite.DefineVariable<int32_t>("var0", shape, start, count);
+        auto var1 = ioWrite.DefineVariable<char>("var1", shape, start, count);
+
+        adios2::Engine engine = ioWrite.Open(filename, adios2::Mode::Write);
+        std::vector<int32_t> a0(Nx);
+        std::vector<char> a1(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                a0[i] = lf_Value(step, 0, i);
+                a1[i] = static_cast<char>(lf_Value(step, 1, i) % 128);
+            }
+            engine.BeginStep();
+            engine.Put(var0, a0.data());
+            engine.Put(var1, a1.data());
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+
+    adios2::IO ioRead = adios.DeclareIO("TestIORead");
+    ioRead.SetEngine(engineName);
+    ioRead.SetParameter("DirectIO", "true");
+    ioRead.SetParameter("DirectIOAlignOffset", "4096");
+    adios2::Engine engine = ioRead.Open(filename, adios2::Mode::Read);
+    EXPECT_TRUE(engine);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        ASSERT_EQ(engine.BeginStep(), adios2::StepStatus::OK);
+        auto var0 = ioRead.InquireVariable<int32_t>("var0");
+        auto var1 = ioRead.InquireVariable<char>("var1");
+        ASSERT_TRUE(var0);
+        ASSERT_TRUE(var1);
+
+        // whole block
+        std::vector<int32_t> res0;
+        var0.SetSelection({{Nx * mpiRank}, {Nx}});
+        engine.Get(var0, res0, adios2::Mode::Sync);
+        ASSERT_EQ(res0.size(), Nx);
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            ASSERT_EQ(res0[i], lf_Value(step, 0, i)) << "i=" << i;
+        }
+
+        // small piece in the middle of a block
+        std::vector<int32_t> part(3);
+        var0.SetSelection({{Nx * mpiRank + 4099}, {3}});
+        engine.Get(var0, part.data(), adios2::Mode::Sync);
+        for (size_t i = 0; i < part.size(); ++i)
+        {
+            ASSERT_EQ(part[i], lf_Value(step, 0, 4099 + i));
+        }
+
+        // odd memory address, last block of the step
+        std::vector<char> res1(Nx + 1);
+        var1.SetSelection({{Nx * mpiRank}, {Nx}});
+        engine.Get(var1, res1.data() + 1, adios2::Mode::Sync);
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            ASSERT_EQ(res1[i + 1],
+                      static_cast<char>(lf_Value(step, 1, i) % 128))
+                << "i=" << i;
+        }
+        engine.EndStep();
+    }
+    engine.Close();
+}
+
 int main(int argc, char **argv)
 {
 #if ADIOS2_USE_MPI
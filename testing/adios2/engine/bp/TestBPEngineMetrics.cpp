@@ -0,0 +1,115 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <iostream>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+class BPEngineMetrics : public ::testing::Test
+{
+public:
+    BPEngineMetrics() = default;
+
+    const size_t Nx = 100;
+    const size_t NSteps = 5;
+};
+
+TEST_F(BPEngineMetrics, WriteRead)
+{
+    const std::string fname("BPEngineMetrics.bp");
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    {
+        adios2::IO io = adios.DeclareIO("TestIOWrite");
+        io.SetEngine(engineName);
+        auto var = io.DefineVariable<double>(
+            "r64", {Nx * static_cast<size_t>(mpiSize)},
+            {Nx * static_cast<size_t>(mpiRank)}, {Nx});
+
+        std::vector<double> data(Nx, static_cast<double>(mpiRank));
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            writer.BeginStep();
+            writer.Put(var, data.data());
+            writer.EndStep();
+        }
+
+        const adios2::Metrics metrics = writer.GetMetrics();
+        EXPECT_EQ(metrics.at("steps"), static_cast<double>(NSteps));
+        EXPECT_GE(metrics.at("data_bytes"),
+                  static_cast<double>(NSteps * Nx * sizeof(double)));
+        EXPECT_GE(metrics.at("step_data_bytes"),
+                  static_cast<double>(Nx * sizeof(double)));
+        EXPECT_EQ(metrics.at("endstep_calls"), static_cast<double>(NSteps));
+        EXPECT_GT(metrics.at("endstep_us"), 0.0);
+        if (!mpiRank)
+        {
+            EXPECT_GT(metrics.at("metadata_bytes"), 0.0);
+        }
+        writer.Close();
+    }
+    {
+        adios2::IO io = adios.DeclareIO("TestIORead");
+        io.SetEngine(engineName);
+        io.SetParameter("ReadCacheSize", "1Mb");
+        adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+        auto var = io.InquireVariable<double>("r64");
+        ASSERT_TRUE(var);
+        var.SetSelection({{Nx * mpiRank}, {Nx}});
+        var.SetStepSelection({NSteps - 1, 1});
+        std::vector<double> in;
+        for (size_t pass = 0; pass < 2; ++pass)
+        {
+            reader.Get(var, in, adios2::Mode::Sync);
+            ASSERT_EQ(in.size(), Nx);
+            EXPECT_EQ(in.front(), static_cast<double>(mpiRank));
+        }
+
+        const adios2::Metrics metrics = reader.GetMetrics();
+        EXPECT_EQ(metrics.at("steps"), static_cast<double>(NSteps));
+        // the second Get of the same block is served from the cache
+        EXPECT_EQ(metrics.at("read_cache_misses"), 1.0);
+        EXPECT_EQ(metrics.at("read_cache_hits"), 1.0);
+        EXPECT_EQ(metrics.at("read_cache_evictions"), 0.0);
+        EXPECT_EQ(metrics.count("prefetch_read_bytes"), 0);
+        reader.Close();
+    }
+}
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
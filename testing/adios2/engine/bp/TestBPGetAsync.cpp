@@ -0,0 +1,193 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+const size_t Nx = 1000;
+const size_t NSteps = 4;
+
+double Value(size_t step, size_t var, size_t x)
+{
+    return static_cast<double>(step * 100000 + var * 10000 + x);
+}
+
+void WriteFile(const std::string &fname, const std::string &engine)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIOWrite");
+    io.SetEngine(engine);
+    auto v0 = io.DefineVariable<double>("v0", {Nx}, {0}, {Nx});
+    auto v1 = io.DefineVariable<double>("v1", {Nx}, {0}, {Nx});
+#ifdef ADIOS2_HAVE_BZIP2
+    adios2::Operator op =
+        adios.DefineOperator("BZIP2Compressor", adios2::ops::LosslessBZIP2);
+    v1.AddOperation(op, {{adios2::ops::bzip2::key::blockSize100k, "9"}});
+#endif
+
+    std::vector<double> d0(Nx), d1(Nx);
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        for (size_t x = 0; x < Nx; ++x)
+        {
+            d0[x] = Value(step, 0, x);
+            d1[x] = Value(step, 1, x);
+        }
+        writer.BeginStep();
+        writer.Put(v0, d0.data());
+        writer.Put(v1, d1.data());
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+void Check(const std::vector<double> &in, size_t step, size_t var,
+           size_t start)
+{
+    for (size_t i = 0; i < in.size(); ++i)
+    {
+        ASSERT_EQ(in[i], Value(step, var, start + i))
+            << "step " << step << " var " << var << " at " << i;
+    }
+}
+}
+
+class BPGetAsyncTest : public ::testing::Test
+{
+public:
+    BPGetAsyncTest() = default;
+};
+
+TEST_F(BPGetAsyncTest, Streaming)
+{
+    const std::string fname("BPGetAsyncStreaming.bp");
+    WriteFile(fname, engineName);
+
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    size_t step = 0;
+    while (reader.BeginStep() == adios2::StepStatus::OK)
+    {
+        auto v0 = io.InquireVariable<double>("v0");
+        auto v1 = io.InquireVariable<double>("v1");
+        ASSERT_TRUE(v0);
+        ASSERT_TRUE(v1);
+
+        // two overlapping asynchronous Gets
+        std::vector<double> a(Nx, -1.0), b(Nx / 2, -1.0);
+        adios2::GetFuture fa = reader.GetAsync(v0, a.data());
+        v1.SetSelection({{Nx / 4}, {Nx / 2}});
+        adios2::GetFuture fb = reader.GetAsync(v1, b.data());
+        EXPECT_TRUE(fa);
+        EXPECT_TRUE(fb);
+        fb.Wait();
+        EXPECT_TRUE(fb.Test());
+        Check(b, step, 1, Nx / 4);
+        fa.Wait();
+        EXPECT_TRUE(fa.Test());
+        Check(a, step, 0, 0);
+
+        // deferred Gets started together, completed by EndStep
+        std::vector<double> c(Nx, -1.0), d(Nx / 2, -1.0);
+        reader.Get(v0, c.data());
+        reader.Get(v1, d.data());
+        adios2::GetFuture fc = reader.PerformGetsAsync();
+        reader.EndStep();
+        EXPECT_TRUE(fc.Test());
+        Check(c, step, 0, 0);
+        Check(d, step, 1, Nx / 4);
+        ++step;
+    }
+    EXPECT_EQ(step, NSteps);
+    reader.Close();
+}
+
+TEST_F(BPGetAsyncTest, RandomAccess)
+{
+    const std::string fname("BPGetAsyncRandomAccess.bp");
+    WriteFile(fname, engineName);
+
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    auto v0 = io.InquireVariable<double>("v0");
+    auto v1 = io.InquireVariable<double>("v1");
+    ASSERT_TRUE(v0);
+    ASSERT_TRUE(v1);
+
+    std::vector<std::vector<double>> in(NSteps, std::vector<double>(Nx));
+    std::vector<adios2::GetFuture> futures;
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        auto &var = (step % 2) ? v1 : v0;
+        var.SetStepSelection({NSteps - 1 - step, 1});
+        futures.push_back(reader.GetAsync(var, in[step].data()));
+    }
+    // a synchronous Get waits for the pending asynchronous ones
+    std::vector<double> sync(Nx);
+    v0.SetStepSelection({0, 1});
+    reader.Get(v0, sync.data(), adios2::Mode::Sync);
+    Check(sync, 0, 0, 0);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        EXPECT_TRUE(futures[step].Test());
+        futures[step].Wait();
+        Check(in[step], NSteps - 1 - step, step % 2, 0);
+    }
+    reader.Close();
+}
+
+TEST_F(BPGetAsyncTest, SynchronousFallback)
+{
+    // engines without background reads complete the Gets right away
+    const std::string fname("BPGetAsyncBP4.bp");
+    WriteFile(fname, "BP4");
+
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine("BP4");
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+    auto v0 = io.InquireVariable<double>("v0");
+    ASSERT_TRUE(v0);
+    std::vector<double> in(Nx, -1.0);
+    adios2::GetFuture f = reader.GetAsync(v0, in.data());
+    EXPECT_TRUE(f.Test());
+    f.Wait();
+    Check(in, 0, 0, 0);
+    reader.EndStep();
+    reader.Close();
+
+    adios2::GetFuture invalid;
+    EXPECT_FALSE(invalid);
+    EXPECT_FALSE(invalid.Test());
+    EXPECT_THROW(invalid.Wait(), std::invalid_argument);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    return RUN_ALL_TESTS();
+}
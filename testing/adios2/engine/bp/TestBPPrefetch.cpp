@@ -0,0 +1,134 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+const size_t Nx = 64;
+const size_t NSteps = 6;
+
+int32_t Value(size_t step, size_t var, size_t x)
+{
+    return static_cast<int32_t>(step * 100000 + var * 1000 + x);
+}
+
+void WriteFile(const std::string &fname)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIOWrite");
+    io.SetEngine(engineName);
+    std::vector<adios2::Variable<int32_t>> vars;
+    for (size_t v = 0; v < 3; ++v)
+    {
+        vars.push_back(io.DefineVariable<int32_t>("v" + std::to_string(v),
+                                                  {2 * Nx}, {0}, {Nx}));
+    }
+
+    std::vector<int32_t> data(Nx);
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        writer.BeginStep();
+        for (size_t v = 0; v < vars.size(); ++v)
+        {
+            // two blocks per variable, the last one only every other step
+            const size_t blocks = (v == 2 && step % 2) ? 1 : 2;
+            for (size_t b = 0; b < blocks; ++b)
+            {
+                for (size_t x = 0; x < Nx; ++x)
+                {
+                    data[x] = Value(step, v, b * Nx + x);
+                }
+                vars[v].SetSelection({{b * Nx}, {Nx}});
+                writer.Put(vars[v], data.data(), adios2::Mode::Sync);
+            }
+        }
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+void ReadStream(const std::string &fname, const std::string &prefetchSize)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    io.SetParameter("PrefetchSize", prefetchSize);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+
+    size_t step = 0;
+    while (reader.BeginStep() == adios2::StepStatus::OK)
+    {
+        // same selection every step, then one that moves, and a sync Get
+        auto v0 = io.InquireVariable<int32_t>("v0");
+        auto v1 = io.InquireVariable<int32_t>("v1");
+        auto v2 = io.InquireVariable<int32_t>("v2");
+        ASSERT_TRUE(v0);
+        ASSERT_TRUE(v1);
+        ASSERT_TRUE(v2);
+        const size_t start1 = (step * 7) % Nx;
+        v0.SetSelection({{10}, {Nx}});
+        v1.SetSelection({{start1}, {Nx}});
+        v2.SetSelection({{0}, {Nx / 2}});
+        std::vector<int32_t> in0(Nx), in1(Nx), in2(Nx / 2);
+        reader.Get(v2, in2.data(), adios2::Mode::Sync);
+        reader.Get(v0, in0.data());
+        reader.Get(v1, in1.data());
+        reader.EndStep();
+
+        for (size_t x = 0; x < Nx; ++x)
+        {
+            EXPECT_EQ(in0[x], Value(step, 0, 10 + x)) << "step " << step;
+            EXPECT_EQ(in1[x], Value(step, 1, start1 + x)) << "step " << step;
+        }
+        for (size_t x = 0; x < Nx / 2; ++x)
+        {
+            EXPECT_EQ(in2[x], Value(step, 2, x)) << "step " << step;
+        }
+        ++step;
+    }
+    EXPECT_EQ(step, NSteps);
+    reader.Close();
+}
+}
+
+class BPPrefetchTest : public ::testing::Test
+{
+public:
+    BPPrefetchTest() = default;
+};
+
+TEST_F(BPPrefetchTest, StreamingRead)
+{
+    const std::string fname("BPPrefetch.bp");
+    WriteFile(fname);
+    // off, room for part of a step, room for everything
+    for (const std::string size : {"0", "300", "1Mb"})
+    {
+        ReadStream(fname, size);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,175 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+#include <nlohmann_json.hpp>
+
+using json = nlohmann::json;
+
+std::string engineName; // comes from command line
+
+class BPProfilingTrace : public ::testing::Test
+{
+public:
+    BPProfilingTrace() = default;
+
+    void Write(const std::string &fname, const adios2::Params &params)
+    {
+        int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+        MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+        MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+        adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+        adios2::ADIOS adios;
+#endif
+        adios2::IO io = adios.DeclareIO("TestIO");
+        io.SetEngine(engineName);
+        io.SetParameters(params);
+
+        auto var = io.DefineVariable<double>(
+            "r64", {Nx * static_cast<size_t>(mpiSize)},
+            {Nx * static_cast<size_t>(mpiRank)}, {Nx});
+
+        std::vector<double> data(Nx, static_cast<double>(mpiRank));
+        adios2::Engine engine = io.Open(fname, adios2::Mode::Write);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            engine.BeginStep();
+            engine.Put(var, data.data());
+            engine.EndStep();
+        }
+        engine.Close();
+    }
+
+    const size_t Nx = 100;
+    const size_t NSteps = 10;
+};
+
+TEST_F(BPProfilingTrace, Timeline)
+{
+    const std::string fname("BPProfilingTrace.bp");
+    const unsigned int maxEvents = 4;
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+
+    Write(fname, {{"ProfileTrace", "true"},
+                  {"ProfileTraceEvents", std::to_string(maxEvents)},
+                  {"AsyncWrite", "true"}});
+
+    if (mpiRank != 0)
+    {
+        return;
+    }
+
+    std::ifstream traceFile(fname + "/profiling_trace.json");
+    ASSERT_TRUE(traceFile.good());
+    const json trace = json::parse(traceFile);
+    const json &events = trace.at("traceEvents");
+
+    // per rank and lane: name, complete events, dropped events
+    std::map<int, std::map<int, std::string>> laneNames;
+    std::map<int, std::map<int, size_t>> nEvents;
+    std::map<int, std::map<int, size_t>> dropped;
+    std::map<int, size_t> nEndStep;
+    for (const auto &event : events)
+    {
+        const std::string ph = event.at("ph");
+        const int pid = event.at("pid");
+        if (ph == "M" && event.at("name") == "thread_name")
+        {
+            const int tid = event.at("tid");
+            laneNames[pid][tid] = event.at("args").at("name");
+            dropped[pid][tid] = event.at("args").at("dropped_events");
+        }
+        else if (ph == "X")
+        {
+            const int tid = event.at("tid");
+            EXPECT_GE(event.at("ts").get<int64_t>(), 0);
+            EXPECT_GE(event.at("dur").get<int64_t>(), 0);
+            ++nEvents[pid][tid];
+            if (event.at("name") == "endstep")
+            {
+                ++nEndStep[pid];
+            }
+        }
+    }
+
+    ASSERT_EQ(laneNames.size(), static_cast<size_t>(mpiSize));
+    for (int rank = 0; rank < mpiSize; ++rank)
+    {
+        bool hasAsyncLane = false;
+        for (const auto &lane : laneNames[rank])
+        {
+            // ring buffer keeps the latest events only
+            EXPECT_LE(nEvents[rank][lane.first], maxEvents);
+            EXPECT_GT(nEvents[rank][lane.first], 0);
+            if (lane.second == "main")
+            {
+                EXPECT_GT(dropped[rank][lane.first], 0);
+            }
+            if (lane.second == "async")
+            {
+                hasAsyncLane = true;
+            }
+        }
+        EXPECT_TRUE(hasAsyncLane) << "rank " << rank;
+        // endstep is the last timer closed in every step
+        EXPECT_GT(nEndStep[rank], 0) << "rank " << rank;
+    }
+}
+
+TEST_F(BPProfilingTrace, Off)
+{
+    const std::string fname("BPProfilingTraceOff.bp");
+    int mpiRank = 0;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+#endif
+
+    Write(fname, {});
+
+    if (mpiRank == 0)
+    {
+        std::ifstream profilingFile(fname + "/profiling.json");
+        EXPECT_TRUE(profilingFile.good());
+        std::ifstream traceFile(fname + "/profiling_trace.json");
+        EXPECT_FALSE(traceFile.good());
+    }
+}
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
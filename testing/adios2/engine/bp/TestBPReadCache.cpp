@@ -0,0 +1,148 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+const size_t Ny = 16;
+const size_t Nx = 32;
+const size_t NSteps = 3;
+
+double Value(size_t step, size_t y, size_t x)
+{
+    return static_cast<double>(step * 10000 + y * 100 + x);
+}
+
+// two blocks per step, split along the slowest dimension
+void WriteFile(const std::string &fname)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIOWrite");
+    io.SetEngine(engineName);
+    auto plain = io.DefineVariable<double>("plain", {Ny, Nx}, {0, 0},
+                                           {Ny / 2, Nx});
+    auto packed = io.DefineVariable<double>("packed", {Ny, Nx}, {0, 0},
+                                            {Ny / 2, Nx});
+#ifdef ADIOS2_HAVE_BZIP2
+    adios2::Operator op =
+        adios.DefineOperator("BZIP2Compressor", adios2::ops::LosslessBZIP2);
+    packed.AddOperation(op, {{adios2::ops::bzip2::key::blockSize100k, "9"}});
+#endif
+
+    std::vector<double> data(Ny * Nx);
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        for (size_t y = 0; y < Ny; ++y)
+        {
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                data[y * Nx + x] = Value(step, y, x);
+            }
+        }
+        writer.BeginStep();
+        for (size_t b = 0; b < 2; ++b)
+        {
+            const adios2::Box<adios2::Dims> sel({b * Ny / 2, 0}, {Ny / 2, Nx});
+            plain.SetSelection(sel);
+            packed.SetSelection(sel);
+            writer.Put(plain, data.data() + b * (Ny / 2) * Nx,
+                       adios2::Mode::Sync);
+            writer.Put(packed, data.data() + b * (Ny / 2) * Nx,
+                       adios2::Mode::Sync);
+        }
+        writer.EndStep();
+    }
+    writer.Close();
+}
+
+void CheckSelection(const std::vector<double> &in, size_t step,
+                    const adios2::Dims &start, const adios2::Dims &count)
+{
+    for (size_t j = 0; j < count[0]; ++j)
+    {
+        for (size_t i = 0; i < count[1]; ++i)
+        {
+            EXPECT_EQ(in[j * count[1] + i],
+                      Value(step, start[0] + j, start[1] + i))
+                << "at step " << step << " " << j << "," << i;
+        }
+    }
+}
+
+// reads overlapping selections of every step twice, in random access mode
+void ReadTwice(const std::string &fname, const std::string &cacheSize)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    io.SetParameter("ReadCacheSize", cacheSize);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    auto plain = io.InquireVariable<double>("plain");
+    auto packed = io.InquireVariable<double>("packed");
+    ASSERT_TRUE(plain);
+    ASSERT_TRUE(packed);
+
+    const std::vector<adios2::Box<adios2::Dims>> selections = {
+        {{2, 3}, {10, 20}}, {{4, 0}, {4, Nx}}, {{0, 0}, {Ny, Nx}}};
+    for (size_t pass = 0; pass < 2; ++pass)
+    {
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            for (const auto &sel : selections)
+            {
+                for (auto *var : {&plain, &packed})
+                {
+                    var->SetStepSelection({step, 1});
+                    var->SetSelection(sel);
+                    std::vector<double> in(var->SelectionSize(), -1.0);
+                    reader.Get(*var, in.data(), adios2::Mode::Sync);
+                    CheckSelection(in, step, sel.first, sel.second);
+                }
+            }
+        }
+    }
+    reader.Close();
+}
+}
+
+class BPReadCacheTest : public ::testing::Test
+{
+public:
+    BPReadCacheTest() = default;
+};
+
+TEST_F(BPReadCacheTest, RepeatedGets)
+{
+    const std::string fname("BPReadCache.bp");
+    WriteFile(fname);
+    // off, too small to hold a block, holds a few blocks, holds everything
+    for (const std::string size : {"0", "100", "8Kb", "1Mb"})
+    {
+        ReadTwice(fname, size);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    return RUN_ALL_TESTS();
+}
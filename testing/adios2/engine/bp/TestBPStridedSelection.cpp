@@ -0,0 +1,165 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <stdexcept>
+#include <vector>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+const size_t Nz = 8;
+const size_t Ny = 10;
+const size_t Nx = 12;
+
+double Value(size_t z, size_t y, size_t x)
+{
+    return static_cast<double>(z * 1000 + y * 100 + x);
+}
+
+// two blocks per step, split along the slowest dimension
+void WriteFile(const std::string &fname, bool compress)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIOWrite");
+    io.SetEngine(engineName);
+    auto var = io.DefineVariable<double>("r64", {Nz, Ny, Nx}, {0, 0, 0},
+                                         {Nz / 2, Ny, Nx});
+#ifdef ADIOS2_HAVE_BZIP2
+    if (compress)
+    {
+        adios2::Operator op =
+            adios.DefineOperator("BZIP2Compressor", adios2::ops::LosslessBZIP2);
+        var.AddOperation(op, {{adios2::ops::bzip2::key::blockSize100k, "9"}});
+    }
+#endif
+    std::vector<double> data(Nz * Ny * Nx);
+    for (size_t z = 0; z < Nz; ++z)
+    {
+        for (size_t y = 0; y < Ny; ++y)
+        {
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                data[(z * Ny + y) * Nx + x] = Value(z, y, x);
+            }
+        }
+    }
+
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    writer.BeginStep();
+    for (size_t b = 0; b < 2; ++b)
+    {
+        var.SetSelection({{b * Nz / 2, 0, 0}, {Nz / 2, Ny, Nx}});
+        writer.Put(var, data.data() + b * (Nz / 2) * Ny * Nx,
+                   adios2::Mode::Sync);
+    }
+    writer.EndStep();
+    writer.Close();
+}
+
+void ReadStrided(const std::string &fname, const std::string &sieve,
+                 const adios2::Dims &start, const adios2::Dims &count,
+                 const adios2::Dims &stride)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    io.SetParameter("SieveThreshold", sieve);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+    auto var = io.InquireVariable<double>("r64");
+    ASSERT_TRUE(var);
+
+    var.SetSelection({start, count}, stride);
+    EXPECT_EQ(var.SelectionSize(), count[0] * count[1] * count[2]);
+    std::vector<double> in(var.SelectionSize(), -1.0);
+    reader.Get(var, in.data(), adios2::Mode::Sync);
+    reader.EndStep();
+    reader.Close();
+
+    for (size_t k = 0; k < count[0]; ++k)
+    {
+        for (size_t j = 0; j < count[1]; ++j)
+        {
+            for (size_t i = 0; i < count[2]; ++i)
+            {
+                EXPECT_EQ(in[(k * count[1] + j) * count[2] + i],
+                          Value(start[0] + k * stride[0],
+                                start[1] + j * stride[1],
+                                start[2] + i * stride[2]))
+                    << "at " << k << "," << j << "," << i << " sieve "
+                    << sieve;
+            }
+        }
+    }
+}
+}
+
+class BPStridedSelectionTest : public ::testing::Test
+{
+public:
+    BPStridedSelectionTest() = default;
+};
+
+TEST_F(BPStridedSelectionTest, Decimate3D)
+{
+    const std::string fname("BPStridedSelection3D.bp");
+    WriteFile(fname, false);
+    for (const std::string sieve : {"0", "64", "1Mb"})
+    {
+        ReadStrided(fname, sieve, {1, 0, 1}, {3, 5, 3}, {3, 2, 5});
+        ReadStrided(fname, sieve, {0, 1, 2}, {4, 3, 10}, {2, 3, 1});
+        ReadStrided(fname, sieve, {3, 9, 0}, {2, 1, 6}, {1, 1, 2});
+    }
+}
+
+#ifdef ADIOS2_HAVE_BZIP2
+TEST_F(BPStridedSelectionTest, DecimateOperated)
+{
+    const std::string fname("BPStridedSelectionBZIP2.bp");
+    WriteFile(fname, true);
+    ReadStrided(fname, "0", {1, 0, 1}, {3, 5, 3}, {3, 2, 5});
+    ReadStrided(fname, "4096", {0, 1, 2}, {4, 3, 10}, {2, 3, 1});
+}
+#endif
+
+TEST_F(BPStridedSelectionTest, InvalidStride)
+{
+    const std::string fname("BPStridedSelectionInvalid.bp");
+    WriteFile(fname, false);
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+    auto var = io.InquireVariable<double>("r64");
+    ASSERT_TRUE(var);
+    EXPECT_THROW(var.SetSelection({{0, 0, 0}, {3, 1, 1}}, {4, 1, 1}),
+                 std::invalid_argument);
+    EXPECT_THROW(var.SetSelection({{0, 0, 0}, {1, 1, 1}}, {1, 0, 1}),
+                 std::invalid_argument);
+    EXPECT_THROW(var.SetSelection({{0, 0, 0}, {1, 1, 1}}, {1, 1}),
+                 std::invalid_argument);
+    reader.EndStep();
+    reader.Close();
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    return RUN_ALL_TESTS();
+}
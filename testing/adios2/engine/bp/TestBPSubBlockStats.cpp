@@ -0,0 +1,178 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <numeric>
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+class BPSubBlockStatsTest : public ::testing::Test
+{
+public:
+    BPSubBlockStatsTest() = default;
+};
+
+TEST_F(BPSubBlockStatsTest, BlocksInfo1D)
+{
+    const std::string fname("BPSubBlockStats1D.bp");
+    const size_t Nx = 100;
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIOWrite");
+        io.SetEngine(engineName);
+        io.SetParameter("StatsBlockSize", "10");
+        auto var = io.DefineVariable<int32_t>("i32", {Nx}, {0}, {Nx});
+        std::vector<int32_t> data(Nx);
+        std::iota(data.begin(), data.end(), 0);
+
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        writer.BeginStep();
+        writer.Put(var, data.data());
+        writer.EndStep();
+        writer.Close();
+    }
+
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+    auto var = io.InquireVariable<int32_t>("i32");
+    ASSERT_TRUE(var);
+
+    auto blocks = reader.BlocksInfo(var, reader.CurrentStep());
+    ASSERT_EQ(blocks.size(), 1);
+    EXPECT_EQ(blocks[0].Min, 0);
+    EXPECT_EQ(blocks[0].Max, 99);
+    ASSERT_EQ(blocks[0].SubBlocks.size(), 10);
+    ASSERT_EQ(blocks[0].MinMaxs.size(), 20);
+    for (size_t i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(blocks[0].SubBlocks[i].first[0], i * 10);
+        EXPECT_EQ(blocks[0].SubBlocks[i].second[0], 10);
+        EXPECT_EQ(blocks[0].MinMaxs[2 * i], static_cast<int32_t>(i * 10));
+        EXPECT_EQ(blocks[0].MinMaxs[2 * i + 1],
+                  static_cast<int32_t>(i * 10 + 9));
+    }
+
+    // only sub-blocks 2, 3 and 4 can hold values in [25, 44]
+    std::vector<int32_t> in(Nx, -1);
+    var.SetValueFilter(25, 44);
+    reader.Get(var, in.data(), adios2::Mode::Sync);
+    for (size_t i = 0; i < Nx; i++)
+    {
+        if (i >= 20 && i < 50)
+        {
+            EXPECT_EQ(in[i], static_cast<int32_t>(i));
+        }
+        else
+        {
+            EXPECT_EQ(in[i], -1);
+        }
+    }
+
+    // matching sub-blocks outside of the selection are not read either
+    std::vector<int32_t> sel(30, -1);
+    var.SetSelection({{35}, {30}});
+    var.SetValueFilter(0, 12);
+    reader.Get(var, sel.data(), adios2::Mode::Sync);
+    for (const auto v : sel)
+    {
+        EXPECT_EQ(v, -1);
+    }
+
+    var.SetValueFilter(60, 61);
+    reader.Get(var, sel.data(), adios2::Mode::Sync);
+    for (size_t i = 0; i < sel.size(); i++)
+    {
+        if (i + 35 >= 60)
+        {
+            EXPECT_EQ(sel[i], static_cast<int32_t>(i + 35));
+        }
+        else
+        {
+            EXPECT_EQ(sel[i], -1);
+        }
+    }
+
+    var.RemoveValueFilter();
+    reader.Get(var, sel.data(), adios2::Mode::Sync);
+    for (size_t i = 0; i < sel.size(); i++)
+    {
+        EXPECT_EQ(sel[i], static_cast<int32_t>(i + 35));
+    }
+    reader.EndStep();
+    reader.Close();
+}
+
+TEST_F(BPSubBlockStatsTest, ValueFilter2D)
+{
+    const std::string fname("BPSubBlockStats2D.bp");
+    const size_t Ny = 10;
+    const size_t Nx = 20;
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("TestIOWrite");
+        io.SetEngine(engineName);
+        // 200 elements in sub-blocks of 40: five slabs of two rows
+        io.SetParameter("StatsBlockSize", "40");
+        auto var = io.DefineVariable<double>("r64", {Ny, Nx}, {0, 0}, {Ny, Nx});
+        std::vector<double> data(Ny * Nx);
+        std::iota(data.begin(), data.end(), 0.0);
+
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        writer.BeginStep();
+        writer.Put(var, data.data());
+        writer.EndStep();
+        writer.Close();
+    }
+
+    adios2::IO io = adios.DeclareIO("TestIORead");
+    io.SetEngine(engineName);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    ASSERT_EQ(reader.BeginStep(), adios2::StepStatus::OK);
+    auto var = io.InquireVariable<double>("r64");
+    ASSERT_TRUE(var);
+
+    auto blocks = reader.BlocksInfo(var, reader.CurrentStep());
+    ASSERT_EQ(blocks.size(), 1);
+    ASSERT_EQ(blocks[0].SubBlocks.size(), 5);
+    EXPECT_EQ(blocks[0].SubBlocks[1].first, adios2::Dims({2, 0}));
+    EXPECT_EQ(blocks[0].SubBlocks[1].second, adios2::Dims({2, Nx}));
+
+    std::vector<double> in(Ny * Nx, -1.0);
+    var.SetValueFilter(45.0, 50.0);
+    reader.Get(var, in.data(), adios2::Mode::Sync);
+    for (size_t i = 0; i < Ny * Nx; i++)
+    {
+        if (i >= 40 && i < 80)
+        {
+            EXPECT_EQ(in[i], static_cast<double>(i));
+        }
+        else
+        {
+            EXPECT_EQ(in[i], -1.0);
+        }
+    }
+    reader.EndStep();
+    reader.Close();
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,248 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <fstream>
+#include <iostream>
+#include <numeric> //std::iota
+#include <stdexcept>
+
+#include <adios2.h>
+
+#include <gtest/gtest.h>
+
+std::string engineName; // comes from command line
+
+namespace
+{
+
+const size_t Nx = 64;
+const size_t Ny = 32;
+const size_t NSteps = 12;
+const size_t KeyframeInterval = 4;
+
+// slowly evolving field, only every 16th value changes between steps
+double FieldValue(size_t step, int rank, size_t i)
+{
+    const double base = rank * 1000. + static_cast<double>(i) * 0.5;
+    return (i % 16 == 0) ? base + 0.001 * static_cast<double>(step) : base;
+}
+
+int32_t LocalValue(size_t step, int rank, size_t block, size_t i)
+{
+    return static_cast<int32_t>(rank * 100000 + block * 10000 + i +
+                                (i % 8 == 0 ? step : 0));
+}
+
+void WriteTemporal(adios2::ADIOS &adios, const std::string &fname,
+                   const std::string &backend)
+{
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+#endif
+    adios2::IO io = adios.DeclareIO("WriteIO");
+    if (!engineName.empty())
+    {
+        io.SetEngine(engineName);
+    }
+
+    const adios2::Dims shape{static_cast<size_t>(Nx * mpiSize), Ny};
+    const adios2::Dims start{static_cast<size_t>(Nx * mpiRank), 0};
+    const adios2::Dims count{Nx, Ny};
+    auto var_r64 = io.DefineVariable<double>("r64", shape, start, count,
+                                             adios2::ConstantDims);
+    // two local blocks of the same size per writer and step
+    auto var_i32 =
+        io.DefineVariable<int32_t>("i32", {}, {}, {Nx}, adios2::ConstantDims);
+
+    adios2::Operator TemporalOp = adios.DefineOperator(
+        "TemporalCompressor", adios2::ops::LosslessTemporal);
+    const adios2::Params params = {
+        {adios2::ops::temporal::key::keyframeInterval,
+         std::to_string(KeyframeInterval)},
+        {adios2::ops::temporal::key::backend, backend}};
+    var_r64.AddOperation(TemporalOp, params);
+    var_i32.AddOperation(TemporalOp, params);
+
+    std::vector<double> r64s(Nx * Ny);
+    std::vector<int32_t> i32s(Nx);
+    adios2::Engine bpWriter = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; ++step)
+    {
+        for (size_t i = 0; i < r64s.size(); ++i)
+        {
+            r64s[i] = FieldValue(step, mpiRank, i);
+        }
+        bpWriter.BeginStep();
+        bpWriter.Put(var_r64, r64s.data(), adios2::Mode::Sync);
+        for (size_t block = 0; block < 2; ++block)
+        {
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                i32s[i] = LocalValue(step, mpiRank, block, i);
+            }
+            bpWriter.Put(var_i32, i32s.data(), adios2::Mode::Sync);
+        }
+        bpWriter.EndStep();
+    }
+    bpWriter.Close();
+}
+
+void CheckStep(adios2::Engine &reader, adios2::IO &io, size_t step,
+               bool streaming)
+{
+    int mpiRank = 0;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+#endif
+    auto var_r64 = io.InquireVariable<double>("r64");
+    ASSERT_TRUE(var_r64);
+    var_r64.SetSelection({{Nx * mpiRank, 0}, {Nx, Ny}});
+    auto var_i32 = io.InquireVariable<int32_t>("i32");
+    ASSERT_TRUE(var_i32);
+    if (!streaming)
+    {
+        var_r64.SetStepSelection({step, 1});
+        var_i32.SetStepSelection({step, 1});
+    }
+
+    std::vector<double> r64s;
+    std::vector<int32_t> i32s[2];
+    reader.Get(var_r64, r64s);
+    for (size_t block = 0; block < 2; ++block)
+    {
+        var_i32.SetBlockSelection(2 * mpiRank + block);
+        reader.Get(var_i32, i32s[block]);
+    }
+    reader.PerformGets();
+
+    ASSERT_EQ(r64s.size(), Nx * Ny);
+    for (size_t i = 0; i < r64s.size(); ++i)
+    {
+        ASSERT_EQ(r64s[i], FieldValue(step, mpiRank, i))
+            << "step=" << step << " i=" << i << " rank=" << mpiRank;
+    }
+    for (size_t block = 0; block < 2; ++block)
+    {
+        ASSERT_EQ(i32s[block].size(), Nx);
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            ASSERT_EQ(i32s[block][i], LocalValue(step, mpiRank, block, i))
+                << "step=" << step << " block=" << block << " i=" << i;
+        }
+    }
+}
+
+} // end anonymous namespace
+
+class BPWriteReadTemporal : public ::testing::TestWithParam<std::string>
+{
+public:
+    BPWriteReadTemporal() = default;
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_P(BPWriteReadTemporal, ADIOS2BPWriteReadTemporalStreaming)
+{
+    const std::string fname("BPWR_Temporal_Streaming_" + GetParam() + ".bp");
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    WriteTemporal(adios, fname, GetParam());
+
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+    if (mpiRank == 0 && mpiSize == 1)
+    {
+        // only every 16th value changes, the deltas compress well
+        std::ifstream data(fname + "/data.0",
+                           std::ios::binary | std::ios::ate);
+        const size_t raw = NSteps * (Nx * Ny * sizeof(double) +
+                                     2 * Nx * sizeof(int32_t));
+        EXPECT_LT(static_cast<size_t>(data.tellg()), raw / 2);
+    }
+
+    adios2::IO io = adios.DeclareIO("ReadIO");
+    if (!engineName.empty())
+    {
+        io.SetEngine(engineName);
+    }
+    adios2::Engine bpReader = io.Open(fname, adios2::Mode::Read);
+    size_t step = 0;
+    while (bpReader.BeginStep() == adios2::StepStatus::OK)
+    {
+        CheckStep(bpReader, io, step, true);
+        bpReader.EndStep();
+        ++step;
+    }
+    EXPECT_EQ(step, NSteps);
+    bpReader.Close();
+}
+
+TEST_P(BPWriteReadTemporal, ADIOS2BPWriteReadTemporalRandomAccess)
+{
+    const std::string fname("BPWR_Temporal_RandomAccess_" + GetParam() +
+                            ".bp");
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    WriteTemporal(adios, fname, GetParam());
+
+    adios2::IO io = adios.DeclareIO("ReadIO");
+    if (!engineName.empty())
+    {
+        io.SetEngine(engineName);
+    }
+    adios2::Engine bpReader = io.Open(fname, adios2::Mode::ReadRandomAccess);
+    // backwards, every step is decoded from the earlier versions on disk
+    for (size_t step = NSteps; step-- > 0;)
+    {
+        CheckStep(bpReader, io, step, false);
+    }
+    // a single step in the middle of a keyframe interval
+    CheckStep(bpReader, io, KeyframeInterval + 2, false);
+    bpReader.Close();
+}
+
+INSTANTIATE_TEST_SUITE_P(Temporal, BPWriteReadTemporal,
+                         ::testing::Values(
+#ifdef ADIOS2_HAVE_BZIP2
+                             adios2::ops::LosslessBZIP2,
+#endif
+                             adios2::ops::temporal::value::backend_zeroruns));
+
+int main(int argc, char **argv)
+{
+#if ADIOS2_USE_MPI
+    MPI_Init(nullptr, nullptr);
+#endif
+
+    int result;
+    ::testing::InitGoogleTest(&argc, argv);
+
+    if (argc > 1)
+    {
+        engineName = std::string(argv[1]);
+    }
+    result = RUN_ALL_TESTS();
+
+#if ADIOS2_USE_MPI
+    MPI_Finalize();
+#endif
+
+    return result;
+}
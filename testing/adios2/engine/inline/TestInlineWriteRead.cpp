@@ -942,6 +942,108 @@ TEST_F(InlineWriteRead, PointerArithmetic)
         EXPECT_EQ(sim_data.data(), local_data);
     }
 }
+
+TEST_F(InlineWriteRead, GlobalSelection)
+{
+    int mpiRank = 0, mpiSize = 1;
+#if ADIOS2_USE_MPI
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpiRank);
+    MPI_Comm_size(MPI_COMM_WORLD, &mpiSize);
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+    adios2::IO io = adios.DeclareIO("TestIO");
+    io.SetEngine("Inline");
+
+    adios2::Engine writer = io.Open("writer", adios2::Mode::Write);
+    adios2::Engine reader = io.Open("reader", adios2::Mode::Read);
+
+    // each rank writes two 4x6 blocks stacked along the first dimension
+    const size_t Ny = 4;
+    const size_t Nx = 6;
+    const size_t row0 = 2 * Ny * mpiRank;
+    auto var = io.DefineVariable<int32_t>(
+        "v", {2 * Ny * static_cast<size_t>(mpiSize), Nx}, {row0, 0}, {Ny, Nx});
+    auto value = io.DefineVariable<int32_t>("step");
+
+    // global value of element (y, x)
+    auto lf_Value = [&](size_t step, size_t y, size_t x) {
+        return static_cast<int32_t>(step * 1000 + y * Nx + x);
+    };
+
+    for (size_t step = 0; step < 2; ++step)
+    {
+        std::vector<int32_t> block0(Ny * Nx), block1(Ny * Nx);
+        for (size_t y = 0; y < Ny; ++y)
+        {
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                block0[y * Nx + x] = lf_Value(step, row0 + y, x);
+                block1[y * Nx + x] = lf_Value(step, row0 + Ny + y, x);
+            }
+        }
+        const int32_t stepValue = static_cast<int32_t>(step);
+
+        writer.BeginStep();
+        writer.Put(value, stepValue);
+        var.SetSelection({{row0, 0}, {Ny, Nx}});
+        writer.Put(var, block0.data());
+        var.SetSelection({{row0 + Ny, 0}, {Ny, Nx}});
+        writer.Put(var, block1.data());
+        writer.EndStep();
+
+        reader.BeginStep();
+        int32_t readValue = -1;
+        reader.Get(value, readValue);
+
+        // selection inside one block: zero-copy pointer into the block
+        int32_t *rows = nullptr;
+        var.SetSelection({{row0 + Ny + 1, 0}, {2, Nx}});
+        reader.Get(var, &rows);
+        EXPECT_EQ(rows, block1.data() + Nx);
+
+        // selection across both blocks: assembled by the engine
+        int32_t *across = nullptr;
+        var.SetSelection({{row0 + 2, 1}, {4, 3}});
+        reader.Get(var, &across);
+        ASSERT_NE(across, nullptr);
+        for (size_t y = 0; y < 4; ++y)
+        {
+            for (size_t x = 0; x < 3; ++x)
+            {
+                EXPECT_EQ(across[y * 3 + x],
+                          lf_Value(step, row0 + 2 + y, 1 + x));
+            }
+        }
+
+        // Get into user memory, deferred and sync
+        std::vector<int32_t> deferred(2 * Ny * Nx, -1);
+        var.SetSelection({{row0, 0}, {2 * Ny, Nx}});
+        reader.Get(var, deferred.data());
+        reader.PerformGets();
+        std::vector<int32_t> sync(Nx, -1);
+        var.SetSelection({{row0 + Ny - 1, 0}, {1, Nx}});
+        reader.Get(var, sync.data(), adios2::Mode::Sync);
+        reader.EndStep();
+
+        EXPECT_EQ(readValue, stepValue);
+        for (size_t y = 0; y < 2 * Ny; ++y)
+        {
+            for (size_t x = 0; x < Nx; ++x)
+            {
+                EXPECT_EQ(deferred[y * Nx + x], lf_Value(step, row0 + y, x));
+            }
+        }
+        for (size_t x = 0; x < Nx; ++x)
+        {
+            EXPECT_EQ(sync[x], lf_Value(step, row0 + Ny - 1, x));
+        }
+    }
+    writer.Close();
+    reader.Close();
+}
+
 //******************************************************************************
 // main
 //******************************************************************************
@@ -274,6 +274,29 @@ TEST_F(MhsEngineTest, TestMhsSingleRank)
 #endif
 }
 
+TEST_F(MhsEngineTest, TestMhsSingleRankThreaded)
+{
+    std::string filename = "TestMhsSingleRankThreaded";
+    adios2::Params engineParams = {{"Verbose", "0"},
+                                   {"Tiers", "4"},
+                                   {"Threading", "true"},
+                                   {"QueueLimit", "4"},
+                                   {"AsyncWrite", "false,true,true,false"}};
+
+    size_t rows = 100;
+    Dims shape = {rows, 1, 128};
+    Dims start = {0, 0, 0};
+    Dims count = {1, 1, 128};
+
+    Writer(shape, start, count, rows, engineParams, filename);
+
+    Reader(shape, start, count, rows, engineParams, filename);
+
+#if ADIOS2_USE_MPI
+    MPI_Barrier(MPI_COMM_WORLD);
+#endif
+}
+
 int main(int argc, char **argv)
 {
 #if ADIOS2_USE_MPI
@@ -130,6 +130,10 @@ void ParseArgs(int argc, char **argv)
             IncreasingDelay = 1;
             Discard = 1;
         }
+        else if (std::string(argv[1]) == "--increasing_delay")
+        {
+            IncreasingDelay = 1;
+        }
         else if (std::string(argv[1]) == "--delay_while_holding")
         {
             DelayWhileHoldingStep = 1;
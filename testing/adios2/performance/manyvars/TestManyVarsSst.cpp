@@ -0,0 +1,151 @@
+/*
+ * Distributed under the OSI-approved Apache License, Version 2.0.  See
+ * accompanying file Copyright.txt for details.
+ *
+ * TestManyVarsSst.cpp : streams a large number of variables through SST
+ * with FFS marshaling and checks that the per-variable Put cost does not
+ * grow with the number of variables
+ */
+#include <adios2.h>
+
+#include <algorithm>
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+const size_t NSteps = 3;
+const size_t NElems = 4;
+
+std::string VarName(size_t i) { return "var" + std::to_string(i); }
+
+/* returns the fastest step's total Put time in seconds */
+double Write(const std::string &fname, size_t nvars)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("Writer");
+    io.SetEngine("SST");
+    io.SetParameters(
+        {{"MarshalMethod", "FFS"}, {"RendezvousReaderCount", "1"}});
+
+    std::vector<adios2::Variable<double>> vars;
+    vars.reserve(nvars);
+    for (size_t i = 0; i < nvars; i++)
+    {
+        vars.push_back(io.DefineVariable<double>(VarName(i), {NElems}, {0},
+                                                 {NElems}));
+    }
+
+    std::vector<double> data(nvars * NElems);
+    double best = std::numeric_limits<double>::max();
+    adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+    for (size_t step = 0; step < NSteps; step++)
+    {
+        for (size_t i = 0; i < nvars; i++)
+        {
+            std::fill_n(data.begin() + i * NElems, NElems,
+                        static_cast<double>(i + step));
+        }
+        writer.BeginStep();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < nvars; i++)
+        {
+            writer.Put(vars[i], data.data() + i * NElems);
+        }
+        auto end = std::chrono::steady_clock::now();
+        writer.EndStep();
+        best = std::min(best,
+                        std::chrono::duration<double>(end - start).count());
+    }
+    writer.Close();
+    return best;
+}
+
+/* returns the number of incorrect values */
+size_t Read(const std::string &fname, size_t nvars)
+{
+    adios2::ADIOS adios;
+    adios2::IO io = adios.DeclareIO("Reader");
+    io.SetEngine("SST");
+    io.SetParameters({{"MarshalMethod", "FFS"}});
+
+    size_t errors = 0;
+    size_t steps = 0;
+    std::vector<double> in(nvars * NElems);
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    while (reader.BeginStep() == adios2::StepStatus::OK)
+    {
+        for (size_t i = 0; i < nvars; i++)
+        {
+            auto var = io.InquireVariable<double>(VarName(i));
+            if (!var)
+            {
+                ++errors;
+                continue;
+            }
+            reader.Get(var, in.data() + i * NElems);
+        }
+        reader.EndStep();
+        for (size_t i = 0; i < nvars; i++)
+        {
+            for (size_t j = 0; j < NElems; j++)
+            {
+                if (in[i * NElems + j] != static_cast<double>(i + steps))
+                {
+                    ++errors;
+                }
+            }
+        }
+        ++steps;
+    }
+    reader.Close();
+    if (steps != NSteps)
+    {
+        ++errors;
+    }
+    return errors;
+}
+
+double RunPair(size_t nvars)
+{
+    const std::string fname = "ManyVarsSst" + std::to_string(nvars);
+    auto read_fut = std::async(std::launch::async, Read, fname, nvars);
+    auto write_fut = std::async(std::launch::async, Write, fname, nvars);
+    const double putTime = write_fut.get();
+    EXPECT_EQ(read_fut.get(), 0) << "with " << nvars << " variables";
+    return putTime;
+}
+}
+
+class ManyVarsSst : public ::testing::Test
+{
+public:
+    ManyVarsSst() = default;
+};
+
+TEST_F(ManyVarsSst, PutScaling)
+{
+    const size_t small = 250;
+    const size_t large = 4000;
+    const double smallPerVar = RunPair(small) / small;
+    const double largePerVar = RunPair(large) / large;
+    std::cout << "Put time per variable: " << smallPerVar * 1e6 << " us with "
+              << small << " variables, " << largePerVar * 1e6 << " us with "
+              << large << " variables" << std::endl;
+
+    // a linear lookup makes the per-variable cost grow with the variable
+    // count (16x here); allow generous headroom for timer noise
+    EXPECT_LT(largePerVar, 6.0 * smallPerVar + 1e-6);
+}
+
+int main(int argc, char **argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
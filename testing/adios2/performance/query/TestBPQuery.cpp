@@ -103,7 +103,7 @@ void BPQueryTest::QueryIntVar(const std::string &fname, adios2::ADIOS &adios,
     adios2::QueryWorker w = adios2::QueryWorker(queryFile, bpReader);
 
     std::vector<size_t> rr;
-    if (engineName.compare("BP4") == 0)
+    if ((engineName.compare("BP4") == 0) || (engineName.compare("BP5") == 0))
         rr = {9, 9, 9};
     else
         rr = {1, 1, 1};
@@ -140,7 +140,7 @@ void BPQueryTest::QueryDoubleVar(const std::string &fname, adios2::ADIOS &adios,
     adios2::QueryWorker w = adios2::QueryWorker(queryFile, bpReader);
 
     std::vector<size_t> rr; //= {0,9,9};
-    if (engineName.compare("BP4") == 0)
+    if ((engineName.compare("BP4") == 0) || (engineName.compare("BP5") == 0))
         rr = {0, 9, 9};
     else
         rr = {0, 1, 1};
@@ -200,6 +200,10 @@ void BPQueryTest::WriteFile(const std::string &fname, adios2::ADIOS &adios,
             io.SetParameters("statslevel=1");
             io.SetParameters("statsblocksize=10");
         }
+        else if (engineName.compare("BP5") == 0)
+        {
+            io.SetParameters("StatsLevel=1,StatsBlockSize=10");
+        }
         io.AddTransport("file");
 
         // QUESTION: It seems that BPFilterWriter cannot overwrite existing
@@ -288,6 +292,29 @@ TEST_F(BPQueryTest, BP4)
     }
 }
 
+#ifdef ADIOS2_HAVE_BP5
+TEST_F(BPQueryTest, BP5)
+{
+    std::string engineName = "BP5";
+    // Sub-block min/max recorded with StatsBlockSize, as in BP4
+    const std::string fname(engineName + "Query1D.bp");
+
+#if ADIOS2_USE_MPI
+    adios2::ADIOS adios(MPI_COMM_WORLD);
+#else
+    adios2::ADIOS adios;
+#endif
+
+    WriteFile(fname, adios, engineName);
+
+    if (mpiSize == 1)
+    {
+        QueryDoubleVar(fname, adios, engineName);
+        QueryIntVar(fname, adios, engineName);
+    }
+}
+#endif
+
 //******************************************************************************
 // main
 //******************************************************************************
@@ -5,6 +5,7 @@
 #include <array>
 #include <stdexcept>
 #include <tuple>
+#include <vector>
 
 #include <adios2.h>
 
@@ -75,6 +76,65 @@ TEST_P(BufferTest, WriteRead)
     }
 }
 
+#if defined(__unix__) && defined(ADIOS2_HAVE_BP5)
+// BP5 reads data straight out of the mapping when reading with mmap
+TEST(MMapTest, BP5Steps)
+{
+    const std::string fname("FileMMapTest_BP5.bp");
+    const size_t Nx = 1000;
+    const size_t NSteps = 3;
+
+    adios2::ADIOS adios;
+    {
+        adios2::IO io = adios.DeclareIO("WriteIO");
+        io.SetEngine("BP5");
+        auto var = io.DefineVariable<double>("var", {Nx}, {0}, {Nx});
+        adios2::Engine writer = io.Open(fname, adios2::Mode::Write);
+        std::vector<double> data(Nx);
+        for (size_t step = 0; step < NSteps; ++step)
+        {
+            for (size_t i = 0; i < Nx; ++i)
+            {
+                data[i] = static_cast<double>(step * Nx + i);
+            }
+            writer.BeginStep();
+            writer.Put(var, data.data());
+            writer.EndStep();
+        }
+        writer.Close();
+    }
+
+    adios2::IO io = adios.DeclareIO("ReadIO");
+    io.SetEngine("BP5");
+    const size_t transportID = io.AddTransport("file");
+    io.SetTransportParameter(transportID, "Library", "mmap");
+    adios2::Engine reader = io.Open(fname, adios2::Mode::Read);
+    size_t step = 0;
+    while (reader.BeginStep() == adios2::StepStatus::OK)
+    {
+        auto var = io.InquireVariable<double>("var");
+        ASSERT_TRUE(var);
+        std::vector<double> all(Nx), part(10);
+        reader.Get(var, all.data());
+        var.SetSelection({{step * 100 + 5}, {10}});
+        reader.Get(var, part.data());
+        reader.EndStep();
+        for (size_t i = 0; i < Nx; ++i)
+        {
+            ASSERT_EQ(all[i], static_cast<double>(step * Nx + i));
+        }
+        for (size_t i = 0; i < part.size(); ++i)
+        {
+            ASSERT_EQ(part[i], static_cast<double>(step * Nx + step * 100 +
+                                                   5 + i));
+        }
+        ++step;
+    }
+    reader.Close();
+    EXPECT_EQ(step, NSteps);
+}
+#endif
+
 #ifdef __unix__
 INSTANTIATE_TEST_SUITE_P(
     TransportTests, BufferTest,
@@ -85,6 +145,8 @@ INSTANTIATE_TEST_SUITE_P(
                       std::make_tuple("posix", "false", "fstream", "true"),
                       std::make_tuple("posix", "false", "fstream", "false"),
                       std::make_tuple("posix", "false", "posix", "false"),
+                      std::make_tuple("posix", "false", "mmap", "false"),
+                      std::make_tuple("stdio", "true", "mmap", "false"),
                       std::make_tuple("stdio", "true", "posix", "false"),
                       std::make_tuple("stdio", "false", "posix", "false"),
 